@@ -0,0 +1,88 @@
+#include <nanorange/algorithm/copy.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+struct pod {
+    std::int64_t a;
+    double b;
+    std::int32_t c;
+};
+
+template <typename F, typename T>
+void copy_contiguous(benchmark::State& state)
+{
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::vector<T> src(sz);
+    std::vector<T> dest(sz);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(src.begin(), src.end(), dest.data()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(sz * sizeof(T)));
+}
+
+struct nano_copy {
+    template <typename I, typename O>
+    O operator()(I f, I l, O o)
+    {
+        return nano::copy(f, l, o).out;
+    }
+};
+
+struct std_copy {
+    template <typename I, typename O>
+    O operator()(I f, I l, O o)
+    {
+        return std::copy(f, l, o);
+    }
+};
+
+// The element-by-element loop that nano::copy used before it learned to
+// call memmove
+struct loop_copy {
+    template <typename I, typename O>
+    O operator()(I f, I l, O o)
+    {
+        const auto dist = l - f;
+        for (decltype(l - f) i = 0; i < dist; ++i) {
+            *o = *f;
+            ++f;
+            ++o;
+        }
+        return o;
+    }
+};
+
+} // namespace
+
+// int -------------------------------------------------
+
+BENCHMARK_TEMPLATE(copy_contiguous, nano_copy, int)
+    ->RangeMultiplier(16)->Range(16, 16 << 20);
+
+BENCHMARK_TEMPLATE(copy_contiguous, std_copy, int)
+    ->RangeMultiplier(16)->Range(16, 16 << 20);
+
+BENCHMARK_TEMPLATE(copy_contiguous, loop_copy, int)
+    ->RangeMultiplier(16)->Range(16, 16 << 20);
+
+// pod -------------------------------------------------
+
+BENCHMARK_TEMPLATE(copy_contiguous, nano_copy, pod)
+    ->RangeMultiplier(16)->Range(16, 4 << 20);
+
+BENCHMARK_TEMPLATE(copy_contiguous, std_copy, pod)
+    ->RangeMultiplier(16)->Range(16, 4 << 20);
+
+BENCHMARK_TEMPLATE(copy_contiguous, loop_copy, pod)
+    ->RangeMultiplier(16)->Range(16, 4 << 20);
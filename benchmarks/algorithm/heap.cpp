@@ -0,0 +1,101 @@
+#include <nanorange/algorithm/make_heap.hpp>
+#include <nanorange/algorithm/pop_heap.hpp>
+#include <nanorange/algorithm/push_heap.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// A scheduler entry: a deadline and what to run when it arrives
+struct task {
+    std::uint64_t deadline;
+    std::uint64_t payload[7];
+};
+
+template <typename T>
+T make_value(std::uint64_t key)
+{
+    if constexpr (std::is_same_v<T, task>) {
+        return task{key, {}};
+    } else {
+        return static_cast<T>(key);
+    }
+}
+
+struct key_of {
+    template <typename T>
+    const T& operator()(const T& t) const { return t; }
+
+    const std::uint64_t& operator()(const task& t) const { return t.deadline; }
+};
+
+// A min-heap of state.range(0) elements, from which we repeatedly pop the
+// earliest element and push one a random distance later, as a timer queue
+// does
+template <typename T, std::size_t D>
+void heap_churn(benchmark::State& state)
+{
+    constexpr auto arity = nano::heap_arity<D>;
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::mt19937_64 gen(sz);
+    std::vector<T> heap;
+    for (std::size_t i = 0; i < sz; i++) {
+        heap.push_back(make_value<T>(gen() % (sz * 4)));
+    }
+    nano::make_heap(arity, heap, nano::greater{}, key_of{});
+
+    for (auto _ : state) {
+        nano::pop_heap(arity, heap, nano::greater{}, key_of{});
+        const auto now = key_of{}(heap.back());
+        heap.back() = make_value<T>(now + gen() % (sz * 4));
+        nano::push_heap(arity, heap, nano::greater{}, key_of{});
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+// Builds a heap of state.range(0) elements with make_heap, then pops them
+// all, as a batch job which drains its queue does
+template <typename T, std::size_t D>
+void heap_drain(benchmark::State& state)
+{
+    constexpr auto arity = nano::heap_arity<D>;
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::mt19937_64 gen(sz);
+    std::vector<T> input;
+    for (std::size_t i = 0; i < sz; i++) {
+        input.push_back(make_value<T>(gen() % (sz * 4)));
+    }
+    std::vector<T> heap;
+
+    for (auto _ : state) {
+        heap = input;
+        nano::make_heap(arity, heap, nano::greater{}, key_of{});
+        for (auto last = heap.end(); last != heap.begin(); --last) {
+            nano::pop_heap(arity, heap.begin(), last, nano::greater{},
+                           key_of{});
+        }
+        benchmark::DoNotOptimize(heap.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(sz));
+}
+
+} // namespace
+
+#define HEAP_BENCHMARK(bench, type)                                            \
+    BENCHMARK_TEMPLATE(bench, type, 2)->Arg(1 << 10)->Arg(1 << 20);            \
+    BENCHMARK_TEMPLATE(bench, type, 4)->Arg(1 << 10)->Arg(1 << 20);            \
+    BENCHMARK_TEMPLATE(bench, type, 8)->Arg(1 << 10)->Arg(1 << 20)
+
+HEAP_BENCHMARK(heap_churn, std::uint32_t);
+HEAP_BENCHMARK(heap_churn, task);
+HEAP_BENCHMARK(heap_drain, std::uint32_t);
+HEAP_BENCHMARK(heap_drain, task);
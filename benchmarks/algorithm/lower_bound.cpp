@@ -0,0 +1,150 @@
+#include <nanorange/algorithm/eytzinger_index.hpp>
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/lower_bound_many.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t num_lookups = 1024;
+
+struct table {
+    std::vector<std::uint64_t> sorted;
+    std::vector<std::uint64_t> keys;
+};
+
+table make_table(std::size_t sz)
+{
+    std::mt19937_64 gen(sz);
+    table t;
+    t.sorted.resize(sz);
+    for (auto& k : t.sorted) {
+        k = gen();
+    }
+    std::sort(t.sorted.begin(), t.sorted.end());
+
+    t.keys.resize(num_lookups);
+    for (auto& k : t.keys) {
+        k = gen();
+    }
+    return t;
+}
+
+template <typename F>
+void lower_bound_random(benchmark::State& state)
+{
+    const table t = make_table(static_cast<std::size_t>(state.range(0)));
+    const F search(t.sorted);
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::uint64_t key : t.keys) {
+            sum += search(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            num_lookups);
+}
+
+struct nano_lower_bound {
+    const std::vector<std::uint64_t>& vec;
+
+    explicit nano_lower_bound(const std::vector<std::uint64_t>& v) : vec(v) {}
+
+    std::uint64_t operator()(std::uint64_t key) const
+    {
+        const auto it = nano::lower_bound(vec, key);
+        return it != vec.end() ? *it : 0;
+    }
+};
+
+struct std_lower_bound {
+    const std::vector<std::uint64_t>& vec;
+
+    explicit std_lower_bound(const std::vector<std::uint64_t>& v) : vec(v) {}
+
+    std::uint64_t operator()(std::uint64_t key) const
+    {
+        const auto it = std::lower_bound(vec.begin(), vec.end(), key);
+        return it != vec.end() ? *it : 0;
+    }
+};
+
+struct nano_eytzinger_lower_bound {
+    nano::eytzinger_index<std::uint64_t> index;
+
+    explicit nano_eytzinger_lower_bound(const std::vector<std::uint64_t>& v)
+        : index(v)
+    {}
+
+    std::uint64_t operator()(std::uint64_t key) const
+    {
+        const std::uint64_t* p = nano::lower_bound(index, key);
+        return p != index.data() + index.size() ? *p : 0;
+    }
+};
+
+// Looks up all the keys at once, in the given order or sorted
+template <bool Sorted>
+void lower_bound_many(benchmark::State& state)
+{
+    table t = make_table(static_cast<std::size_t>(state.range(0)));
+    if (Sorted) {
+        std::sort(t.keys.begin(), t.keys.end());
+    }
+    std::vector<std::vector<std::uint64_t>::const_iterator> out(num_lookups);
+
+    for (auto _ : state) {
+        nano::lower_bound_many(t.sorted, t.keys, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            num_lookups);
+}
+
+template <bool Sorted>
+void lower_bound_each(benchmark::State& state)
+{
+    table t = make_table(static_cast<std::size_t>(state.range(0)));
+    if (Sorted) {
+        std::sort(t.keys.begin(), t.keys.end());
+    }
+    std::vector<std::vector<std::uint64_t>::const_iterator> out(num_lookups);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < num_lookups; i++) {
+            out[i] = nano::lower_bound(std::as_const(t.sorted), t.keys[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            num_lookups);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(lower_bound_random, nano_lower_bound)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+BENCHMARK_TEMPLATE(lower_bound_random, nano_eytzinger_lower_bound)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+BENCHMARK_TEMPLATE(lower_bound_random, std_lower_bound)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+
+BENCHMARK_TEMPLATE(lower_bound_many, false)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+BENCHMARK_TEMPLATE(lower_bound_each, false)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+BENCHMARK_TEMPLATE(lower_bound_many, true)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
+BENCHMARK_TEMPLATE(lower_bound_each, true)
+    ->RangeMultiplier(8)->Range(1 << 10, 64 << 20);
@@ -0,0 +1,92 @@
+#include <nanorange/algorithm/merge.hpp>
+#include <nanorange/algorithm/merge_n.hpp>
+#include <nanorange/views/merge.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t total_size = 1 << 20;
+
+// total_size elements split into k sorted runs, as when merging runs spilled
+// to disk by an external sort
+std::vector<std::vector<std::uint32_t>> make_runs(std::size_t k)
+{
+    std::mt19937 gen(k);
+    std::vector<std::vector<std::uint32_t>> runs(k);
+    for (auto& run : runs) {
+        run.resize(total_size / k);
+        for (auto& i : run) {
+            i = gen();
+        }
+        std::sort(run.begin(), run.end());
+    }
+    return runs;
+}
+
+using runs_t = std::vector<std::vector<std::uint32_t>>;
+
+struct nano_merge_n {
+    void operator()(const runs_t& runs, std::vector<std::uint32_t>& out) const
+    {
+        nano::merge_n(runs, out.begin());
+    }
+};
+
+struct nano_views_merge {
+    void operator()(const runs_t& runs, std::vector<std::uint32_t>& out) const
+    {
+        auto o = out.begin();
+        for (auto i : nano::views::merge(runs)) {
+            *o++ = i;
+        }
+    }
+};
+
+// Merges the runs in pairs, then the results in pairs and so on, which reads
+// every element about log2(k) times
+struct cascaded_merge {
+    void operator()(const runs_t& runs, std::vector<std::uint32_t>& out) const
+    {
+        runs_t level = runs;
+        runs_t next;
+        while (level.size() > 1) {
+            next.clear();
+            for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+                next.emplace_back(level[i].size() + level[i + 1].size());
+                nano::merge(level[i], level[i + 1], next.back().begin());
+            }
+            if (level.size() % 2 != 0) {
+                next.push_back(std::move(level.back()));
+            }
+            std::swap(level, next);
+        }
+        std::copy(level[0].begin(), level[0].end(), out.begin());
+    }
+};
+
+template <typename F>
+void merge_runs(benchmark::State& state)
+{
+    const runs_t runs = make_runs(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> out(total_size);
+
+    for (auto _ : state) {
+        F{}(runs, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(total_size));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(merge_runs, nano_merge_n)->RangeMultiplier(4)->Range(2, 512);
+BENCHMARK_TEMPLATE(merge_runs, nano_views_merge)->RangeMultiplier(4)->Range(2, 512);
+BENCHMARK_TEMPLATE(merge_runs, cascaded_merge)->RangeMultiplier(4)->Range(2, 512);
@@ -0,0 +1,93 @@
+#include <nanorange/algorithm/max_element.hpp>
+#include <nanorange/algorithm/min.hpp>
+#include <nanorange/algorithm/min_element.hpp>
+#include <nanorange/algorithm/minmax_element.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template <typename T>
+std::vector<T> make_data(std::int64_t size)
+{
+    std::mt19937 gen(1729);
+    std::uniform_int_distribution<int> dist(-1000000, 1000000);
+    std::vector<T> vec(static_cast<std::size_t>(size));
+    for (auto& x : vec) {
+        x = static_cast<T>(dist(gen));
+    }
+    return vec;
+}
+
+template <typename T>
+void nano_min_element(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::min_element(vec));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void std_min_element(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::min_element(vec.begin(), vec.end()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_minmax_element(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::minmax_element(vec));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void std_minmax_element(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::minmax_element(vec.begin(), vec.end()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_min(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::min(vec));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+} // namespace
+
+#define MINMAX_BENCHMARK(bench)                                                \
+    BENCHMARK_TEMPLATE(bench, std::int32_t)->Arg(1 << 10)->Arg(1 << 20);       \
+    BENCHMARK_TEMPLATE(bench, float)->Arg(1 << 10)->Arg(1 << 20);              \
+    BENCHMARK_TEMPLATE(bench, double)->Arg(1 << 10)->Arg(1 << 20)
+
+MINMAX_BENCHMARK(nano_min_element);
+MINMAX_BENCHMARK(std_min_element);
+MINMAX_BENCHMARK(nano_minmax_element);
+MINMAX_BENCHMARK(std_minmax_element);
+MINMAX_BENCHMARK(nano_min);
@@ -0,0 +1,137 @@
+#include <nanorange/execution.hpp>
+#include <nanorange/numeric/inclusive_scan.hpp>
+#include <nanorange/numeric/reduce.hpp>
+#include <nanorange/numeric/transform_reduce.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template <typename T>
+std::vector<T> make_data(std::int64_t size)
+{
+    std::mt19937 gen(1729);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    std::vector<T> vec(static_cast<std::size_t>(size));
+    for (auto& x : vec) {
+        x = static_cast<T>(dist(gen));
+    }
+    return vec;
+}
+
+template <typename T>
+void nano_reduce(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::reduce(vec));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_par_reduce(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::reduce(nano::execution::par, vec));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void std_accumulate(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(vec.begin(), vec.end(), T{}));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_transform_reduce(benchmark::State& state)
+{
+    const auto a = make_data<T>(state.range(0));
+    const auto b = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::transform_reduce(a, b, T{}));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void std_inner_product(benchmark::State& state)
+{
+    const auto a = make_data<T>(state.range(0));
+    const auto b = make_data<T>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::inner_product(a.begin(), a.end(), b.begin(), T{}));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_inclusive_scan(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    std::vector<T> out(vec.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nano::inclusive_scan(vec, out.begin()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void nano_par_inclusive_scan(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    std::vector<T> out(vec.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            nano::inclusive_scan(nano::execution::par, vec, out.begin()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename T>
+void std_partial_sum(benchmark::State& state)
+{
+    const auto vec = make_data<T>(state.range(0));
+    std::vector<T> out(vec.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::partial_sum(vec.begin(), vec.end(), out.begin()));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+} // namespace
+
+#define NUMERIC_BENCHMARK(bench)                                               \
+    BENCHMARK_TEMPLATE(bench, std::int32_t)->Arg(1 << 10)->Arg(1 << 20);       \
+    BENCHMARK_TEMPLATE(bench, float)->Arg(1 << 10)->Arg(1 << 20);              \
+    BENCHMARK_TEMPLATE(bench, double)->Arg(1 << 10)->Arg(1 << 20)
+
+NUMERIC_BENCHMARK(nano_reduce);
+NUMERIC_BENCHMARK(nano_par_reduce);
+NUMERIC_BENCHMARK(std_accumulate);
+NUMERIC_BENCHMARK(nano_transform_reduce);
+NUMERIC_BENCHMARK(std_inner_product);
+NUMERIC_BENCHMARK(nano_inclusive_scan);
+NUMERIC_BENCHMARK(nano_par_inclusive_scan);
+NUMERIC_BENCHMARK(std_partial_sum);
@@ -0,0 +1,90 @@
+#include <nanorange/algorithm/sample.hpp>
+#include <nanorange/algorithm/shuffle.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+template <typename Gen>
+void nano_shuffle(benchmark::State& state)
+{
+    std::vector<std::uint32_t> vec(static_cast<std::size_t>(state.range(0)));
+    std::iota(vec.begin(), vec.end(), 0);
+    Gen gen;
+
+    for (auto _ : state) {
+        nano::shuffle(vec, gen);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename Gen>
+void std_shuffle(benchmark::State& state)
+{
+    std::vector<std::uint32_t> vec(static_cast<std::size_t>(state.range(0)));
+    std::iota(vec.begin(), vec.end(), 0);
+    Gen gen;
+
+    for (auto _ : state) {
+        std::shuffle(vec.begin(), vec.end(), gen);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// Samples 1% of state.range(0) elements
+template <typename Gen>
+void nano_sample(benchmark::State& state)
+{
+    std::vector<std::uint32_t> vec(static_cast<std::size_t>(state.range(0)));
+    std::iota(vec.begin(), vec.end(), 0);
+    std::vector<std::uint32_t> out(vec.size() / 100);
+    Gen gen;
+
+    for (auto _ : state) {
+        nano::sample(vec, out.begin(), out.size(), gen);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename Gen>
+void std_sample(benchmark::State& state)
+{
+    std::vector<std::uint32_t> vec(static_cast<std::size_t>(state.range(0)));
+    std::iota(vec.begin(), vec.end(), 0);
+    std::vector<std::uint32_t> out(vec.size() / 100);
+    Gen gen;
+
+    for (auto _ : state) {
+        std::sample(vec.begin(), vec.end(), out.begin(), out.size(), gen);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+} // namespace
+
+#define RANDOM_BENCHMARK(bench)                                                \
+    BENCHMARK_TEMPLATE(bench, std::mt19937)->Arg(1 << 10)->Arg(1 << 20);       \
+    BENCHMARK_TEMPLATE(bench, std::mt19937_64)->Arg(1 << 10)->Arg(1 << 20)
+
+RANDOM_BENCHMARK(nano_shuffle);
+RANDOM_BENCHMARK(std_shuffle);
+RANDOM_BENCHMARK(nano_sample);
+RANDOM_BENCHMARK(std_sample);
@@ -0,0 +1,132 @@
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/remove.hpp>
+#include <nanorange/algorithm/remove_if.hpp>
+#include <nanorange/algorithm/unique.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t size = 1 << 16;
+
+// Random elements, of which state.range(0) percent are zero
+std::vector<std::uint32_t> make_zeros(int percent)
+{
+    std::mt19937 gen(1729);
+    std::bernoulli_distribution zero(percent / 100.0);
+    std::vector<std::uint32_t> vec(size);
+    for (auto& x : vec) {
+        x = zero(gen) ? 0 : gen() | 1;
+    }
+    return vec;
+}
+
+// Random elements, of which state.range(0) percent repeat the one before
+std::vector<std::uint32_t> make_repeats(int percent)
+{
+    std::mt19937 gen(1729);
+    std::bernoulli_distribution repeat(percent / 100.0);
+    std::vector<std::uint32_t> vec(size);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = i > 0 && repeat(gen) ? vec[i - 1] : gen();
+    }
+    return vec;
+}
+
+const auto is_zero = [](std::uint32_t x) { return x == 0; };
+
+// Each iteration copies the input afresh, for the std and nano versions alike
+template <bool Nano>
+void remove_if(benchmark::State& state)
+{
+    const auto src = make_zeros(static_cast<int>(state.range(0)));
+    std::vector<std::uint32_t> vec(size);
+
+    for (auto _ : state) {
+        std::copy(src.begin(), src.end(), vec.begin());
+        if constexpr (Nano) {
+            benchmark::DoNotOptimize(nano::remove_if(vec, is_zero));
+        } else {
+            benchmark::DoNotOptimize(
+                std::remove_if(vec.begin(), vec.end(), is_zero));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(size));
+}
+
+template <bool Nano>
+void remove(benchmark::State& state)
+{
+    const auto src = make_zeros(static_cast<int>(state.range(0)));
+    std::vector<std::uint32_t> vec(size);
+
+    for (auto _ : state) {
+        std::copy(src.begin(), src.end(), vec.begin());
+        if constexpr (Nano) {
+            benchmark::DoNotOptimize(nano::remove(vec, 0u));
+        } else {
+            benchmark::DoNotOptimize(std::remove(vec.begin(), vec.end(), 0u));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(size));
+}
+
+template <bool Nano>
+void copy_if(benchmark::State& state)
+{
+    const auto src = make_zeros(static_cast<int>(state.range(0)));
+    std::vector<std::uint32_t> out(size);
+
+    for (auto _ : state) {
+        if constexpr (Nano) {
+            benchmark::DoNotOptimize(nano::copy_if(src, out.begin(), is_zero));
+        } else {
+            benchmark::DoNotOptimize(
+                std::copy_if(src.begin(), src.end(), out.begin(), is_zero));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(size));
+}
+
+template <bool Nano>
+void unique(benchmark::State& state)
+{
+    const auto src = make_repeats(static_cast<int>(state.range(0)));
+    std::vector<std::uint32_t> vec(size);
+
+    for (auto _ : state) {
+        std::copy(src.begin(), src.end(), vec.begin());
+        if constexpr (Nano) {
+            benchmark::DoNotOptimize(nano::unique(vec));
+        } else {
+            benchmark::DoNotOptimize(std::unique(vec.begin(), vec.end()));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(size));
+}
+
+} // namespace
+
+#define SELECTIVITY_BENCHMARK(bench)                                           \
+    BENCHMARK_TEMPLATE(bench, true)                                            \
+        ->Arg(0)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(100);                 \
+    BENCHMARK_TEMPLATE(bench, false)                                           \
+        ->Arg(0)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(100)
+
+SELECTIVITY_BENCHMARK(remove_if);
+SELECTIVITY_BENCHMARK(remove);
+SELECTIVITY_BENCHMARK(copy_if);
+SELECTIVITY_BENCHMARK(unique);
@@ -0,0 +1,101 @@
+#include <nanorange/algorithm/search.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// A haystack of random lowercase text, with the needle planted at the very
+// end so that every algorithm has to scan the whole thing
+struct search_data {
+    std::string hay;
+    std::string needle;
+
+    search_data(std::size_t hay_size, std::size_t needle_size)
+    {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> dist('a', 'z');
+        const auto random_char = [&] { return static_cast<char>(dist(gen)); };
+
+        std::generate_n(std::back_inserter(needle), needle_size, random_char);
+        std::generate_n(std::back_inserter(hay), hay_size - needle_size,
+                        random_char);
+        hay += needle;
+    }
+};
+
+template <typename F>
+void search_string(benchmark::State& state)
+{
+    const search_data data(static_cast<std::size_t>(state.range(0)),
+                           static_cast<std::size_t>(state.range(1)));
+    const F f(data.needle);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f(data.hay));
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+struct nano_search {
+    const std::string& needle;
+
+    explicit nano_search(const std::string& n) : needle(n) {}
+
+    auto operator()(const std::string& hay) const
+    {
+        return nano::search(hay, needle).begin();
+    }
+};
+
+// The preprocessing happens once, outside the timing loop
+struct nano_searcher {
+    nano::searcher<std::string::const_iterator> s;
+
+    explicit nano_searcher(const std::string& n) : s(n) {}
+
+    auto operator()(const std::string& hay) const { return s(hay).begin(); }
+};
+
+struct std_search {
+    const std::string& needle;
+
+    explicit std_search(const std::string& n) : needle(n) {}
+
+    auto operator()(const std::string& hay) const
+    {
+        return std::search(hay.begin(), hay.end(), needle.begin(),
+                           needle.end());
+    }
+};
+
+struct std_bmh_searcher {
+    std::boyer_moore_horspool_searcher<std::string::const_iterator> s;
+
+    explicit std_bmh_searcher(const std::string& n)
+        : s(n.begin(), n.end())
+    {}
+
+    auto operator()(const std::string& hay) const
+    {
+        return std::search(hay.begin(), hay.end(), s);
+    }
+};
+
+} // namespace
+
+#define SEARCH_ARGS                                                            \
+    Args({1 << 16, 4})->Args({1 << 16, 16})->Args({1 << 16, 64})->Args(      \
+        {1 << 20, 4})->Args({1 << 20, 16})->Args({1 << 20, 64})
+
+BENCHMARK_TEMPLATE(search_string, nano_search)->SEARCH_ARGS;
+BENCHMARK_TEMPLATE(search_string, nano_searcher)->SEARCH_ARGS;
+BENCHMARK_TEMPLATE(search_string, std_search)->SEARCH_ARGS;
+BENCHMARK_TEMPLATE(search_string, std_bmh_searcher)->SEARCH_ARGS;
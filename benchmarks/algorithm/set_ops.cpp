@@ -0,0 +1,150 @@
+#include <nanorange/algorithm/includes.hpp>
+#include <nanorange/algorithm/set_difference.hpp>
+#include <nanorange/algorithm/set_intersection.hpp>
+#include <nanorange/algorithm/set_symmetric_difference.hpp>
+#include <nanorange/algorithm/set_union.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t big_size = 1 << 20;
+
+// A sorted range of big_size elements and one of big_size / ratio elements
+// drawn from the same distribution, as when intersecting posting lists of
+// very different lengths, and a subset of the big range of the same length
+struct inputs {
+    std::vector<std::uint32_t> big;
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> subset;
+};
+
+inputs make_inputs(std::size_t ratio)
+{
+    std::mt19937 gen(ratio);
+    const auto make = [&](std::size_t sz) {
+        std::vector<std::uint32_t> vec(sz);
+        for (auto& i : vec) {
+            i = gen() % (4 * big_size);
+        }
+        std::sort(vec.begin(), vec.end());
+        return vec;
+    };
+
+    inputs in;
+    in.big = make(big_size);
+    in.small = make(big_size / ratio);
+    for (std::size_t i = 0; i < big_size; i += ratio) {
+        in.subset.push_back(in.big[i + gen() % ratio]);
+    }
+    return in;
+}
+
+template <typename F>
+void set_op(benchmark::State& state)
+{
+    const inputs in = make_inputs(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> out(in.big.size() + in.small.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(F{}(in, out.data()));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(in.small.size()));
+}
+
+struct nano_set_intersection {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return nano::set_intersection(in.small, in.big, out);
+    }
+};
+
+struct std_set_intersection {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return std::set_intersection(in.small.begin(), in.small.end(),
+                                     in.big.begin(), in.big.end(), out);
+    }
+};
+
+struct nano_set_difference {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return nano::set_difference(in.small, in.big, out).out;
+    }
+};
+
+struct std_set_difference {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return std::set_difference(in.small.begin(), in.small.end(),
+                                   in.big.begin(), in.big.end(), out);
+    }
+};
+
+struct nano_set_symmetric_difference {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return nano::set_symmetric_difference(in.small, in.big, out).out;
+    }
+};
+
+struct std_set_symmetric_difference {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return std::set_symmetric_difference(in.small.begin(), in.small.end(),
+                                             in.big.begin(), in.big.end(),
+                                             out);
+    }
+};
+
+struct nano_set_union {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return nano::set_union(in.small, in.big, out).out;
+    }
+};
+
+struct std_set_union {
+    auto operator()(const inputs& in, std::uint32_t* out) const
+    {
+        return std::set_union(in.small.begin(), in.small.end(),
+                              in.big.begin(), in.big.end(), out);
+    }
+};
+
+struct nano_includes {
+    auto operator()(const inputs& in, std::uint32_t*) const
+    {
+        return nano::includes(in.big, in.subset);
+    }
+};
+
+struct std_includes {
+    auto operator()(const inputs& in, std::uint32_t*) const
+    {
+        return std::includes(in.big.begin(), in.big.end(), in.subset.begin(),
+                             in.subset.end());
+    }
+};
+
+} // namespace
+
+#define SET_OP_BENCHMARK(op)                                                   \
+    BENCHMARK_TEMPLATE(set_op, nano_##op)                                      \
+        ->RangeMultiplier(10)->Range(1, 10000);                                \
+    BENCHMARK_TEMPLATE(set_op, std_##op)                                       \
+        ->RangeMultiplier(10)->Range(1, 10000)
+
+SET_OP_BENCHMARK(set_intersection);
+SET_OP_BENCHMARK(set_difference);
+SET_OP_BENCHMARK(set_symmetric_difference);
+SET_OP_BENCHMARK(set_union);
+SET_OP_BENCHMARK(includes);
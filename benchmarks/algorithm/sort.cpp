@@ -0,0 +1,221 @@
+#include <nanorange/algorithm/radix_sort.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/views/zip.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    std::uint64_t payload[3];
+};
+
+template <typename T>
+T random_value(std::mt19937_64& gen)
+{
+    if constexpr (std::is_same_v<T, record>) {
+        return record{gen(), {}};
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return std::uniform_real_distribution<T>(-1e6, 1e6)(gen);
+    } else {
+        return static_cast<T>(gen());
+    }
+}
+
+struct key_of {
+    template <typename T>
+    const T& operator()(const T& t) const { return t; }
+
+    const std::uint64_t& operator()(const record& r) const { return r.key; }
+};
+
+template <typename F, typename T>
+void sort_random(benchmark::State& state)
+{
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::mt19937_64 gen(sz);
+    std::vector<T> src(sz);
+    for (auto& t : src) {
+        t = random_value<T>(gen);
+    }
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = src;
+        state.ResumeTiming();
+        F{}(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// Sorted input with range(1) pairs of random elements swapped
+template <typename F, typename T>
+void sort_swaps(benchmark::State& state)
+{
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::mt19937_64 gen(sz);
+    std::vector<T> src(sz);
+    for (auto& t : src) {
+        t = random_value<T>(gen);
+    }
+    std::sort(src.begin(), src.end(), [](const auto& a, const auto& b) {
+        return key_of{}(a) < key_of{}(b);
+    });
+    for (std::int64_t k = 0; k < state.range(1); k++) {
+        std::swap(src[gen() % sz], src[gen() % sz]);
+    }
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = src;
+        state.ResumeTiming();
+        F{}(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+struct nano_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        nano::sort(rng, nano::less{}, key_of{});
+    }
+};
+
+struct nano_par_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        nano::sort(nano::execution::par, rng, nano::less{}, key_of{});
+    }
+};
+
+struct nano_radix_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        nano::radix_sort(rng, nano::less{}, key_of{});
+    }
+};
+
+struct std_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        std::sort(rng.begin(), rng.end(), [](const auto& a, const auto& b) {
+            return key_of{}(a) < key_of{}(b);
+        });
+    }
+};
+
+// Sorts a column of keys together with a column of payloads
+template <typename F>
+void sort_columns(benchmark::State& state)
+{
+    const auto sz = static_cast<std::size_t>(state.range(0));
+
+    std::mt19937_64 gen(sz);
+    std::vector<std::uint64_t> src_keys(sz);
+    for (auto& k : src_keys) {
+        k = gen();
+    }
+    std::vector<std::uint64_t> keys;
+    std::vector<std::uint64_t> payloads(sz);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        keys = src_keys;
+        for (std::size_t i = 0; i < sz; i++) {
+            payloads[i] = i;
+        }
+        state.ResumeTiming();
+        F{}(keys, payloads);
+        benchmark::DoNotOptimize(keys.data());
+        benchmark::DoNotOptimize(payloads.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+struct nano_sort_zip {
+    template <typename K, typename P>
+    void operator()(K& keys, P& payloads) const
+    {
+        nano::sort(nano::views::zip(keys, payloads), nano::less{},
+                   [](const auto& t) -> decltype(auto) {
+                       return std::get<0>(t);
+                   });
+    }
+};
+
+// Sorts a permutation by the keys, then gathers both columns through it
+struct nano_sort_indices {
+    template <typename K, typename P>
+    void operator()(K& keys, P& payloads) const
+    {
+        std::vector<std::size_t> perm(keys.size());
+        for (std::size_t i = 0; i < perm.size(); i++) {
+            perm[i] = i;
+        }
+        nano::sort(perm, nano::less{},
+                   [&keys](std::size_t i) { return keys[i]; });
+
+        K sorted_keys(keys.size());
+        P sorted_payloads(payloads.size());
+        for (std::size_t i = 0; i < perm.size(); i++) {
+            sorted_keys[i] = keys[perm[i]];
+            sorted_payloads[i] = payloads[perm[i]];
+        }
+        keys.swap(sorted_keys);
+        payloads.swap(sorted_payloads);
+    }
+};
+
+} // namespace
+
+#define SORT_BENCHMARKS(type)                                                  \
+    BENCHMARK_TEMPLATE(sort_random, nano_sort, type)                           \
+        ->RangeMultiplier(8)->Range(64, 16 << 20);                             \
+    BENCHMARK_TEMPLATE(sort_random, nano_par_sort, type)                       \
+        ->RangeMultiplier(8)->Range(64, 16 << 20);                             \
+    BENCHMARK_TEMPLATE(sort_random, nano_radix_sort, type)                     \
+        ->RangeMultiplier(8)->Range(64, 16 << 20);                             \
+    BENCHMARK_TEMPLATE(sort_random, std_sort, type)                            \
+        ->RangeMultiplier(8)->Range(64, 16 << 20)
+
+#define SWAPS_BENCHMARKS(type)                                                 \
+    BENCHMARK_TEMPLATE(sort_swaps, nano_sort, type)                            \
+        ->ArgsProduct({{1 << 20}, {1, 10, 100, 1000, 10000}});                 \
+    BENCHMARK_TEMPLATE(sort_swaps, std_sort, type)                             \
+        ->ArgsProduct({{1 << 20}, {1, 10, 100, 1000, 10000}})
+
+SORT_BENCHMARKS(std::uint32_t);
+SORT_BENCHMARKS(std::uint64_t);
+SORT_BENCHMARKS(float);
+SORT_BENCHMARKS(record);
+
+SWAPS_BENCHMARKS(std::uint32_t);
+SWAPS_BENCHMARKS(std::uint64_t);
+SWAPS_BENCHMARKS(record);
+
+BENCHMARK_TEMPLATE(sort_columns, nano_sort_zip)
+    ->RangeMultiplier(8)->Range(64, 16 << 20);
+BENCHMARK_TEMPLATE(sort_columns, nano_sort_indices)
+    ->RangeMultiplier(8)->Range(64, 16 << 20);
@@ -0,0 +1,130 @@
+#include <nanorange/algorithm/stable_sort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    std::uint64_t payload[3];
+};
+
+template <typename T>
+T make_value(std::uint64_t key)
+{
+    if constexpr (std::is_same_v<T, record>) {
+        return record{key, {}};
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return std::to_string(key);
+    } else {
+        return static_cast<T>(key);
+    }
+}
+
+struct key_of {
+    template <typename T>
+    const T& operator()(const T& t) const { return t; }
+
+    const std::uint64_t& operator()(const record& r) const { return r.key; }
+};
+
+enum class input { random, sorted, reversed, nearly_sorted, sawtooth };
+
+template <typename T>
+std::vector<T> make_input(input kind, std::size_t sz)
+{
+    std::mt19937_64 gen(sz);
+    std::vector<std::uint64_t> keys(sz);
+
+    for (std::size_t i = 0; i < sz; i++) {
+        switch (kind) {
+        case input::random:
+            keys[i] = gen() % (sz * 4);
+            break;
+        case input::sorted:
+        case input::nearly_sorted:
+            keys[i] = i;
+            break;
+        case input::reversed:
+            keys[i] = sz - i;
+            break;
+        case input::sawtooth:
+            keys[i] = i % 1000;
+            break;
+        }
+    }
+
+    // Perturb 1% of the elements
+    if (kind == input::nearly_sorted) {
+        for (std::size_t i = 0; i < sz / 100; i++) {
+            keys[gen() % sz] = gen() % sz;
+        }
+    }
+
+    std::vector<T> vec(sz);
+    std::transform(keys.begin(), keys.end(), vec.begin(), make_value<T>);
+    return vec;
+}
+
+template <typename F, typename T, input Kind>
+void stable_sort(benchmark::State& state)
+{
+    const auto sz = static_cast<std::size_t>(state.range(0));
+    const std::vector<T> src = make_input<T>(Kind, sz);
+    std::vector<T> vec;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = src;
+        state.ResumeTiming();
+        F{}(vec);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+struct nano_stable_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        nano::stable_sort(rng, nano::less{}, key_of{});
+    }
+};
+
+struct std_stable_sort {
+    template <typename Rng>
+    void operator()(Rng& rng) const
+    {
+        std::stable_sort(rng.begin(), rng.end(),
+                         [](const auto& a, const auto& b) {
+                             return key_of{}(a) < key_of{}(b);
+                         });
+    }
+};
+
+} // namespace
+
+#define STABLE_SORT_BENCHMARK(type, kind)                                      \
+    BENCHMARK_TEMPLATE(stable_sort, nano_stable_sort, type, input::kind)       \
+        ->RangeMultiplier(16)->Range(64, 4 << 20);                             \
+    BENCHMARK_TEMPLATE(stable_sort, std_stable_sort, type, input::kind)        \
+        ->RangeMultiplier(16)->Range(64, 4 << 20)
+
+#define STABLE_SORT_BENCHMARKS(type)                                           \
+    STABLE_SORT_BENCHMARK(type, random);                                       \
+    STABLE_SORT_BENCHMARK(type, sorted);                                       \
+    STABLE_SORT_BENCHMARK(type, reversed);                                     \
+    STABLE_SORT_BENCHMARK(type, nearly_sorted);                                \
+    STABLE_SORT_BENCHMARK(type, sawtooth)
+
+STABLE_SORT_BENCHMARKS(std::uint64_t);
+STABLE_SORT_BENCHMARKS(record);
+STABLE_SORT_BENCHMARKS(std::string);
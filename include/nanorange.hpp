@@ -9,9 +9,11 @@
 
 #include <nanorange/algorithm.hpp>
 #include <nanorange/concepts.hpp>
+#include <nanorange/execution.hpp>
 #include <nanorange/functional.hpp>
 #include <nanorange/iterator.hpp>
 #include <nanorange/memory.hpp>
+#include <nanorange/numeric.hpp>
 #include <nanorange/random.hpp>
 #include <nanorange/ranges.hpp>
 #include <nanorange/type_traits.hpp>
@@ -16,6 +16,7 @@
 #include <nanorange/algorithm/count.hpp>
 #include <nanorange/algorithm/equal.hpp>
 #include <nanorange/algorithm/equal_range.hpp>
+#include <nanorange/algorithm/eytzinger_index.hpp>
 #include <nanorange/algorithm/fill.hpp>
 #include <nanorange/algorithm/fill_n.hpp>
 #include <nanorange/algorithm/find.hpp>
@@ -34,10 +35,12 @@
 #include <nanorange/algorithm/is_sorted_until.hpp>
 #include <nanorange/algorithm/lexicographical_compare.hpp>
 #include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/lower_bound_many.hpp>
 #include <nanorange/algorithm/make_heap.hpp>
 #include <nanorange/algorithm/max.hpp>
 #include <nanorange/algorithm/max_element.hpp>
 #include <nanorange/algorithm/merge.hpp>
+#include <nanorange/algorithm/merge_n.hpp>
 #include <nanorange/algorithm/min.hpp>
 #include <nanorange/algorithm/min_element.hpp>
 #include <nanorange/algorithm/minmax.hpp>
@@ -47,6 +50,7 @@
 #include <nanorange/algorithm/next_permutation.hpp>
 #include <nanorange/algorithm/none_of.hpp>
 #include <nanorange/algorithm/nth_element.hpp>
+#include <nanorange/algorithm/nth_elements.hpp>
 #include <nanorange/algorithm/partial_sort.hpp>
 #include <nanorange/algorithm/partial_sort_copy.hpp>
 #include <nanorange/algorithm/partition.hpp>
@@ -55,6 +59,7 @@
 #include <nanorange/algorithm/pop_heap.hpp>
 #include <nanorange/algorithm/prev_permutation.hpp>
 #include <nanorange/algorithm/push_heap.hpp>
+#include <nanorange/algorithm/radix_sort.hpp>
 #include <nanorange/algorithm/remove.hpp>
 #include <nanorange/algorithm/remove_copy.hpp>
 #include <nanorange/algorithm/remove_copy_if.hpp>
@@ -67,6 +72,7 @@
 #include <nanorange/algorithm/reverse_copy.hpp>
 #include <nanorange/algorithm/rotate.hpp>
 #include <nanorange/algorithm/rotate_copy.hpp>
+#include <nanorange/algorithm/sample.hpp>
 #include <nanorange/algorithm/search.hpp>
 #include <nanorange/algorithm/search_n.hpp>
 #include <nanorange/algorithm/set_difference.hpp>
@@ -7,7 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_ALL_OF_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_ALL_OF_HPP_INCLUDED
 
-#include <nanorange/ranges.hpp>
+#include <nanorange/algorithm/find.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -51,6 +51,32 @@ public:
         return all_of_fn::impl(nano::begin(rng), nano::end(rng),
                                pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>,
+        bool>
+    operator()(EP&& policy, I first, S last, Pred pred,
+               Proj proj = Proj{}) const
+    {
+        return nano::find_if_not(std::forward<EP>(policy), first, last,
+                                 std::move(pred), std::move(proj)) == last;
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        bool>
+    operator()(EP&& policy, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        const auto last = nano::end(rng);
+        return nano::find_if_not(std::forward<EP>(policy), nano::begin(rng),
+                                 last, std::move(pred), std::move(proj)) == last;
+    }
 };
 
 } // namespace detail
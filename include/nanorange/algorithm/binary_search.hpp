@@ -48,6 +48,20 @@ public:
         return binary_search_fn::impl(nano::begin(rng), nano::end(rng),
                                       value, comp, proj);
     }
+
+    template <typename T, typename U, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        indirect_strict_weak_order<Comp, const U*, projected<const T*, Proj>>,
+        bool>
+    operator()(const eytzinger_index<T>& index, const U& value,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const T* const last = index.data() + index.size();
+        const T* const pos = detail::eytzinger_lower_bound(
+            index.data(), index.size(), value, comp, proj);
+        return pos != last && !nano::invoke(comp, value, nano::invoke(proj, *pos));
+    }
 };
 
 }
@@ -7,6 +7,10 @@
 #ifndef NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/compact.hpp>
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
+#include <nanorange/detail/iterator/segmented.hpp>
 #include <nanorange/iterator/operations.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -38,6 +42,23 @@ namespace detail {
 
 struct copy_fn {
 private:
+    // For segmented iterators, copy each segment with its own loop (or
+    // memmove)
+    template <typename I, typename S, typename O>
+    static constexpr std::enable_if_t<segmented_iterator<I, S>,
+                                      copy_result<I, O>>
+    impl(I first, S last, O result, priority_tag<2>)
+    {
+        first = for_each_segment(std::move(first), std::move(last),
+                                 [&result](auto f, auto l) {
+            auto res = copy_fn::impl(std::move(f), std::move(l),
+                                     std::move(result), priority_tag<2>{});
+            result = std::move(res.out);
+            return std::move(res.in);
+        });
+        return {std::move(first), std::move(result)};
+    }
+
     // If we know the distance between first and last, we can use that
     // information to (potentially) allow better codegen
     template <typename I, typename S, typename O>
@@ -46,6 +67,16 @@ private:
     {
         const auto dist = last - first;
 
+        // For trivially copyable types, we can hand the whole thing over
+        // to memmove
+        if constexpr (memmove_copyable<I, O>) {
+            if (!detail::is_constant_evaluated()) {
+                result = detail::memmove_n(first, dist, std::move(result));
+                first += dist;
+                return {std::move(first), std::move(result)};
+            }
+        }
+
         for (iter_difference_t<I> i = 0; i < dist; ++i) {
             *result = *first;
             ++first;
@@ -68,6 +99,22 @@ private:
         return {std::move(first), std::move(result)};
     }
 
+    template <typename EP, typename I, typename S, typename O>
+    static copy_result<I, O> par_impl(I first, S last, O result)
+    {
+        if constexpr (parallelizable<EP, I, S> && random_access_iterator<O>) {
+            const auto n = last - first;
+            detail::parallel_for(n, [&](auto b, auto e) {
+                copy_fn::impl(first + b, first + e, result + b,
+                              priority_tag<1>{});
+            });
+            return {first + n, result + n};
+        } else {
+            return copy_fn::impl(std::move(first), std::move(last),
+                                 std::move(result), priority_tag<2>{});
+        }
+    }
+
 public:
     template <typename I, typename S, typename O>
     constexpr std::enable_if_t<input_iterator<I> && sentinel_for<S, I> &&
@@ -77,7 +124,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return copy_fn::impl(std::move(first), std::move(last),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 
     template <typename Rng, typename O>
@@ -87,7 +134,29 @@ public:
     operator()(Rng&& rng, O result) const
     {
         return copy_fn::impl(nano::begin(rng), nano::end(rng),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
+    }
+
+    template <typename EP, typename I, typename S, typename O>
+    std::enable_if_t<execution_policy<EP> && forward_iterator<I> &&
+                         sentinel_for<S, I> && forward_iterator<O> &&
+                         indirectly_copyable<I, O>,
+                     copy_result<I, O>>
+    operator()(EP&&, I first, S last, O result) const
+    {
+        return copy_fn::par_impl<EP>(std::move(first), std::move(last),
+                                     std::move(result));
+    }
+
+    template <typename EP, typename Rng, typename O>
+    std::enable_if_t<execution_policy<EP> && forward_range<Rng> &&
+                         forward_iterator<O> &&
+                         indirectly_copyable<iterator_t<Rng>, O>,
+                     copy_result<safe_iterator_t<Rng>, O>>
+    operator()(EP&&, Rng&& rng, O result) const
+    {
+        return copy_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                     std::move(result));
     }
 };
 
@@ -107,6 +176,16 @@ struct copy_n_fn {
                                copy_n_result<I, O>>
     operator()(I first, iter_difference_t<I> n, O result) const
     {
+        if constexpr (memmove_copyable<I, O>) {
+            if (!detail::is_constant_evaluated()) {
+                if (n > 0) {
+                    result = detail::memmove_n(first, n, std::move(result));
+                    first += n;
+                }
+                return {std::move(first), std::move(result)};
+            }
+        }
+
         for (iter_difference_t<I> i{}; i < n; i++) {
             *result = *first;
             ++first;
@@ -132,6 +211,19 @@ private:
     static constexpr copy_if_result<I, O> impl(I first, S last, O result,
                                                Pred pred, Proj proj)
     {
+        if constexpr (compactable_copy<I, S, O>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto n = last - first;
+                const auto keep = [&pred, &proj](auto& e) {
+                    return nano::invoke(pred, nano::invoke(proj, e));
+                };
+                const auto out = detail::to_address(result);
+                const auto end = detail::compact_copy(p, p + n, out, keep);
+                return {first + n, result + (end - out)};
+            }
+        }
+
         while (first != last) {
             if (nano::invoke(pred, nano::invoke(proj, *first))) {
                 *result = *first;
@@ -187,6 +279,16 @@ private:
     impl(I1 first, S1 last, I2 result)
     {
         I1 last_it = nano::next(first, std::move(last));
+
+        if constexpr (memmove_copyable<I1, I2>) {
+            if (!detail::is_constant_evaluated()) {
+                result = detail::memmove_backward_n(std::move(first),
+                                                    last_it - first,
+                                                    std::move(result));
+                return {std::move(last_it), std::move(result)};
+            }
+        }
+
         I1 it = last_it;
 
         while (it != first) {
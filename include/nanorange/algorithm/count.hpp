@@ -7,8 +7,12 @@
 #ifndef NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/find_value.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
 #include <nanorange/ranges.hpp>
 
+#include <vector>
+
 NANO_BEGIN_NAMESPACE
 
 // [rng.alg.count]
@@ -35,6 +39,39 @@ private:
         return counter;
     }
 
+    // Sums count(b, e) over pieces of [0, n) counted on the thread pool
+    template <typename D, typename Count>
+    static D par_sum(D n, Count count)
+    {
+        const std::size_t num_chunks =
+            detail::parallel_chunk_count(static_cast<std::size_t>(n));
+        std::vector<D> counts(num_chunks);
+        detail::parallel_for_chunks(n, num_chunks,
+                                    [&](std::size_t i, D b, D e) {
+                                        counts[i] = count(b, e);
+                                    });
+        D total = 0;
+        for (const D c : counts) {
+            total += c;
+        }
+        return total;
+    }
+
+    template <typename EP, typename I, typename S, typename Proj,
+              typename Pred>
+    static iter_difference_t<I> par_impl(I first, S last, Pred& pred,
+                                         Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            return count_if_fn::par_sum(last - first, [&](auto b, auto e) {
+                return count_if_fn::impl(first + b, first + e, pred, proj);
+            });
+        } else {
+            return count_if_fn::impl(std::move(first), std::move(last), pred,
+                                     proj);
+        }
+    }
+
 public:
     template <typename I, typename S, typename Proj = identity, typename Pred>
     constexpr std::enable_if_t<
@@ -57,6 +94,30 @@ public:
         return count_if_fn::impl(nano::begin(rng), nano::end(rng),
                                  pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>,
+        iter_difference_t<I>>
+    operator()(EP&&, I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        return count_if_fn::par_impl<EP>(std::move(first), std::move(last),
+                                         pred, proj);
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        iter_difference_t<iterator_t<Rng>>>
+    operator()(EP&&, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return count_if_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                         pred, proj);
+    }
 };
 } // namespace detail
 
@@ -65,6 +126,46 @@ NANO_INLINE_VAR(detail::count_if_fn, count_if)
 namespace detail {
 
 struct count_fn {
+private:
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr iter_difference_t<I> impl(I first, S last, const T& value,
+                                               Proj& proj)
+    {
+        const auto pred = [&value] (const auto& t) { return t == value; };
+
+        // For contiguous ranges of integers, use a vectorised count
+        if constexpr (value_search_vectorizable<I, S, T, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                using E = iter_value_t<I>;
+                const auto n = last - first;
+                const E val = static_cast<E>(value);
+                if (n <= 0 || !pred(val)) {
+                    return 0;
+                }
+                return static_cast<iter_difference_t<I>>(detail::count_value_n(
+                    detail::to_address(first), static_cast<std::size_t>(n),
+                    val));
+            }
+        }
+
+        return count_if_fn::impl(std::move(first), std::move(last), pred, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T, typename Proj>
+    static iter_difference_t<I> par_impl(I first, S last, const T& value,
+                                         Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            return count_if_fn::par_sum(last - first, [&](auto b, auto e) {
+                return count_fn::impl(first + b, first + e, value, proj);
+            });
+        } else {
+            return count_fn::impl(std::move(first), std::move(last), value,
+                                  proj);
+        }
+    }
+
+public:
     template <typename I, typename S, typename T, typename Proj = identity>
     constexpr std::enable_if_t<
         input_iterator<I> && sentinel_for<S, I> &&
@@ -72,9 +173,7 @@ struct count_fn {
         iter_difference_t<I>>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return count_if_fn::impl(std::move(first), std::move(last),
-                                 pred, proj);
+        return count_fn::impl(std::move(first), std::move(last), value, proj);
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -85,9 +184,31 @@ struct count_fn {
         iter_difference_t<iterator_t<Rng>>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return count_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                 pred, proj);
+        return count_fn::impl(nano::begin(rng), nano::end(rng), value, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_relation<ranges::equal_to, projected<I, Proj>, const T*>,
+        iter_difference_t<I>>
+    operator()(EP&&, I first, S last, const T& value, Proj proj = Proj{}) const
+    {
+        return count_fn::par_impl<EP>(std::move(first), std::move(last), value,
+                                      proj);
+    }
+
+    template <typename EP, typename Rng, typename T, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_relation<ranges::equal_to, projected<iterator_t<Rng>, Proj>,
+                             const T*>,
+        iter_difference_t<iterator_t<Rng>>>
+    operator()(EP&&, Rng&& rng, const T& value, Proj proj = Proj{}) const
+    {
+        return count_fn::par_impl<EP>(nano::begin(rng), nano::end(rng), value,
+                                      proj);
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/bitwise_compare.hpp>
 #include <nanorange/iterator/operations.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -38,6 +39,17 @@ private:
     static constexpr bool impl3(I1 first1, S1 last1, I2 first2, Pred pred,
                                 Proj1& proj1, Proj2& proj2)
     {
+        if constexpr (is_equal_to_v<Pred> && sized_sentinel_for<S1, I1> &&
+                      bitwise_comparable<I1, I2, Pred, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = last1 - first1;
+                return n <= 0 ||
+                       detail::equal_n(detail::to_address(first1),
+                                       detail::to_address(first2),
+                                       static_cast<std::size_t>(n));
+            }
+        }
+
         while (first1 != last1) {
             if (!nano::invoke(pred, nano::invoke(proj1, *first1),
                               nano::invoke(proj2, *first2))) {
@@ -21,8 +21,13 @@ private:
     static constexpr subrange<I> impl(I first, S last, const T& value,
                                       Comp& comp, Proj& proj)
     {
-        return {lower_bound_fn::impl(first, last, value, comp, proj),
-                upper_bound_fn::impl(first, last, value, comp, proj)};
+        // Everything before the lower bound is less than value, so we only
+        // need to search for the upper bound after it
+        I lower = lower_bound_fn::impl(std::move(first), last, value, comp,
+                                       proj);
+        I upper = upper_bound_fn::impl(lower, std::move(last), value, comp,
+                                       proj);
+        return {std::move(lower), std::move(upper)};
     }
 
 public:
@@ -0,0 +1,115 @@
+// nanorange/algorithm/eytzinger_index.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_EYTZINGER_INDEX_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_EYTZINGER_INDEX_HPP_INCLUDED
+
+#include <nanorange/detail/simd.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+// A copy of a sorted sequence, rearranged into the breadth-first order of
+// the binary search tree over it (the "Eytzinger layout"). Node k of the tree
+// has children 2k and 2k + 1 (counting from 1), so the first few levels of
+// every search share a handful of cache lines, and the nodes a search may
+// visit a few levels ahead are adjacent and can be prefetched. For large
+// tables this makes lower_bound() and binary_search() considerably faster
+// than searching the sorted sequence itself.
+//
+// An eytzinger_index is not a range. It is searched with the overloads of
+// nano::lower_bound and nano::binary_search which take one, and its elements
+// may be inspected in their tree order through data() and size().
+template <typename T>
+class eytzinger_index {
+public:
+    eytzinger_index() = default;
+
+    // Builds the index from the elements of rng, which must be sorted
+    template <typename Rng,
+              std::enable_if_t<forward_range<Rng> && default_constructible<T> &&
+                                   assignable_from<T&, range_reference_t<Rng>>,
+                               int> = 0>
+    explicit eytzinger_index(Rng&& rng)
+        : data_(static_cast<std::size_t>(nano::distance(rng)))
+    {
+        const std::size_t n = data_.size();
+        if (n == 0) {
+            return;
+        }
+
+        // Visit the nodes in order, starting from the leftmost, so that they
+        // take the sorted elements one by one
+        std::size_t k = 1;
+        while (2 * k <= n) {
+            k *= 2;
+        }
+
+        for (auto it = nano::begin(rng); k != 0; ++it) {
+            data_[k - 1] = *it;
+            if (2 * k + 1 <= n) {
+                k = 2 * k + 1;
+                while (2 * k <= n) {
+                    k *= 2;
+                }
+            } else {
+                k >>= detail::simd::ctz64(~std::uint64_t{k}) + 1;
+            }
+        }
+    }
+
+    std::size_t size() const { return data_.size(); }
+    [[nodiscard]] bool empty() const { return data_.empty(); }
+
+    // The elements in tree order: node k is at data()[k - 1]
+    const T* data() const { return data_.data(); }
+
+private:
+    std::vector<T> data_;
+};
+
+namespace detail {
+
+// Returns a pointer to the first element of the index which is not less
+// than value, or data + n if there is none
+template <typename T, typename U, typename Comp, typename Proj>
+const T* eytzinger_lower_bound(const T* data, std::size_t n, const U& value,
+                               Comp& comp, Proj& proj)
+{
+    // The descendants of node k which are log2(stride) levels below it are
+    // the stride nodes starting at node k * stride, which span about one
+    // cache line. We prefetch them while we compare against node k.
+    constexpr std::size_t stride = [] {
+        std::size_t s = 1;
+        while (2 * s * sizeof(T) <= 64) {
+            s *= 2;
+        }
+        return s;
+    }();
+
+    std::size_t k = 1;
+    while (k <= n) {
+        if (k * stride <= n) {
+            simd::prefetch(data + (k * stride - 1));
+        }
+        k = 2 * k +
+            (nano::invoke(comp, nano::invoke(proj, data[k - 1]), value) ? 1
+                                                                         : 0);
+    }
+
+    // Since leaving the node we want we have gone right at every step, so
+    // we find it by undoing those steps and the left step before them
+    k >>= detail::simd::ctz64(~std::uint64_t{k}) + 1;
+    return k == 0 ? data + n : data + (k - 1);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
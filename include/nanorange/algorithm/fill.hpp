@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 
+#include <nanorange/detail/execution/parallel_for.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -26,6 +27,20 @@ private:
         return first;
     }
 
+    template <typename EP, typename T, typename O, typename S>
+    static O par_impl(O first, S last, const T& value)
+    {
+        if constexpr (parallelizable<EP, O, S>) {
+            const auto n = last - first;
+            detail::parallel_for(n, [&](auto b, auto e) {
+                fill_fn::impl(first + b, first + e, value);
+            });
+            return first + n;
+        } else {
+            return fill_fn::impl(std::move(first), std::move(last), value);
+        }
+    }
+
 public:
     template <typename T, typename O, typename S>
     constexpr std::enable_if_t<
@@ -41,6 +56,24 @@ public:
     {
         return fill_fn::impl(nano::begin(rng), nano::end(rng), value);
     }
+
+    template <typename EP, typename T, typename O, typename S>
+    std::enable_if_t<execution_policy<EP> && forward_iterator<O> &&
+                         output_iterator<O, const T&> && sentinel_for<S, O>,
+                     O>
+    operator()(EP&&, O first, S last, const T& value) const
+    {
+        return fill_fn::par_impl<EP>(std::move(first), std::move(last), value);
+    }
+
+    template <typename EP, typename T, typename Rng>
+    std::enable_if_t<execution_policy<EP> && forward_range<Rng> &&
+                         output_range<Rng, const T&>,
+                     safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, const T& value) const
+    {
+        return fill_fn::par_impl<EP>(nano::begin(rng), nano::end(rng), value);
+    }
 };
 
 } // namespace detail
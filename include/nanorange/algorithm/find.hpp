@@ -7,6 +7,8 @@
 #ifndef NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/find_value.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -32,6 +34,21 @@ private:
         return first;
     }
 
+    template <typename EP, typename I, typename S, typename Pred,
+              typename Proj>
+    static I par_impl(I first, S last, Pred& pred, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            const auto scan = [&](auto b, auto e) {
+                return find_if_fn::impl(first + b, first + e, pred, proj) - first;
+            };
+            return first + detail::parallel_find(last - first, scan);
+        } else {
+            return find_if_fn::impl(std::move(first), std::move(last), pred,
+                                    proj);
+        }
+    }
+
 public:
     template <typename I, typename S, typename Proj = identity, typename Pred>
     constexpr std::enable_if_t<
@@ -52,6 +69,30 @@ public:
     {
         return find_if_fn::impl(nano::begin(rng), nano::end(rng), pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>,
+        I>
+    operator()(EP&&, I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        return find_if_fn::par_impl<EP>(std::move(first), std::move(last),
+                                        pred, proj);
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return find_if_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                        pred, proj);
+    }
 };
 } // namespace detail
 
@@ -60,6 +101,50 @@ NANO_INLINE_VAR(detail::find_if_fn, find_if)
 namespace detail {
 
 struct find_fn {
+private:
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr I impl(I first, S last, const T& value, Proj& proj)
+    {
+        const auto pred = [&value] (const auto& t) { return t == value; };
+
+        // For contiguous ranges of integers, use a vectorised search
+        if constexpr (value_search_vectorizable<I, S, T, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                using E = iter_value_t<I>;
+                const auto n = last - first;
+                if (n <= 0) {
+                    return first;
+                }
+                // If the value doesn't survive conversion to the element
+                // type, then nothing in the range can compare equal to it
+                const E val = static_cast<E>(value);
+                if (!pred(val)) {
+                    return first + n;
+                }
+                const E* ptr = detail::to_address(first);
+                return first + (detail::find_value_n(ptr, static_cast<std::size_t>(n), val) -
+                               ptr);
+            }
+        }
+
+        return find_if_fn::impl(std::move(first), std::move(last), pred, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T, typename Proj>
+    static I par_impl(I first, S last, const T& value, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            const auto scan = [&](auto b, auto e) {
+                return find_fn::impl(first + b, first + e, value, proj) - first;
+            };
+            return first + detail::parallel_find(last - first, scan);
+        } else {
+            return find_fn::impl(std::move(first), std::move(last), value,
+                                 proj);
+        }
+    }
+
+public:
     template <typename I, typename S, typename T, typename Proj = identity>
     constexpr std::enable_if_t<
         input_iterator<I> && sentinel_for<S, I> &&
@@ -67,8 +152,7 @@ struct find_fn {
         I>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return find_if_fn::impl(std::move(first), std::move(last), pred, proj);
+        return find_fn::impl(std::move(first), std::move(last), value, proj);
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -79,8 +163,31 @@ struct find_fn {
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = [&value] (const auto& t) { return t == value; };
-        return find_if_fn::impl(nano::begin(rng), nano::end(rng), pred, proj);
+        return find_fn::impl(nano::begin(rng), nano::end(rng), value, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_relation<ranges::equal_to, projected<I, Proj>, const T*>,
+        I>
+    operator()(EP&&, I first, S last, const T& value, Proj proj = Proj{}) const
+    {
+        return find_fn::par_impl<EP>(std::move(first), std::move(last), value,
+                                     proj);
+    }
+
+    template <typename EP, typename Rng, typename T, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_relation<ranges::equal_to, projected<iterator_t<Rng>, Proj>,
+                             const T*>,
+        safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, const T& value, Proj proj = Proj{}) const
+    {
+        return find_fn::par_impl<EP>(nano::begin(rng), nano::end(rng), value,
+                                     proj);
     }
 };
 } // namespace detail
@@ -126,6 +233,32 @@ public:
         return find_if_fn::impl(nano::begin(rng), nano::end(rng),
                                 find_if_pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>,
+        I>
+    operator()(EP&&, I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        auto find_if_pred = not_pred<Pred>{pred};
+        return find_if_fn::par_impl<EP>(std::move(first), std::move(last),
+                                        find_if_pred, proj);
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        auto find_if_pred = not_pred<Pred>{pred};
+        return find_if_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                        find_if_pred, proj);
+    }
 };
 } // namespace detail
 
@@ -30,6 +30,16 @@ private:
             return {last_it, last_it};
         }
 
+        // For contiguous ranges of integers, preprocess the needle once and
+        // reuse it for each successive search
+        if constexpr (substring_searchable<I1, S1, I2, S2, Pred, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                return find_end_fn::impl_preprocessed(std::move(first1),
+                                                      last1 - first1,
+                                                      first2, last2 - first2);
+            }
+        }
+
         auto result = search_fn::impl(std::move(first1), last1, first2, last2, pred, proj1, proj2);
 
         if (result.empty()) {
@@ -46,6 +56,40 @@ private:
         }
     }
 
+    template <typename I1, typename I2>
+    static subrange<I1> impl_preprocessed(I1 first1, iter_difference_t<I1> n,
+                                          I2 first2, iter_difference_t<I2> m)
+    {
+        using E = iter_value_t<I1>;
+
+        if (n < m) {
+            first1 += n;
+            return {first1, first1};
+        }
+
+        const substring_searcher<E> searcher(detail::to_address(first2),
+                                             static_cast<std::size_t>(m));
+        const E* const hay = detail::to_address(first1);
+        const auto len = static_cast<std::size_t>(n);
+        std::size_t result = len;
+
+        for (std::size_t pos = 0; len - pos >= searcher.size();) {
+            const std::size_t i = searcher.search(hay + pos, len - pos);
+            if (i == len - pos) {
+                break;
+            }
+            result = pos + i;
+            pos = result + 1;
+        }
+
+        if (result == len) {
+            first1 += n;
+            return {first1, first1};
+        }
+        first1 += static_cast<iter_difference_t<I1>>(result);
+        return {first1, first1 + static_cast<iter_difference_t<I1>>(m)};
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
             typename Pred = ranges::equal_to, typename Proj1 = identity,
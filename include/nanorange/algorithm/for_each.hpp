@@ -7,6 +7,8 @@
 #ifndef NANORANGE_ALGORITHM_FOR_EACH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FOR_EACH_HPP_INCLUDED
 
+#include <nanorange/detail/execution/parallel_for.hpp>
+#include <nanorange/detail/iterator/segmented.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -39,15 +41,48 @@ namespace detail {
 
 struct for_each_fn {
 private:
+    template <typename I, typename S, typename Proj, typename Fun>
+    static constexpr I loop(I first, S last, Fun& fun, Proj& proj)
+    {
+        // For segmented iterators, run a separate loop over each segment
+        if constexpr (segmented_iterator<I, S>) {
+            return for_each_segment(std::move(first), std::move(last),
+                                    [&fun, &proj](auto f, auto l) {
+                return for_each_fn::loop(std::move(f), std::move(l), fun,
+                                         proj);
+            });
+        } else {
+            while (first != last) {
+                nano::invoke(fun, nano::invoke(proj, *first));
+                ++first;
+            }
+            return first;
+        }
+    }
+
     template <typename I, typename S, typename Proj, typename Fun>
     static constexpr for_each_result<I, Fun>
     impl(I first, S last, Fun& fun, Proj& proj)
     {
-        while (first != last) {
-            nano::invoke(fun, nano::invoke(proj, *first));
-            ++first;
+        I end = for_each_fn::loop(std::move(first), std::move(last), fun, proj);
+        return {std::move(end), std::move(fun)};
+    }
+
+    template <typename EP, typename I, typename S, typename Proj, typename Fun>
+    static I par_impl(I first, S last, Fun& fun, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            const auto n = last - first;
+            detail::parallel_for(n, [&](auto b, auto e) {
+                // Each thread calls its own copy of the function
+                Fun f = fun;
+                for_each_fn::impl(first + b, first + e, f, proj);
+            });
+            return first + n;
+        } else {
+            return for_each_fn::impl(std::move(first), std::move(last), fun,
+                                     proj).in;
         }
-        return {first, std::move(fun)};
     }
 
 public:
@@ -72,6 +107,32 @@ public:
         return for_each_fn::impl(nano::begin(rng), nano::end(rng),
                                  fun, proj);
     }
+
+    // With an execution policy, returns just the end iterator, since the
+    // function object may have been copied
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Fun>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_invocable<Fun, projected<I, Proj>>,
+        I>
+    operator()(EP&&, I first, S last, Fun fun, Proj proj = Proj{}) const
+    {
+        return for_each_fn::par_impl<EP>(std::move(first), std::move(last),
+                                         fun, proj);
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Fun>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_invocable<Fun, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, Fun fun, Proj proj = Proj{}) const
+    {
+        return for_each_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                         fun, proj);
+    }
 };
 } // namespace detail
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_INCLUDES_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_INCLUDES_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/set_gallop.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -15,11 +16,13 @@ namespace detail {
 
 struct includes_fn {
 private:
-    template <typename I1, typename S1, typename I2, typename S2,
+    template <bool Gallop, typename I1, typename S1, typename I2, typename S2,
               typename Comp, typename Proj1, typename Proj2>
-     static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                                Comp& comp, Proj1& proj1, Proj2& proj2)
+     static constexpr bool impl_loop(I1 first1, S1 last1, I2 first2, S2 last2,
+                                     Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        set_gallop_counter gallop;
+
         while (first2 != last2) {
             // If range1 is done but we still have elements in range2, then
             // it is not a subset
@@ -39,15 +42,48 @@ private:
             // element
             if (!nano::invoke(comp, nano::invoke(proj1, *first1),
                               nano::invoke(proj2, *first2))) {
+                ++first1;
                 ++first2;
+                gallop.step_both();
+                continue;
             }
 
             ++first1;
+
+            // Otherwise we skip over this element of r1, and any more which
+            // are less than the current element of r2 at once
+            if constexpr (Gallop && set_can_gallop<I1, S1>) {
+                if (gallop.step1() && first1 != last1) {
+                    const auto n = detail::set_gallop(
+                        first1, last1, nano::invoke(proj2, *first2), comp,
+                        proj1);
+                    first1 += n;
+                    gallop.galloped(n);
+                }
+            }
         }
 
         return true;
     }
 
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr bool
+    impl(I1 first1, S1 last1, I2 first2, S2 last2,
+         Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (set_can_gallop<I1, S1>) {
+            if (detail::set_should_gallop(first1, last1, first2, last2)) {
+                return includes_fn::impl_loop<true>(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), comp, proj1, proj2);
+            }
+        }
+        return includes_fn::impl_loop<false>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), comp, proj1, proj2);
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Comp = ranges::less, typename Proj1 = identity, typename Proj2 = identity>
@@ -22,7 +22,8 @@ struct is_heap_fn {
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         const auto n = nano::distance(first, last);
-        return is_heap_until_fn::impl(std::move(first), n, comp, proj) == last;
+        return is_heap_until_fn::impl<2>(std::move(first), n, comp, proj) ==
+               last;
     }
 
     template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
@@ -32,8 +33,34 @@ struct is_heap_fn {
         bool>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return is_heap_until_fn::impl(nano::begin(rng), nano::distance(rng),
-                                      comp, proj) == nano::end(rng);
+        return is_heap_until_fn::impl<2>(nano::begin(rng), nano::distance(rng),
+                                         comp, proj) == nano::end(rng);
+    }
+
+    template <std::size_t D, typename I, typename S,
+              typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         indirect_strict_weak_order<Comp, projected<I, Proj>>,
+                     bool>
+    operator()(heap_arity_t<D>, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return is_heap_until_fn::impl<D>(std::move(first), n, comp, proj) ==
+               last;
+    }
+
+    template <std::size_t D, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        random_access_range<Rng> &&
+            indirect_strict_weak_order<Comp, projected<iterator_t<Rng>, Proj>>,
+        bool>
+    operator()(heap_arity_t<D>, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return is_heap_until_fn::impl<D>(nano::begin(rng), nano::distance(rng),
+                                         comp, proj) == nano::end(rng);
     }
 };
 
@@ -12,6 +12,7 @@
 #ifndef NANORANGE_ALGORITHM_IS_HEAP_UNTIL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_IS_HEAP_UNTIL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/heap_sift.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -22,34 +23,22 @@ struct is_heap_until_fn {
 private:
     friend struct is_heap_fn;
 
-    template <typename I, typename Comp, typename Proj>
+    template <std::size_t D, typename I, typename Comp, typename Proj>
     static constexpr I impl(I first, const iter_difference_t<I> n, Comp& comp,
                             Proj& proj)
     {
-        iter_difference_t<I> p = 0, c = 1;
-
+        // Compare each parent in turn with each of its D children
         I pp = first;
+        iter_difference_t<I> c = 1;
 
         while (c < n) {
-            I cp = first + c;
-
-            if (nano::invoke(comp, nano::invoke(proj, *pp),
-                             nano::invoke(proj, *cp))) {
-                return cp;
-            }
-
-            ++c;
-            ++cp;
-
-            if (c == n || nano::invoke(comp, nano::invoke(proj, *pp),
-                                       nano::invoke(proj, *cp))) {
-                return cp;
+            for (std::size_t j = 0; j < D && c < n; ++j, ++c) {
+                if (nano::invoke(comp, nano::invoke(proj, *pp),
+                                 nano::invoke(proj, *(first + c)))) {
+                    return first + c;
+                }
             }
-
-            ++p;
             ++pp;
-
-            c = 2 * p + 1;
         }
 
         return first + n;
@@ -65,7 +54,7 @@ public:
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         auto n = nano::distance(first, last);
-        return is_heap_until_fn::impl(std::move(first), n, comp, proj);
+        return is_heap_until_fn::impl<2>(std::move(first), n, comp, proj);
     }
 
     template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
@@ -75,8 +64,34 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return is_heap_until_fn::impl(nano::begin(rng), nano::distance(rng),
-                                      comp, proj);
+        return is_heap_until_fn::impl<2>(nano::begin(rng), nano::distance(rng),
+                                         comp, proj);
+    }
+
+    template <std::size_t D, typename I, typename S,
+              typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<
+        random_access_iterator<I> && sentinel_for<S, I> &&
+            indirect_strict_weak_order<Comp, projected<I, Proj>>,
+        I>
+    operator()(heap_arity_t<D>, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        auto n = nano::distance(first, last);
+        return is_heap_until_fn::impl<D>(std::move(first), n, comp, proj);
+    }
+
+    template <std::size_t D, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        random_access_range<Rng> &&
+        indirect_strict_weak_order<Comp, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(heap_arity_t<D>, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return is_heap_until_fn::impl<D>(nano::begin(rng), nano::distance(rng),
+                                         comp, proj);
     }
 };
 
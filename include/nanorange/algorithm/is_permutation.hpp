@@ -10,17 +10,184 @@
 #include <nanorange/algorithm/any_of.hpp>
 #include <nanorange/algorithm/count.hpp>
 #include <nanorange/algorithm/mismatch.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
+struct std_hashable_concept {
+    template <typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename T>
+    static auto test(int) -> std::enable_if_t<
+        std::is_default_constructible_v<std::hash<T>> &&
+        std::is_convertible_v<
+            invoke_result_t<const std::hash<T>&, const T&>, std::size_t>,
+        std::true_type>;
+};
+
+// True if std::hash<T> is enabled
+template <typename T>
+NANO_CONCEPT std_hashable = decltype(std_hashable_concept::test<T>(0))::value;
+
+// Stands in for the hasher when is_permutation is not given one
+struct is_permutation_no_hash {};
+
 struct is_permutation_fn {
 private:
+    // Counts the elements of the first range in an open-addressing hash
+    // table, in which each distinct value is represented by the first element
+    // with that value, and then counts the elements of the second range back
+    // out again. As the ranges are the same length, they are permutations of
+    // one another if no count goes below zero.
     template <typename I1, typename S1, typename I2, typename S2, typename Pred,
+              typename Proj1, typename Proj2, typename Hash>
+    static bool hash_counts(I1 first1, S1 last1, I2 first2, S2 last2,
+                            Pred& pred, Proj1& proj1, Proj2& proj2, Hash& hash)
+    {
+        struct slot {
+            I1 elem{};
+            std::size_t hash = 0;
+            // Negative if the slot is empty
+            iter_difference_t<I1> count = -1;
+        };
+
+        // Keep the table at most two thirds full
+        const auto n = static_cast<std::size_t>(nano::distance(first1, last1));
+        int bits = 4;
+        while ((std::size_t(1) << bits) < n + n / 2) {
+            ++bits;
+        }
+        std::vector<slot> table(std::size_t(1) << bits);
+        const std::size_t mask = table.size() - 1;
+
+        // std::hash is often the identity for integers, so we spread the
+        // hashes out with a Fibonacci multiplication before using their top
+        // bits
+        const auto home = [bits](std::size_t h) {
+            return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(h) * 0x9E3779B97F4A7C15u) >>
+                (64 - bits));
+        };
+
+        for (; first1 != last1; ++first1) {
+            auto&& value = nano::invoke(proj1, *first1);
+            const auto h = static_cast<std::size_t>(nano::invoke(hash, value));
+            for (std::size_t i = home(h);; i = (i + 1) & mask) {
+                slot& s = table[i];
+                if (s.count < 0) {
+                    s.elem = first1;
+                    s.hash = h;
+                    s.count = 1;
+                    break;
+                }
+                if (s.hash == h &&
+                    nano::invoke(pred, nano::invoke(proj1, *s.elem), value)) {
+                    ++s.count;
+                    break;
+                }
+            }
+        }
+
+        for (; first2 != last2; ++first2) {
+            auto&& value = nano::invoke(proj2, *first2);
+            const auto h = static_cast<std::size_t>(nano::invoke(hash, value));
+            for (std::size_t i = home(h);; i = (i + 1) & mask) {
+                slot& s = table[i];
+                if (s.count < 0) {
+                    return false;
+                }
+                if (s.hash == h &&
+                    nano::invoke(pred, nano::invoke(proj1, *s.elem), value)) {
+                    if (s.count-- == 0) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Sorts the projected values of each range and compares them
+    template <typename T, typename I1, typename S1, typename I2, typename S2,
               typename Proj1, typename Proj2>
+    static bool sorted_equal(I1 first1, S1 last1, I2 first2, S2 last2,
+                             Proj1& proj1, Proj2& proj2)
+    {
+        std::vector<T> values1;
+        std::vector<T> values2;
+        values1.reserve(static_cast<std::size_t>(nano::distance(first1, last1)));
+        values2.reserve(values1.capacity());
+        for (; first1 != last1; ++first1) {
+            values1.push_back(nano::invoke(proj1, *first1));
+        }
+        for (; first2 != last2; ++first2) {
+            values2.push_back(nano::invoke(proj2, *first2));
+        }
+
+        auto less = ranges::less{};
+        auto id = identity{};
+        detail::pdqsort(values1.begin(), values1.end(), less, id);
+        detail::pdqsort(values2.begin(), values2.end(), less, id);
+
+        for (std::size_t i = 0; i < values1.size(); ++i) {
+            if (!(values1[i] == values2[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Compares the ranges with a hash table given a hasher, or if we can use
+    // std::hash with equal_to; failing that, by sorting them if the values
+    // are totally ordered; and failing that, by counting each distinct value
+    // in both ranges, which takes O(n^2) time.
+    template <typename I1, typename S1, typename I2, typename S2, typename Pred,
+              typename Proj1, typename Proj2, typename Hash>
     static constexpr bool process_tail(I1 first1, S1 last1, I2 first2, S2 last2,
-                                       Pred& pred, Proj1& proj1, Proj2& proj2)
+                                       Pred& pred, Proj1& proj1, Proj2& proj2,
+                                       Hash& hash)
+    {
+        using T1 = remove_cvref_t<indirect_result_t<Proj1&, I1>>;
+        using T2 = remove_cvref_t<indirect_result_t<Proj2&, I2>>;
+        constexpr bool same_values = is_equal_to_v<Pred> && same_as<T1, T2>;
+
+        if (!detail::is_constant_evaluated()) {
+            if constexpr (!same_as<Hash, is_permutation_no_hash>) {
+                return is_permutation_fn::hash_counts(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), pred, proj1, proj2, hash);
+            } else if constexpr (same_values && std_hashable<T1>) {
+                std::hash<T1> std_hash{};
+                return is_permutation_fn::hash_counts(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), pred, proj1, proj2, std_hash);
+            } else if constexpr (same_values && totally_ordered<T1> &&
+                                 copyable<T1>) {
+                return is_permutation_fn::sorted_equal<T1>(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), proj1, proj2);
+            }
+        }
+
+        return is_permutation_fn::compare_counts(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), pred, proj1, proj2);
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2, typename Pred,
+              typename Proj1, typename Proj2>
+    static constexpr bool compare_counts(I1 first1, S1 last1, I2 first2,
+                                         S2 last2, Pred& pred, Proj1& proj1,
+                                         Proj2& proj2)
     {
         for (auto it = first1; it != last1; ++it) {
             const auto comp = [&pred, val = nano::invoke(proj1, *it)]
@@ -53,9 +220,10 @@ private:
     }
 
     template <typename I1, typename S1, typename I2, typename Pred,
-        typename Proj1, typename Proj2>
+        typename Proj1, typename Proj2, typename Hash>
     static constexpr bool impl3(I1 first1, S1 last1, I2 first2,
-                                Pred& pred, Proj1& proj1, Proj2& proj2)
+                                Pred& pred, Proj1& proj1, Proj2& proj2,
+                                Hash& hash)
     {
         // Strip equal prefixes from both ranges
         auto result = mismatch_fn::impl3(std::move(first1), last1,
@@ -78,13 +246,14 @@ private:
 
         return is_permutation_fn::process_tail(std::move(first1), std::move(last1),
                                                std::move(first2), std::move(last2),
-                                               pred, proj1, proj2);
+                                               pred, proj1, proj2, hash);
     }
 
     template <typename I1, typename S1, typename I2, typename S2,
-              typename Pred, typename Proj1, typename Proj2>
+              typename Pred, typename Proj1, typename Proj2, typename Hash>
     static constexpr bool impl4(I1 first1, S1 last1, I2 first2, S2 last2,
-                                Pred& pred, Proj1& proj1, Proj2& proj2)
+                                Pred& pred, Proj1& proj1, Proj2& proj2,
+                                Hash& hash)
     {
         // Strip equal prefixes from both ranges
         auto result = mismatch_fn::impl4(std::move(first1), last1,
@@ -106,7 +275,48 @@ private:
 
         return is_permutation_fn::process_tail(std::move(first1), std::move(last1),
                                                std::move(first2), std::move(last2),
-                                               pred, proj1, proj2);
+                                               pred, proj1, proj2, hash);
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred, typename Proj1, typename Proj2, typename Hash>
+    static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
+                               Pred& pred, Proj1& proj1, Proj2& proj2,
+                               Hash& hash)
+    {
+        if constexpr (sized_sentinel_for<S1, I1> &&
+                      sized_sentinel_for<S2, I2>) {
+            if (nano::distance(first1, last1) != nano::distance(first2, last2)) {
+                return false;
+            }
+            return is_permutation_fn::impl3(std::move(first1), std::move(last1),
+                                            std::move(first2), pred,
+                                            proj1, proj2, hash);
+        }
+
+        return is_permutation_fn::impl4(std::move(first1), std::move(last1),
+                                        std::move(first2), std::move(last2),
+                                        pred, proj1, proj2, hash);
+    }
+
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2, typename Hash>
+    static constexpr bool impl_rng(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                   Proj1& proj1, Proj2& proj2, Hash& hash)
+    {
+        if (sized_range<Rng1> && sized_range<Rng2>) {
+            if (nano::distance(rng1) != nano::distance(rng2)) {
+                return false;
+            }
+
+            return is_permutation_fn::impl3(nano::begin(rng1), nano::end(rng1),
+                                            nano::begin(rng2), pred,
+                                            proj1, proj2, hash);
+        }
+
+        return is_permutation_fn::impl4(nano::begin(rng1), nano::end(rng1),
+                                        nano::begin(rng2), nano::end(rng2),
+                                        pred, proj1, proj2, hash);
     }
 
 public:
@@ -123,19 +333,30 @@ public:
     operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        if constexpr (sized_sentinel_for<S1, I1> &&
-                      sized_sentinel_for<S2, I2>) {
-            if (nano::distance(first1, last1) != nano::distance(first2, last2)) {
-                return false;
-            }
-            return is_permutation_fn::impl3(std::move(first1), std::move(last1),
-                                            std::move(first2), pred,
-                                            proj1, proj2);
-        }
+        is_permutation_no_hash hash{};
+        return is_permutation_fn::impl(std::move(first1), std::move(last1),
+                                       std::move(first2), std::move(last2),
+                                       pred, proj1, proj2, hash);
+    }
 
-        return is_permutation_fn::impl4(std::move(first1), std::move(last1),
-                                        std::move(first2), std::move(last2),
-                                        pred, proj1, proj2);
+    // Extension: four-legged with a hasher, which must give the same hash
+    // for any two elements which pred considers equal. The elements are
+    // counted in a hash table, in O(n) expected time.
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred, typename Proj1, typename Proj2, typename Hash>
+    std::enable_if_t<
+        forward_iterator<I1> && sentinel_for<S1, I1> && forward_iterator<I2> &&
+            sentinel_for<S2, I2> &&
+            indirectly_comparable<I1, I2, Pred, Proj1, Proj2> &&
+            regular_invocable<Hash&, iter_reference_t<projected<I1, Proj1>>> &&
+            regular_invocable<Hash&, iter_reference_t<projected<I2, Proj2>>>,
+        bool>
+    operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred,
+               Proj1 proj1, Proj2 proj2, Hash hash) const
+    {
+        return is_permutation_fn::impl(std::move(first1), std::move(last1),
+                                       std::move(first2), std::move(last2),
+                                       pred, proj1, proj2, hash);
     }
 
     // Three-legged
@@ -151,9 +372,10 @@ public:
     operator()(I1 first1, S1 last1, I2 first2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
+        is_permutation_no_hash hash{};
         return is_permutation_fn::impl3(std::move(first1), std::move(last1),
                                         std::move(first2), pred,
-                                        proj1, proj2);
+                                        proj1, proj2, hash);
 
     }
 
@@ -168,19 +390,28 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        if (sized_range<Rng1> && sized_range<Rng2>) {
-            if (nano::distance(rng1) != nano::distance(rng2)) {
-                return false;
-            }
-
-            return is_permutation_fn::impl3(nano::begin(rng1), nano::end(rng1),
-                                            nano::begin(rng2), pred,
-                                            proj1, proj2);
-        }
+        is_permutation_no_hash hash{};
+        return is_permutation_fn::impl_rng(rng1, rng2, pred, proj1, proj2,
+                                           hash);
+    }
 
-        return is_permutation_fn::impl4(nano::begin(rng1), nano::end(rng1),
-                                        nano::begin(rng2), nano::end(rng2),
-                                        pred, proj1, proj2);
+    // Extension: two ranges with a hasher
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2, typename Hash>
+    std::enable_if_t<
+        forward_range<Rng1> && forward_range<Rng2> &&
+            indirectly_comparable<iterator_t<Rng1>, iterator_t<Rng2>, Pred,
+                                 Proj1, Proj2> &&
+            regular_invocable<
+                Hash&, iter_reference_t<projected<iterator_t<Rng1>, Proj1>>> &&
+            regular_invocable<
+                Hash&, iter_reference_t<projected<iterator_t<Rng2>, Proj2>>>,
+        bool>
+    operator()(Rng1&& rng1, Rng2&& rng2, Pred pred, Proj1 proj1, Proj2 proj2,
+               Hash hash) const
+    {
+        return is_permutation_fn::impl_rng(rng1, rng2, pred, proj1, proj2,
+                                           hash);
     }
 
     // Range and a half
@@ -194,9 +425,10 @@ public:
         bool>
     operator()(Rng1&& rng1, I2&& first2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const {
+        is_permutation_no_hash hash{};
         return is_permutation_fn::impl3(nano::begin(rng1), nano::end(rng1),
                                         std::forward<I2>(first2), pred,
-                                        proj1, proj2);
+                                        proj1, proj2, hash);
     }
 };
 
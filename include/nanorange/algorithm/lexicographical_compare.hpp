@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/bitwise_compare.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -20,6 +21,23 @@ private:
     static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
                                 Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        // For contiguous ranges of integers, we can use memcmp() or a
+        // vectorised mismatch to skip over the common prefix
+        if constexpr (is_less_v<Comp> &&
+                      sized_sentinel_for<S1, I1> && sized_sentinel_for<S2, I2> &&
+                      bitwise_comparable<I1, I2, Comp, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n1 = last1 - first1;
+                const auto n2 = last2 - first2;
+                if (n1 <= 0 || n2 <= 0) {
+                    return n1 <= 0 && n2 > 0;
+                }
+                return detail::lexicographical_less_n(
+                    detail::to_address(first1), static_cast<std::size_t>(n1),
+                    detail::to_address(first2), static_cast<std::size_t>(n2));
+            }
+        }
+
         while (first1 != last1 && first2 != last2) {
             if (nano::invoke(comp, nano::invoke(proj1, *first1),
                               nano::invoke(proj2, *first2))) {
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_LOWER_BOUND_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_LOWER_BOUND_HPP_INCLUDED
 
+#include <nanorange/algorithm/eytzinger_index.hpp>
 #include <nanorange/algorithm/partition_point.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -17,6 +18,7 @@ struct lower_bound_fn {
 private:
     friend struct binary_search_fn;
     friend struct equal_range_fn;
+    friend struct lower_bound_many_fn;
 
     template <typename Comp, typename T>
     struct compare {
@@ -64,6 +66,20 @@ public:
         return lower_bound_fn::impl(nano::begin(rng), nano::end(rng),
                                     value, comp, proj);
     }
+
+    // Returns a pointer to the first element of the index which is not less
+    // than value, or index.data() + index.size() if there is none
+    template <typename T, typename U, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        indirect_strict_weak_order<Comp, const U*, projected<const T*, Proj>>,
+        const T*>
+    operator()(const eytzinger_index<T>& index, const U& value,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return detail::eytzinger_lower_bound(index.data(), index.size(),
+                                             value, comp, proj);
+    }
 };
 
 }
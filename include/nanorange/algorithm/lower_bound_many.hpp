@@ -0,0 +1,204 @@
+// nanorange/algorithm/lower_bound_many.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_LOWER_BOUND_MANY_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_LOWER_BOUND_MANY_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: for each key in [first2, last2) (after projection by proj2),
+// writes to out the lower bound of that key in the sorted range
+// [first1, last1), as nano::lower_bound(first1, last1, key, comp, proj1)
+// would return it. Returns the end of the keys and of the output.
+//
+// With a random-access haystack, the keys are looked up in batches, and the
+// searches in a batch proceed side by side, so that their cache misses
+// overlap rather than following one another. While the keys arrive in
+// sorted order, each search instead gallops forward from the previous
+// result, which makes looking up many sorted keys a linear merge.
+template <typename I, typename O>
+using lower_bound_many_result = copy_result<I, O>;
+
+namespace detail {
+
+struct lower_bound_many_fn {
+private:
+    // The number of searches which proceed side by side
+    static constexpr int batch_size = 16;
+
+    // While the keys are in order, we keep following them as long as their
+    // bounds are on average no further apart than this. For keys which are
+    // sparser than that, galloping costs more than a fresh search.
+    static constexpr int max_gallop_gap = 16;
+
+    template <typename I1, typename D, typename I2, typename Comp,
+              typename Proj1, typename Proj2>
+    static void search_batch(I1 first1, D n, const I2* keys, D* pos,
+                             Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        for (int i = 0; i < batch_size; i++) {
+            pos[i] = 0;
+        }
+
+        // As in partition_point, the length of the remaining range does not
+        // depend on the comparisons, so every search takes the same number
+        // of steps. Unlike there, we do not prefetch: the loads of the
+        // different searches are independent, so their misses already
+        // overlap, and prefetching would only add to the traffic.
+        while (n > 1) {
+            const D half = n / 2;
+            for (int i = 0; i < batch_size; i++) {
+                pos[i] += nano::invoke(comp,
+                                       nano::invoke(proj1, first1[pos[i] + half]),
+                                       nano::invoke(proj2, *keys[i]))
+                              ? half
+                              : 0;
+            }
+            n -= half;
+        }
+
+        if (n == 1) {
+            for (int i = 0; i < batch_size; i++) {
+                pos[i] += nano::invoke(comp, nano::invoke(proj1, first1[pos[i]]),
+                                       nano::invoke(proj2, *keys[i]))
+                              ? 1
+                              : 0;
+            }
+        }
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static lower_bound_many_result<I2, O>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O out, Comp& comp,
+         Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (random_access_iterator<I1> &&
+                      sized_sentinel_for<S1, I1> && forward_iterator<I2>) {
+            using D = iter_difference_t<I1>;
+            const D n = last1 - first1;
+
+            I2 keys[batch_size];
+            D pos[batch_size];
+            D prev = 0;
+            bool in_order = true;
+
+            while (first2 != last2) {
+                int k = 0;
+                for (; k < batch_size && first2 != last2; ++k, ++first2) {
+                    keys[k] = first2;
+                }
+
+                if (in_order) {
+                    for (int i = 0; i < k; i++) {
+                        auto&& key = nano::invoke(proj2, *keys[i]);
+                        const auto is_less = [&](auto&& x) {
+                            return nano::invoke(comp, nano::invoke(proj1, x),
+                                                key);
+                        };
+
+                        if (prev == 0 || is_less(first1[prev - 1])) {
+                            prev += detail::gallop_prefix(first1 + prev,
+                                                          n - prev, is_less);
+                        } else {
+                            // The keys are not in order after all, but we
+                            // still know the bound is before prev
+                            in_order = false;
+                            prev = lower_bound_fn::impl(first1,
+                                                        first1 + (prev - 1),
+                                                        key, comp, proj1) -
+                                   first1;
+                        }
+                        pos[i] = prev;
+                    }
+                } else {
+                    // A short final batch is padded with copies of its last
+                    // key, so that every batch is searched by the same code
+                    for (int i = k; i < batch_size; i++) {
+                        keys[i] = keys[k - 1];
+                    }
+                    lower_bound_many_fn::search_batch(first1, n, keys, pos,
+                                                      comp, proj1, proj2);
+
+                    // If this batch happened to be in order, we can try
+                    // following the keys from its last result
+                    in_order = true;
+                    for (int i = 1; i < k; i++) {
+                        in_order = in_order && pos[i - 1] <= pos[i];
+                    }
+                    prev = pos[k - 1];
+                }
+
+                in_order = in_order &&
+                           pos[k - 1] - pos[0] <= D(k) * max_gallop_gap;
+
+                for (int i = 0; i < k; i++) {
+                    *out = first1 + pos[i];
+                    ++out;
+                }
+            }
+
+            return {std::move(first2), std::move(out)};
+        } else {
+            for (; first2 != last2; ++first2, ++out) {
+                *out = lower_bound_fn::impl(first1, last1,
+                                            nano::invoke(proj2, *first2), comp,
+                                            proj1);
+            }
+            return {std::move(first2), std::move(out)};
+        }
+    }
+
+public:
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp = ranges::less, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        forward_iterator<I1> && sentinel_for<S1, I1> && input_iterator<I2> &&
+            sentinel_for<S2, I2> && weakly_incrementable<O> &&
+            writable<O, I1> &&
+            indirect_strict_weak_order<Comp, projected<I1, Proj1>,
+                                       projected<I2, Proj2>>,
+        lower_bound_many_result<I2, O>>
+    operator()(I1 first1, S1 last1, I2 first2, S2 last2, O out,
+               Comp comp = Comp{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return lower_bound_many_fn::impl(std::move(first1), std::move(last1),
+                                         std::move(first2), std::move(last2),
+                                         std::move(out), comp, proj1, proj2);
+    }
+
+    template <typename Rng1, typename Rng2, typename O,
+              typename Comp = ranges::less, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        forward_range<Rng1> && forwarding_range<Rng1> && input_range<Rng2> &&
+            weakly_incrementable<O> &&
+            writable<O, iterator_t<Rng1>> &&
+            indirect_strict_weak_order<Comp, projected<iterator_t<Rng1>, Proj1>,
+                                       projected<iterator_t<Rng2>, Proj2>>,
+        lower_bound_many_result<safe_iterator_t<Rng2>, O>>
+    operator()(Rng1&& rng1, Rng2&& rng2, O out, Comp comp = Comp{},
+               Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        return lower_bound_many_fn::impl(nano::begin(rng1), nano::end(rng1),
+                                         nano::begin(rng2), nano::end(rng2),
+                                         std::move(out), comp, proj1, proj2);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::lower_bound_many_fn, lower_bound_many)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -20,15 +20,16 @@ namespace detail {
 
 struct make_heap_fn {
 private:
-    template <typename I, typename Comp, typename Proj>
+    template <std::size_t D, typename I, typename Comp, typename Proj>
     static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
                             Proj& proj)
     {
         if (n > 1) {
             // start from the first parent, there is no need to consider
             // children
-            for (auto start = (n - 2) / 2; start >= 0; --start) {
-                detail::sift_down_n(first, n, first + start, comp, proj);
+            for (auto start = (n - 2) / iter_difference_t<I>(D); start >= 0;
+                 --start) {
+                detail::sift_down_n<D>(first, n, first + start, comp, proj);
             }
         }
 
@@ -43,7 +44,7 @@ public:
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         const auto n = nano::distance(first, last);
-        return make_heap_fn::impl(std::move(first), n, comp, proj);
+        return make_heap_fn::impl<2>(std::move(first), n, comp, proj);
     }
 
     template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
@@ -52,8 +53,31 @@ public:
                                safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return make_heap_fn::impl(nano::begin(rng), nano::distance(rng), comp,
-                                  proj);
+        return make_heap_fn::impl<2>(nano::begin(rng), nano::distance(rng),
+                                     comp, proj);
+    }
+
+    template <std::size_t D, typename I, typename S,
+              typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(heap_arity_t<D>, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return make_heap_fn::impl<D>(std::move(first), n, comp, proj);
+    }
+
+    template <std::size_t D, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(heap_arity_t<D>, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return make_heap_fn::impl<D>(nano::begin(rng), nano::distance(rng),
+                                     comp, proj);
     }
 };
 
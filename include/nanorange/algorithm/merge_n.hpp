@@ -0,0 +1,68 @@
+// nanorange/algorithm/merge_n.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_MERGE_N_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_MERGE_N_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/loser_tree.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: merges each of the sorted ranges in rngs into a single sorted
+// sequence written to out, and returns the end of the output. Equal elements
+// are taken from earlier ranges first.
+//
+// Rather than merging the ranges pairwise, which would read each element
+// about log2(k) times for k ranges, the ranges are merged in a single pass
+// using a loser tree, which costs about log2(k) comparisons per element.
+namespace detail {
+
+struct merge_n_fn {
+private:
+    template <typename Rng, typename O, typename Comp, typename Proj>
+    static O impl(Rng& rngs, O out, Comp& comp, Proj& proj)
+    {
+        using inner_t = range_reference_t<Rng>;
+
+        loser_tree<iterator_t<inner_t>, sentinel_t<inner_t>, Proj> tree;
+        for (auto&& r : rngs) {
+            tree.add(nano::begin(r), nano::end(r));
+        }
+        tree.build(comp, proj);
+
+        while (!tree.empty()) {
+            *out = *tree.top();
+            ++out;
+            tree.pop(comp, proj);
+        }
+
+        return out;
+    }
+
+public:
+    template <typename Rng, typename O, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        forward_range<Rng> && input_range<range_reference_t<Rng>> &&
+            forwarding_range<range_reference_t<Rng>> &&
+            weakly_incrementable<O> &&
+            indirectly_copyable<iterator_t<range_reference_t<Rng>>, O> &&
+            indirect_strict_weak_order<
+                Comp, projected<iterator_t<range_reference_t<Rng>>, Proj>>,
+        O>
+    operator()(Rng&& rngs, O out, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return merge_n_fn::impl(rngs, std::move(out), comp, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::merge_n_fn, merge_n)
+
+NANO_END_NAMESPACE
+
+#endif
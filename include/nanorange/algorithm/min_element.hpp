@@ -7,16 +7,18 @@
 #ifndef NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/minmax_value.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
 #include <nanorange/ranges.hpp>
 
+#include <vector>
+
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
 struct min_element_fn {
 private:
-    friend struct nth_element_fn;
-
     template <typename I, typename S, typename Comp, typename Proj>
     static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
     {
@@ -24,6 +26,18 @@ private:
             return first;
         }
 
+        if constexpr (minmax_vectorizable<I, S, Comp, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                using E = iter_value_t<I>;
+                const E* p = detail::to_address(first);
+                const E* found = detail::vector_minmax_element<true, false>(
+                                     p, p + (last - first)).first;
+                if (found) {
+                    return first + (found - p);
+                }
+            }
+        }
+
         I i = nano::next(first);
         while (i != last) {
             if (nano::invoke(comp, nano::invoke(proj, *i),
@@ -36,6 +50,37 @@ private:
         return first;
     }
 
+    template <typename EP, typename I, typename S, typename Comp,
+              typename Proj>
+    static I par_impl(I first, S last, Comp& comp, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            using D = iter_difference_t<I>;
+            const D n = last - first;
+            const std::size_t num_chunks =
+                detail::parallel_chunk_count(static_cast<std::size_t>(n));
+            std::vector<I> results(num_chunks);
+            detail::parallel_for_chunks(n, num_chunks,
+                                        [&](std::size_t i, D b, D e) {
+                results[i] = min_element_fn::impl(first + b, first + e, comp, proj);
+            });
+
+            // Combine the results in order, so that ties are broken just as
+            // they are by the sequential algorithm
+            I best = results[0];
+            for (std::size_t i = 1; i < num_chunks; i++) {
+                const I& r = results[i];
+                if (nano::invoke(comp, nano::invoke(proj, *r),
+                                 nano::invoke(proj, *best))) {
+                    best = r;
+                }
+            }
+            return n == 0 ? first : best;
+        } else {
+            return min_element_fn::impl(std::move(first), std::move(last), comp, proj);
+        }
+    }
+
 public:
     template <typename I, typename S, typename Comp = ranges::less,
               typename Proj = identity>
@@ -58,6 +103,29 @@ public:
         return min_element_fn::impl(nano::begin(rng), nano::end(rng),
                                     comp, proj);
     }
+    template <typename EP, typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_strict_weak_order<Comp, projected<I, Proj>>, I>
+    operator()(EP&&, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return min_element_fn::par_impl<EP>(std::move(first), std::move(last),
+                                            comp, proj);
+    }
+
+    template <typename EP, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_strict_weak_order<Comp, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return min_element_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                            comp, proj);
+    }
 };
 
 }
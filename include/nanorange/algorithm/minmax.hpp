@@ -10,6 +10,7 @@
 #ifndef NANORANGE_ALGORITHM_MINMAX_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MINMAX_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/minmax_value.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -46,6 +47,18 @@ private:
         auto first = nano::begin(rng);
         const auto last = nano::end(rng);
 
+        if constexpr (minmax_vectorizable<iterator_t<Rng>, sentinel_t<Rng>,
+                                          Comp, Proj>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto bounds =
+                    detail::vector_minmax_value(p, p + (last - first));
+                if (!bounds.unordered) {
+                    return {bounds.min, bounds.max};
+                }
+            }
+        }
+
         // Empty ranges not allowed
         auto temp = *first;
         minmax_result<T> result{temp, std::move(temp)};
@@ -11,6 +11,7 @@
 #define NANORANGE_ALGORITHM_MINMAX_ELEMENT_HPP_INCLUDED
 
 #include <nanorange/algorithm/minmax.hpp>
+#include <nanorange/detail/algorithm/minmax_value.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -21,6 +22,19 @@ private:
     template <typename I, typename S, typename Comp, typename Proj>
     static constexpr minmax_result<I> impl(I first, S last, Comp& comp, Proj& proj)
     {
+        if constexpr (minmax_vectorizable<I, S, Comp, Proj>) {
+            if (!detail::is_constant_evaluated() && first != last) {
+                using E = iter_value_t<I>;
+                const E* p = detail::to_address(first);
+                const auto found = detail::vector_minmax_element<true, true>(
+                    p, p + (last - first));
+                if (found.first) {
+                    return {first + (found.first - p),
+                            first + (found.second - p)};
+                }
+            }
+        }
+
         minmax_result<I> result{first, first};
 
         if (first == last || ++first == last) {
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MISMATCH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MISMATCH_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/bitwise_compare.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -46,14 +47,20 @@ private:
     static constexpr mismatch_result<I1, I2>
     impl3(I1 first1, S1 last1, I2 first2, Pred& pred, Proj1& proj1, Proj2& proj2)
     {
-        while (first1 != last1 &&
-               nano::invoke(pred, nano::invoke(proj1, *first1),
-                            nano::invoke(proj2, *first2))) {
-            ++first1;
-            ++first2;
+        if constexpr (sized_sentinel_for<S1, I1>) {
+            const auto n = last1 - first1;
+            return mismatch_fn::impl_n(std::move(first1), std::move(first2),
+                                       n, pred, proj1, proj2);
+        } else {
+            while (first1 != last1 &&
+                   nano::invoke(pred, nano::invoke(proj1, *first1),
+                                nano::invoke(proj2, *first2))) {
+                ++first1;
+                ++first2;
+            }
+
+            return {first1, first2};
         }
-
-        return {first1, first2};
     }
 
     template <typename I1, typename S1, typename I2, typename S2,
@@ -62,14 +69,56 @@ private:
     impl4(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
           Proj2& proj2)
     {
-        while (first1 != last1 && first2 != last2 &&
-               nano::invoke(pred, nano::invoke(proj1, *first1),
-                            nano::invoke(proj2, *first2))) {
+        if constexpr (sized_sentinel_for<S1, I1> && sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+            return mismatch_fn::impl_n(std::move(first1), std::move(first2),
+                                       n1 < n2 ? n1 : n2, pred, proj1, proj2);
+        } else {
+            while (first1 != last1 && first2 != last2 &&
+                   nano::invoke(pred, nano::invoke(proj1, *first1),
+                                nano::invoke(proj2, *first2))) {
+                ++first1;
+                ++first2;
+            }
+
+            return {first1, first2};
+        }
+    }
+
+    // Compares exactly n pairs of elements, using a vectorised search for
+    // the first difference where possible
+    template <typename I1, typename I2, typename Proj1, typename Proj2,
+              typename Pred>
+    static constexpr mismatch_result<I1, I2>
+    impl_n(I1 first1, I2 first2, iter_difference_t<I1> n, Pred& pred,
+           Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (is_equal_to_v<Pred> &&
+                      bitwise_comparable<I1, I2, Pred, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                if (n > 0) {
+                    const auto i = static_cast<iter_difference_t<I1>>(
+                        detail::mismatch_n(detail::to_address(first1),
+                                           detail::to_address(first2),
+                                           static_cast<std::size_t>(n)));
+                    first1 += i;
+                    first2 += static_cast<iter_difference_t<I2>>(i);
+                }
+                return {std::move(first1), std::move(first2)};
+            }
+        }
+
+        for (; n > 0; --n) {
+            if (!nano::invoke(pred, nano::invoke(proj1, *first1),
+                              nano::invoke(proj2, *first2))) {
+                break;
+            }
             ++first1;
             ++first2;
         }
 
-        return {first1, first2};
+        return {std::move(first1), std::move(first2)};
     }
 
 public:
@@ -24,6 +24,14 @@ private:
     {
         const auto dist = last - first;
 
+        if constexpr (memmove_movable<I, O>) {
+            if (!detail::is_constant_evaluated()) {
+                result = detail::memmove_n(first, dist, std::move(result));
+                first += dist;
+                return {std::move(first), std::move(result)};
+            }
+        }
+
         for (iter_difference_t<I> i{0}; i < dist; i++) {
             *result = nano::iter_move(first);
             ++first;
@@ -83,6 +91,15 @@ private:
     template <typename I, typename O>
     static constexpr move_backward_result<I, O> impl(I first, I last, O result)
     {
+        if constexpr (memmove_movable<I, O>) {
+            if (!detail::is_constant_evaluated()) {
+                result = detail::memmove_backward_n(std::move(first),
+                                                    last - first,
+                                                    std::move(result));
+                return {std::move(last), std::move(result)};
+            }
+        }
+
         auto it = last;
 
         while (it != first) {
@@ -37,6 +37,32 @@ struct none_of_fn {
         return !any_of_fn::impl(nano::begin(rng), nano::end(rng),
                                 pred, proj);
     }
+
+    template <typename EP, typename I, typename S, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            indirect_unary_predicate<Pred, projected<I, Proj>>,
+        bool>
+    operator()(EP&& policy, I first, S last, Pred pred,
+               Proj proj = Proj{}) const
+    {
+        return !nano::any_of(std::forward<EP>(policy), std::move(first),
+                             std::move(last), std::move(pred),
+                             std::move(proj));
+    }
+
+    template <typename EP, typename Rng, typename Proj = identity,
+              typename Pred>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            indirect_unary_predicate<Pred, projected<iterator_t<Rng>, Proj>>,
+        bool>
+    operator()(EP&& policy, Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return !nano::any_of(std::forward<EP>(policy), std::forward<Rng>(rng),
+                             std::move(pred), std::move(proj));
+    }
 };
 
 } // namespace detail
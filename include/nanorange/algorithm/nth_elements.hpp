@@ -0,0 +1,104 @@
+// nanorange/algorithm/nth_elements.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_NTH_ELEMENTS_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_NTH_ELEMENTS_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/introselect.hpp>
+
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: rearranges [first, last) so that each of the positions in nths
+// holds the element which would be there if the range were sorted, as if by
+// calling nth_element for each position in turn, and returns last.
+//
+// Calling nth_element k times costs O(kn). Instead we select the middle
+// position first, which splits both the range and the remaining positions in
+// two, and carry on in each half, which costs O(n log k).
+namespace detail {
+
+struct nth_elements_fn {
+private:
+    template <typename I, typename Comp, typename Proj>
+    static void impl(I first, I last, const I* nths, const I* nths_last,
+                     Comp& comp, Proj& proj)
+    {
+        while (nths != nths_last) {
+            const I* mid = nths + (nths_last - nths) / 2;
+            detail::introselect(first, *mid, last, comp, proj);
+            nth_elements_fn::impl(first, *mid, nths, mid, comp, proj);
+            if (*mid == last) {
+                return;
+            }
+
+            // Skip any repeats of the middle position
+            first = *mid;
+            while (mid != nths_last && *mid == first) {
+                ++mid;
+            }
+            nths = mid;
+            ++first;
+        }
+    }
+
+    template <typename I, typename Nths, typename Comp, typename Proj>
+    static void impl(I first, I last, Nths& nths, Comp& comp, Proj& proj)
+    {
+        std::vector<I> positions;
+        for (auto&& nth : nths) {
+            positions.push_back(nth);
+        }
+        auto less = ranges::less{};
+        auto id = identity{};
+        detail::pdqsort(positions.begin(), positions.end(), less, id);
+
+        nth_elements_fn::impl(std::move(first), std::move(last),
+                              positions.data(),
+                              positions.data() + positions.size(), comp,
+                              proj);
+    }
+
+public:
+    template <typename I, typename S, typename Nths,
+              typename Comp = ranges::less, typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         input_range<Nths> &&
+                         convertible_to<range_reference_t<Nths>, I> &&
+                         sortable<I, Comp, Proj>,
+                     I>
+    operator()(I first, S last, Nths&& nths, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const I ilast = nano::next(first, last);
+        nth_elements_fn::impl(std::move(first), ilast, nths, comp, proj);
+        return ilast;
+    }
+
+    template <typename Rng, typename Nths, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<random_access_range<Rng> && input_range<Nths> &&
+                         convertible_to<range_reference_t<Nths>,
+                                        iterator_t<Rng>> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Nths&& nths, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto last = nano::next(nano::begin(rng), nano::end(rng));
+        nth_elements_fn::impl(nano::begin(rng), last, nths, comp, proj);
+        return last;
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::nth_elements_fn, nth_elements)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -36,6 +36,31 @@ struct push_heap_fn {
         detail::sift_up_n(nano::begin(rng), n, comp, proj);
         return nano::begin(rng) + n;
     }
+
+    template <std::size_t D, typename I, typename S,
+              typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(heap_arity_t<D>, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        detail::sift_up_n<D>(first, n, comp, proj);
+        return first + n;
+    }
+
+    template <std::size_t D, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(heap_arity_t<D>, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(rng);
+        detail::sift_up_n<D>(nano::begin(rng), n, comp, proj);
+        return nano::begin(rng) + n;
+    }
 };
 
 } // namespace detail
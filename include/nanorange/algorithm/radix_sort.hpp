@@ -0,0 +1,65 @@
+// nanorange/algorithm/radix_sort.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+
+#include <nanorange/algorithm/stable_sort.hpp>
+#include <nanorange/detail/algorithm/radix_sort.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: sorts a range by an arithmetic key, using ranges::less or
+// ranges::greater (or their std:: equivalents), in linear time. The sort is
+// stable. This needs a scratch buffer the size of the range; if that cannot
+// be allocated, it falls back to stable_sort().
+namespace detail {
+
+struct radix_sort_fn {
+private:
+    template <typename I, typename Comp, typename Proj>
+    static void impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        if (!detail::radix_sort(first, last - first, comp, proj)) {
+            nano::stable_sort(std::move(first), std::move(last),
+                              std::ref(comp), std::ref(proj));
+        }
+    }
+
+public:
+    template <typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                         sortable<I, Comp, Proj> &&
+                         radix_sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, last);
+        radix_sort_fn::impl(std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj> &&
+                         radix_sortable<iterator_t<Rng>, Comp, Proj>,
+                     safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        radix_sort_fn::impl(nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::radix_sort_fn, radix_sort)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -26,6 +27,27 @@ private:
             return first;
         }
 
+        if constexpr (compactable_in_place<I, S>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto n = last - first;
+                if constexpr (value_search_vectorizable<I, S, T, Proj>) {
+                    // find() has found an element equal to value, so it is
+                    // unchanged by conversion to the element type
+                    const auto end = detail::remove_value_in_place(
+                        p + 1, p + n, p, static_cast<iter_value_t<I>>(value));
+                    return first + (end - p);
+                } else {
+                    const auto keep = [&value, &proj](auto& e) {
+                        return !(nano::invoke(proj, e) == value);
+                    };
+                    const auto end =
+                        detail::compact_in_place(p + 1, p + n, p, keep);
+                    return first + (end - p);
+                }
+            }
+        }
+
         for (auto i = next(first); i != last; ++i) {
             if (!(nano::invoke(proj, *i) == value)) {
                 *first = nano::iter_move(i);
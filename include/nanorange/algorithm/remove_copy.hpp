@@ -9,6 +9,7 @@
 
 #include <nanorange/algorithm/copy.hpp>
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -23,6 +24,19 @@ private:
     static constexpr remove_copy_result<I, O>
     impl(I first, S last, O result, const T& value, Proj& proj)
     {
+        if constexpr (compactable_copy<I, S, O>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto n = last - first;
+                const auto keep = [&value, &proj](auto& e) {
+                    return !(nano::invoke(proj, e) == value);
+                };
+                const auto out = detail::to_address(result);
+                const auto end = detail::compact_copy(p, p + n, out, keep);
+                return {first + n, result + (end - out)};
+            }
+        }
+
         while (first != last) {
             auto&& ref = *first;
             if (!(nano::invoke(proj, ref) == value)) {
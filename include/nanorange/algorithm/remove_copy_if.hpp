@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_REMOVE_COPY_IF_HPP_INCLUDED
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -22,6 +23,19 @@ private:
     static constexpr remove_copy_if_result<I, O>
     impl(I first, S last, O result, Pred& pred, Proj& proj)
     {
+        if constexpr (compactable_copy<I, S, O>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto n = last - first;
+                const auto keep = [&pred, &proj](auto& e) {
+                    return !nano::invoke(pred, nano::invoke(proj, e));
+                };
+                const auto out = detail::to_address(result);
+                const auto end = detail::compact_copy(p, p + n, out, keep);
+                return {first + n, result + (end - out)};
+            }
+        }
+
         while (first != last) {
             auto&& ref = *first;
             if (!nano::invoke(pred, nano::invoke(proj, ref))) {
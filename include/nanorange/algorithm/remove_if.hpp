@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -26,6 +27,18 @@ private:
             return first;
         }
 
+        if constexpr (compactable_in_place<I, S>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto p = detail::to_address(first);
+                const auto keep = [&pred, &proj](auto& e) {
+                    return !nano::invoke(pred, nano::invoke(proj, e));
+                };
+                const auto end = detail::compact_in_place(
+                    p + 1, p + (last - first), p, keep);
+                return first + (end - p);
+            }
+        }
+
         for (auto i = next(first); i != last; ++i) {
             if (!nano::invoke(pred, nano::invoke(proj, *i))) {
                 *first = nano::iter_move(i);
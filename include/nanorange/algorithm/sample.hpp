@@ -0,0 +1,166 @@
+// nanorange/algorithm/sample.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_SAMPLE_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_SAMPLE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/bounded_random.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <cmath>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct sample_fn {
+private:
+    // When we know how many elements there are, we use selection sampling
+    // (Knuth, TAOCP vol. 2, 3.4.2, Algorithm S): we choose each element in
+    // turn with probability (elements still wanted) / (elements left), which
+    // gives a sample in the same order as the input, and needs only one pass
+    template <typename I, typename O, typename Gen>
+    static O impl_selection(I first, iter_difference_t<I> size, O out,
+                            iter_difference_t<I> n, Gen& g)
+    {
+        auto left = static_cast<std::uint64_t>(size);
+        auto wanted = static_cast<std::uint64_t>(n < size ? n : size);
+
+        // Take the decisions for two elements from one random word while
+        // we can
+        while (wanted > 0 && left >= 2 &&
+               left <= detail::bounded_random_pair_limit) {
+            const auto rs = detail::bounded_random_pair(left, left - 1, g);
+            if (rs.first < wanted) {
+                *out = *first;
+                ++out;
+                --wanted;
+            }
+            ++first;
+            if (rs.second < wanted) {
+                *out = *first;
+                ++out;
+                --wanted;
+            }
+            ++first;
+            left -= 2;
+        }
+
+        for (; wanted > 0; --left) {
+            if (detail::bounded_random(left, g) < wanted) {
+                *out = *first;
+                ++out;
+                --wanted;
+            }
+            ++first;
+        }
+
+        return out;
+    }
+
+    // Otherwise, we keep a reservoir of the first n elements, and replace a
+    // random one of them with each later element with probability
+    // n / (elements seen). Rather than draw a random number for each
+    // element, we draw how many elements to skip before the next
+    // replacement from the right distribution (Li, "Reservoir-sampling
+    // algorithms of time complexity O(n(1 + log(N/n)))", ACM TOMS 20(4),
+    // 1994, Algorithm L).
+    template <typename I, typename S, typename O, typename Gen>
+    static O impl_reservoir(I first, S last, O out, iter_difference_t<I> n,
+                            Gen& g)
+    {
+        iter_difference_t<O> k = 0;
+        for (; k < n && first != last; ++first, ++k) {
+            out[k] = *first;
+        }
+        if (first == last) {
+            return out + k;
+        }
+
+        // A uniform random number in (0, 1]
+        const auto uniform = [&g] {
+            return 1.0 - std::generate_canonical<
+                             double, std::numeric_limits<double>::digits>(g);
+        };
+        const double max_skip = std::ldexp(1.0, 63);
+
+        double w = std::exp(std::log(uniform()) / static_cast<double>(n));
+        while (true) {
+            const double skip =
+                std::floor(std::log(uniform()) / std::log1p(-w));
+            auto s = skip < max_skip ? static_cast<std::uint64_t>(skip)
+                                     : std::numeric_limits<std::uint64_t>::max();
+            for (; s > 0 && first != last; --s) {
+                ++first;
+            }
+            if (first == last) {
+                break;
+            }
+
+            out[static_cast<iter_difference_t<O>>(
+                detail::bounded_random(static_cast<std::uint64_t>(n), g))] =
+                *first;
+            ++first;
+            w *= std::exp(std::log(uniform()) / static_cast<double>(n));
+        }
+
+        return out + k;
+    }
+
+    template <typename I, typename S, typename O, typename Gen>
+    static O impl(I first, S last, O out, iter_difference_t<I> n, Gen& g)
+    {
+        if (n <= 0) {
+            return out;
+        }
+
+        if constexpr (forward_iterator<I> || sized_sentinel_for<S, I>) {
+            const auto size = nano::distance(first, last);
+            return sample_fn::impl_selection(std::move(first), size,
+                                             std::move(out), n, g);
+        } else {
+            return sample_fn::impl_reservoir(std::move(first),
+                                             std::move(last), std::move(out),
+                                             n, g);
+        }
+    }
+
+public:
+    template <typename I, typename S, typename O, typename Gen>
+    std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            (forward_iterator<I> || random_access_iterator<O>) &&
+            indirectly_copyable<I, O> &&
+            uniform_random_bit_generator<std::remove_reference_t<Gen>>,
+        O>
+    operator()(I first, S last, O out, iter_difference_t<I> n,
+               Gen&& gen) const
+    {
+        return sample_fn::impl(std::move(first), std::move(last),
+                               std::move(out), n, gen);
+    }
+
+    template <typename Rng, typename O, typename Gen>
+    std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            (forward_range<Rng> || random_access_iterator<O>) &&
+            indirectly_copyable<iterator_t<Rng>, O> &&
+            uniform_random_bit_generator<std::remove_reference_t<Gen>>,
+        O>
+    operator()(Rng&& rng, O out, range_difference_t<Rng> n, Gen&& gen) const
+    {
+        return sample_fn::impl(nano::begin(rng), nano::end(rng),
+                               std::move(out), n, gen);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::sample_fn, sample)
+
+NANO_END_NAMESPACE
+
+#endif
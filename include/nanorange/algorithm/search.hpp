@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/substring_search.hpp>
 #include <nanorange/ranges.hpp>
 #include <nanorange/views/subrange.hpp>
 
@@ -14,6 +15,22 @@ NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
+// Runs a substring_searcher over a contiguous haystack of size n, which must be
+// at least the size of the needle
+template <typename I, typename E>
+subrange<I> run_substring_searcher(I first, iter_difference_t<I> n,
+                                   const substring_searcher<E>& searcher)
+{
+    const auto pos = static_cast<iter_difference_t<I>>(searcher.search(
+        detail::to_address(first), static_cast<std::size_t>(n)));
+    if (pos == n) {
+        first += n;
+        return {first, first};
+    }
+    first += pos;
+    return {first, first + static_cast<iter_difference_t<I>>(searcher.size())};
+}
+
 struct search_fn {
 private:
     friend struct find_end_fn;
@@ -24,6 +41,20 @@ private:
     impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
          Proj2& proj2)
     {
+        // For contiguous ranges of integers, preprocess the needle and use
+        // whichever substring search algorithm suits it best
+        if constexpr (substring_searchable<I1, S1, I2, S2, Pred, Proj1, Proj2>) {
+            if (!detail::is_constant_evaluated()) {
+                const auto n = last1 - first1;
+                const auto m = last2 - first2;
+                if (m > 0 && n >= m) {
+                    const substring_searcher<iter_value_t<I1>> searcher(
+                        detail::to_address(first2), static_cast<std::size_t>(m));
+                    return detail::run_substring_searcher(std::move(first1), n, searcher);
+                }
+            }
+        }
+
         while (true) {
             auto it1 = first1;
             auto it2 = first2;
@@ -82,6 +113,109 @@ public:
 
 NANO_INLINE_VAR(detail::search_fn, search)
 
+// A reusable search for a particular needle. Any preprocessing of the needle
+// happens once, on construction, after which the searcher may be applied to
+// any number of haystacks:
+//
+//     const nano::searcher s(needle);
+//     for (const auto& line : lines) {
+//         if (!s(line).empty()) { ... }
+//     }
+//
+// The searcher refers to the needle, which must outlive it.
+template <typename I, typename S = I, typename Pred = ranges::equal_to>
+class searcher {
+    static_assert(forward_iterator<I> && sentinel_for<S, I>);
+    static_assert(std::is_object_v<Pred>);
+
+    static constexpr bool preprocessed =
+        detail::substring_searchable<I, S, I, S, Pred, identity, identity>;
+
+    template <typename T, bool = preprocessed>
+    struct state_type_helper {
+        using type = detail::substring_searcher<T>;
+    };
+
+    template <typename T>
+    struct state_type_helper<T, false> {
+        struct type {};
+    };
+
+    using state_type = typename state_type_helper<iter_value_t<I>>::type;
+
+public:
+    constexpr searcher(I first, S last, Pred pred = Pred{})
+        : first_(std::move(first)), last_(std::move(last)),
+          pred_(std::move(pred))
+    {
+        if constexpr (preprocessed) {
+            if (!detail::is_constant_evaluated()) {
+                const auto m = last_ - first_;
+                if (m > 0) {
+                    state_ = state_type(detail::to_address(first_),
+                                        static_cast<std::size_t>(m));
+                }
+            }
+        }
+    }
+
+    template <typename Rng,
+              std::enable_if_t<forward_range<Rng> &&
+                               same_as<iterator_t<Rng>, I> &&
+                               same_as<sentinel_t<Rng>, S>, int> = 0>
+    constexpr explicit searcher(Rng&& rng, Pred pred = Pred{})
+        : searcher(nano::begin(rng), nano::end(rng), std::move(pred))
+    {}
+
+    template <typename I1, typename S1>
+    constexpr std::enable_if_t<
+        forward_iterator<I1> && sentinel_for<S1, I1> &&
+            indirectly_comparable<I1, I, Pred>,
+        subrange<I1>>
+    operator()(I1 first, S1 last) const
+    {
+        if constexpr (detail::substring_searchable<I1, S1, I, S, Pred,
+                                                   identity, identity>) {
+            if (!detail::is_constant_evaluated() && state_.ready()) {
+                const auto n = last - first;
+                if (n < static_cast<iter_difference_t<I1>>(state_.size())) {
+                    first += n;
+                    return {first, first};
+                }
+                return detail::run_substring_searcher(std::move(first), n,
+                                                      state_);
+            }
+        }
+
+        return nano::search(std::move(first), std::move(last), first_, last_,
+                            pred_);
+    }
+
+    template <typename Rng>
+    constexpr std::enable_if_t<
+        forward_range<Rng> &&
+            indirectly_comparable<iterator_t<Rng>, I, Pred>,
+        safe_subrange_t<Rng>>
+    operator()(Rng&& rng) const
+    {
+        return (*this)(nano::begin(rng), nano::end(rng));
+    }
+
+private:
+    I first_;
+    S last_;
+    Pred pred_;
+    state_type state_{};
+};
+
+template <typename I, typename S, typename Pred = ranges::equal_to,
+          std::enable_if_t<forward_iterator<I> && sentinel_for<S, I>, int> = 0>
+searcher(I, S, Pred = Pred{}) -> searcher<I, S, Pred>;
+
+template <typename R, typename Pred = ranges::equal_to,
+          std::enable_if_t<forward_range<R> && detail::forwarding_range<R>, int> = 0>
+searcher(R&&, Pred = Pred{}) -> searcher<iterator_t<R>, sentinel_t<R>, Pred>;
+
 NANO_END_NAMESPACE
 
 #endif
\ No newline at end of file
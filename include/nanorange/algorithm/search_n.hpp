@@ -22,10 +22,54 @@ private:
     impl(I first, S last, iter_difference_t<I> count, const T& value, Pred pred,
          Proj& proj)
     {
-        if (count == iter_difference_t<I>{0}) {
+        if (count <= iter_difference_t<I>{0}) {
             return {first, first};
         }
 
+        if constexpr (random_access_iterator<I> && sized_sentinel_for<S, I>) {
+            return search_n_fn::impl_sized(first, last - first, count, value,
+                                           pred, proj);
+        } else {
+            return search_n_fn::impl_unsized(std::move(first), std::move(last),
+                                             count, value, pred, proj);
+        }
+    }
+
+    // With random access, we can test the last element of each candidate
+    // window first: if it doesn't match, then no match can begin at or
+    // before it, so we can skip ahead by up to count elements at a time.
+    template <typename I, typename T, typename Pred, typename Proj>
+    static constexpr subrange<I>
+    impl_sized(I first, iter_difference_t<I> n, iter_difference_t<I> count,
+               const T& value, Pred& pred, Proj& proj)
+    {
+        const I last = first + n;
+        // Number of elements at the start of the window already known to
+        // match
+        iter_difference_t<I> known = 0;
+
+        while (last - first >= count) {
+            iter_difference_t<I> i = count - 1;
+            while (i >= known &&
+                   nano::invoke(pred, nano::invoke(proj, first[i]), value)) {
+                --i;
+            }
+            if (i < known) {
+                return {first, first + count};
+            }
+            // Everything after the mismatch is a match
+            known = count - 1 - i;
+            first += i + 1;
+        }
+
+        return {last, last};
+    }
+
+    template <typename I, typename S, typename T, typename Pred, typename Proj>
+    static constexpr subrange<I>
+    impl_unsized(I first, S last, iter_difference_t<I> count, const T& value,
+                 Pred& pred, Proj& proj)
+    {
         for (; first != last; ++first) {
             if (!nano::invoke(pred, nano::invoke(proj, *first), value)) {
                 continue;
@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/set_gallop.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -20,12 +21,14 @@ namespace detail {
 
 struct set_difference_fn {
 private:
-    template <typename I1, typename S1, typename I2, typename S2, typename O,
-              typename Comp, typename Proj1, typename Proj2>
+    template <bool Gallop, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename Comp, typename Proj1, typename Proj2>
     static constexpr set_difference_result<I1, O>
-    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result,
-         Comp& comp, Proj1& proj1, Proj2& proj2)
+    impl_loop(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+              Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        set_gallop_counter gallop;
+
         while (first1 != last1) {
             if (first2 == last2) {
                 // We've reached the end of range2, so copy all the remaining
@@ -45,14 +48,41 @@ private:
                 *result = *first1;
                 ++first1;
                 ++result;
-            } else{
+
+                // Copy any more elements of r1 which are less than the
+                // current element of r2 at once
+                if constexpr (Gallop && set_can_gallop<I1, S1>) {
+                    if (gallop.step1() && first1 != last1) {
+                        const auto n = detail::set_gallop(
+                            first1, last1, nano::invoke(proj2, *first2), comp,
+                            proj1);
+                        result = nano::copy(first1, first1 + n,
+                                            std::move(result)).out;
+                        first1 += n;
+                        gallop.galloped(n);
+                    }
+                }
+            } else if (!nano::invoke(comp, nano::invoke(proj2, *first2),
+                                     nano::invoke(proj1, *first1))) {
                 // We now know that !(r1 < r2). If !(r2 < r1) as well, then
                 // elements are equal and we can skip
-                if (!nano::invoke(comp, nano::invoke(proj2, *first2),
-                                  nano::invoke(proj1, *first1))) {
-                    ++first1;
-                }
+                ++first1;
                 ++first2;
+                gallop.step_both();
+            } else {
+                ++first2;
+
+                // Skip any more elements of r2 which are less than the
+                // current element of r1 at once
+                if constexpr (Gallop && set_can_gallop<I2, S2>) {
+                    if (gallop.step2() && first2 != last2) {
+                        const auto n = detail::set_gallop(
+                            first2, last2, nano::invoke(proj1, *first1), comp,
+                            proj2);
+                        first2 += n;
+                        gallop.galloped(n);
+                    }
+                }
             }
         }
 
@@ -60,6 +90,24 @@ private:
     }
 
 
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr set_difference_result<I1, O>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+         Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (set_can_gallop<I1, S1> || set_can_gallop<I2, S2>) {
+            if (detail::set_should_gallop(first1, last1, first2, last2)) {
+                return set_difference_fn::impl_loop<true>(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), std::move(result), comp, proj1, proj2);
+            }
+        }
+        return set_difference_fn::impl_loop<false>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(result), comp, proj1, proj2);
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = ranges::less, typename Proj1 = identity,
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/set_gallop.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -15,30 +16,73 @@ namespace detail {
 
 struct set_intersection_fn {
 private:
-    template <typename I1, typename S1, typename I2, typename S2, typename O,
-              typename Comp, typename Proj1, typename Proj2>
-    static constexpr O impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                            O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+    template <bool Gallop, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename Comp, typename Proj1, typename Proj2>
+    static constexpr O impl_loop(I1 first1, S1 last1, I2 first2, S2 last2,
+                                 O result, Comp& comp, Proj1& proj1, Proj2& proj2)
     {
+        set_gallop_counter gallop;
+
         while (first1 != last1 && first2 != last2)
         {
             if (nano::invoke(comp, nano::invoke(proj1, *first1),
                              nano::invoke(proj2, *first2))) {
                 ++first1;
-            } else {
-                if (!nano::invoke(comp, nano::invoke(proj2, *first2),
-                                 nano::invoke(proj1, *first1))) {
-                    *result = *first1;
-                    ++result;
-                    ++first1;
+
+                // Skip any more elements of r1 which are less than the
+                // current element of r2 at once
+                if constexpr (Gallop && set_can_gallop<I1, S1>) {
+                    if (gallop.step1() && first1 != last1) {
+                        const auto n = detail::set_gallop(
+                            first1, last1, nano::invoke(proj2, *first2), comp,
+                            proj1);
+                        first1 += n;
+                        gallop.galloped(n);
+                    }
                 }
+            } else if (!nano::invoke(comp, nano::invoke(proj2, *first2),
+                                     nano::invoke(proj1, *first1))) {
+                *result = *first1;
+                ++result;
+                ++first1;
+                ++first2;
+                gallop.step_both();
+            } else {
                 ++first2;
+
+                if constexpr (Gallop && set_can_gallop<I2, S2>) {
+                    if (gallop.step2() && first2 != last2) {
+                        const auto n = detail::set_gallop(
+                            first2, last2, nano::invoke(proj1, *first1), comp,
+                            proj2);
+                        first2 += n;
+                        gallop.galloped(n);
+                    }
+                }
             }
         }
 
         return result;
     }
 
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr O
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+         Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (set_can_gallop<I1, S1> || set_can_gallop<I2, S2>) {
+            if (detail::set_should_gallop(first1, last1, first2, last2)) {
+                return set_intersection_fn::impl_loop<true>(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), std::move(result), comp, proj1, proj2);
+            }
+        }
+        return set_intersection_fn::impl_loop<false>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(result), comp, proj1, proj2);
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = ranges::less, typename Proj1 = identity,
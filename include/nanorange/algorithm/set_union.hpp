@@ -9,6 +9,7 @@
 
 #include <nanorange/algorithm/copy.hpp>
 #include <nanorange/algorithm/transform.hpp>
+#include <nanorange/detail/algorithm/set_gallop.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -19,12 +20,14 @@ namespace detail {
 
 struct set_union_fn {
 private:
-    template <typename I1, typename S1, typename I2, typename S2, typename O,
-              typename Comp, typename Proj1, typename Proj2>
+    template <bool Gallop, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename Comp, typename Proj1, typename Proj2>
     static constexpr set_union_result<I1, I2, O>
-    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
-         Proj1& proj1, Proj2& proj2)
+    impl_loop(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
+              Proj1& proj1, Proj2& proj2)
     {
+        set_gallop_counter gallop;
+
         while (first1 != last1) {
             // If we've reached the end of the second range, copy any remaining
             // elements from the first range and quit
@@ -44,17 +47,48 @@ private:
                              nano::invoke(proj2, *first2))) {
                 *result = *first1;
                 ++first1;
-            } else {
+                ++result;
+
+                // Copy any more elements of r1 which are less than the
+                // current element of r2 at once
+                if constexpr (Gallop && set_can_gallop<I1, S1>) {
+                    if (gallop.step1() && first1 != last1) {
+                        const auto n = detail::set_gallop(
+                            first1, last1, nano::invoke(proj2, *first2), comp,
+                            proj1);
+                        result = nano::copy(first1, first1 + n,
+                                            std::move(result)).out;
+                        first1 += n;
+                        gallop.galloped(n);
+                    }
+                }
+            } else if (!nano::invoke(comp, nano::invoke(proj2, *first2),
+                                     nano::invoke(proj1, *first1))) {
                 // Now, we know that !(r1 < r2). If we also have !(r2 < r1) then
                 // the elements compare equal, so skip it
-                if (!nano::invoke(comp, nano::invoke(proj2, *first2),
-                                  nano::invoke(proj1, *first1))) {
-                    ++first1;
-                }
+                ++first1;
+                *result = *first2;
+                ++first2;
+                ++result;
+                gallop.step_both();
+            } else {
                 *result = *first2;
                 ++first2;
+                ++result;
+
+                // Likewise for r2
+                if constexpr (Gallop && set_can_gallop<I2, S2>) {
+                    if (gallop.step2() && first2 != last2) {
+                        const auto n = detail::set_gallop(
+                            first2, last2, nano::invoke(proj1, *first1), comp,
+                            proj2);
+                        result = nano::copy(first2, first2 + n,
+                                            std::move(result)).out;
+                        first2 += n;
+                        gallop.galloped(n);
+                    }
+                }
             }
-            ++result;
         }
 
         // We've run out of elements of range1, so copy all the remaining
@@ -67,6 +101,24 @@ private:
                 std::move(copy_res.out)};
     }
 
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr set_union_result<I1, I2, O>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+         Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (set_can_gallop<I1, S1> || set_can_gallop<I2, S2>) {
+            if (detail::set_should_gallop(first1, last1, first2, last2)) {
+                return set_union_fn::impl_loop<true>(
+                    std::move(first1), std::move(last1), std::move(first2),
+                    std::move(last2), std::move(result), comp, proj1, proj2);
+            }
+        }
+        return set_union_fn::impl_loop<false>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(result), comp, proj1, proj2);
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = ranges::less, typename Proj1 = identity,
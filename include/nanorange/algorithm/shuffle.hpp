@@ -7,10 +7,8 @@
 #ifndef NANORANGE_ALGORITHM_SHUFFLE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SHUFFLE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/bounded_random.hpp>
 #include <nanorange/ranges.hpp>
-#include <nanorange/random.hpp>
-
-#include <random>
 
 NANO_BEGIN_NAMESPACE
 
@@ -22,14 +20,27 @@ private:
     static constexpr I impl(I first, S last, Gen&& g)
     {
         using diff_t = iter_difference_t<I>;
-        using distr_t = std::uniform_int_distribution<diff_t>;
-        using param_t = typename distr_t::param_type;
 
-        distr_t D;
         const auto n = last - first; // OK, we have SizedSentinel
+        diff_t i = 1;
+
+        // While we can, we take the positions for two elements from one
+        // random word
+        for (; i + 1 < n && static_cast<std::uint64_t>(i) + 2 <=
+                                detail::bounded_random_pair_limit;
+             i += 2) {
+            const auto js = detail::bounded_random_pair(
+                static_cast<std::uint64_t>(i) + 1,
+                static_cast<std::uint64_t>(i) + 2, g);
+            nano::iter_swap(first + i, first + static_cast<diff_t>(js.first));
+            nano::iter_swap(first + (i + 1),
+                            first + static_cast<diff_t>(js.second));
+        }
 
-        for (diff_t i = 0; i < n; i++) {
-            nano::iter_swap(first + i, first + D(g, param_t(0, i)));
+        for (; i < n; i++) {
+            const auto j =
+                detail::bounded_random(static_cast<std::uint64_t>(i) + 1, g);
+            nano::iter_swap(first + i, first + static_cast<diff_t>(j));
         }
 
         return next(first, last);
@@ -7,20 +7,67 @@
 #ifndef NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/natural_runs.hpp>
+#include <nanorange/detail/algorithm/parallel_sort.hpp>
 #include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/algorithm/radix_sort.hpp>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
 struct sort_fn {
+private:
+    // Below this size, pdqsort beats radix sort even for arithmetic keys
+    static constexpr int radix_sort_threshold = 2048;
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr void impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        // Nearly sorted input is cheaper to merge from its natural runs
+        if (!detail::is_constant_evaluated() &&
+            last - first >= natural_runs_threshold &&
+            detail::natural_runs_sort(first, last, comp, proj)) {
+            return;
+        }
+
+        // Large ranges of small elements with arithmetic keys are much
+        // faster to radix sort
+        if constexpr (radix_sortable<I, Comp, Proj>) {
+            if constexpr (radix_sort_is_direct<I, Proj>) {
+                if (!detail::is_constant_evaluated() &&
+                    last - first >= radix_sort_threshold &&
+                    detail::radix_sort(first, last - first, comp, proj)) {
+                    return;
+                }
+            }
+        }
+
+        detail::pdqsort(std::move(first), std::move(last), comp, proj);
+    }
+
+    template <typename EP, typename I, typename Comp, typename Proj>
+    static void par_impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        if constexpr (is_parallel_policy_v<EP>) {
+            const auto sort_piece = [&](I b, I e) {
+                sort_fn::impl(std::move(b), std::move(e), comp, proj);
+            };
+            detail::parallel_sort(std::move(first), std::move(last), comp,
+                                  proj, sort_piece);
+        } else {
+            sort_fn::impl(std::move(first), std::move(last), comp, proj);
+        }
+    }
+
+public:
     template <typename I, typename S, typename Comp = ranges::less, typename Proj = identity>
     constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
                                    sortable<I, Comp, Proj>, I>
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         I last_it = nano::next(first, last);
-        detail::pdqsort(std::move(first), last_it, comp, proj);
+        sort_fn::impl(std::move(first), last_it, comp, proj);
         return last_it;
     }
 
@@ -31,7 +78,32 @@ struct sort_fn {
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
-        detail::pdqsort(nano::begin(rng), last_it, comp, proj);
+        sort_fn::impl(nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename EP, typename I, typename S, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_iterator<I> &&
+                         sentinel_for<S, I> && sortable<I, Comp, Proj>,
+                     I>
+    operator()(EP&&, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, last);
+        sort_fn::par_impl<EP>(std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename EP, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    std::enable_if_t<execution_policy<EP> && random_access_range<Rng> &&
+                         sortable<iterator_t<Rng>, Comp, Proj>,
+                     safe_iterator_t<Rng>>
+    operator()(EP&&, Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        sort_fn::par_impl<EP>(nano::begin(rng), last_it, comp, proj);
         return last_it;
     }
 };
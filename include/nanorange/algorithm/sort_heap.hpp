@@ -15,7 +15,7 @@ namespace detail {
 
 struct sort_heap_fn {
 private:
-    template <typename I, typename Comp, typename Proj>
+    template <std::size_t D, typename I, typename Comp, typename Proj>
     static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
                             Proj& proj)
     {
@@ -24,7 +24,7 @@ private:
         }
 
         for (auto i = n; i > 1; --i) {
-            pop_heap_fn::impl(first, i, comp, proj);
+            pop_heap_fn::impl<D>(first, i, comp, proj);
         }
 
         return first + n;
@@ -38,7 +38,7 @@ public:
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         const auto n = nano::distance(first, last);
-        return sort_heap_fn::impl(std::move(first), n, comp, proj);
+        return sort_heap_fn::impl<2>(std::move(first), n, comp, proj);
     }
 
     template <typename Rng, typename Comp = ranges::less, typename Proj = identity>
@@ -47,8 +47,31 @@ public:
                                safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return sort_heap_fn::impl(nano::begin(rng), nano::distance(rng), comp,
-                                  proj);
+        return sort_heap_fn::impl<2>(nano::begin(rng), nano::distance(rng),
+                                     comp, proj);
+    }
+
+    template <std::size_t D, typename I, typename S,
+              typename Comp = ranges::less, typename Proj = identity>
+    constexpr std::enable_if_t<random_access_iterator<I> && sentinel_for<S, I> &&
+                                   sortable<I, Comp, Proj>, I>
+    operator()(heap_arity_t<D>, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return sort_heap_fn::impl<D>(std::move(first), n, comp, proj);
+    }
+
+    template <std::size_t D, typename Rng, typename Comp = ranges::less,
+              typename Proj = identity>
+    constexpr std::enable_if_t<random_access_range<Rng> &&
+                                   sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(heap_arity_t<D>, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return sort_heap_fn::impl<D>(nano::begin(rng), nano::distance(rng),
+                                     comp, proj);
     }
 };
 
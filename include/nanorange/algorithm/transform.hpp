@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_TRANSFORM_HPP_INCLUDED
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -91,6 +92,48 @@ private:
         return {std::move(first1), std::move(first2), std::move(result)};
     }
 
+    template <typename EP, typename I, typename S, typename O, typename F,
+              typename Proj>
+    static unary_transform_result<I, O>
+    par_unary_impl(I first, S last, O result, F& op, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S> && random_access_iterator<O>) {
+            const auto n = last - first;
+            detail::parallel_for(n, [&](auto b, auto e) {
+                transform_fn::unary_impl(first + b, first + e, result + b, op,
+                                         proj);
+            });
+            return {first + n, result + n};
+        } else {
+            return transform_fn::unary_impl(std::move(first), std::move(last),
+                                            std::move(result), op, proj);
+        }
+    }
+
+    template <typename EP, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename F, typename Proj1, typename Proj2>
+    static binary_transform_result<I1, I2, O>
+    par_binary_impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, F& op,
+                    Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (parallelizable<EP, I1, S1> &&
+                      parallelizable<EP, I2, S2> &&
+                      random_access_iterator<O>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            const auto n = n1 < n2 ? n1 : n2;
+            detail::parallel_for(n, [&](auto b, auto e) {
+                transform_fn::binary_impl3(first1 + b, first1 + e, first2 + b,
+                                           result + b, op, proj1, proj2);
+            });
+            return {first1 + n, first2 + n, result + n};
+        } else {
+            return transform_fn::binary_impl4(
+                std::move(first1), std::move(last1), std::move(first2),
+                std::move(last2), std::move(result), op, proj1, proj2);
+        }
+    }
+
 public:
     // Unary op, iterators
     template <typename I, typename S, typename O, typename F,
@@ -192,6 +235,74 @@ public:
                                           std::forward<I2>(first2), std::move(result),
                                           op, proj1, proj2);
     }
+
+    // Unary op, iterators, with an execution policy
+    template <typename EP, typename I, typename S, typename O, typename F,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            forward_iterator<O> && copy_constructible<F> &&
+            writable<O, indirect_result_t<F&, projected<I, Proj>>>,
+        unary_transform_result<I, O>>
+    operator()(EP&&, I first, S last, O result, F op, Proj proj = Proj{}) const
+    {
+        return transform_fn::par_unary_impl<EP>(std::move(first),
+                                                std::move(last),
+                                                std::move(result), op, proj);
+    }
+
+    // Unary op, range, with an execution policy
+    template <typename EP, typename Rng, typename O, typename F,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> && forward_iterator<O> &&
+            copy_constructible<F> &&
+            writable<O,
+                     indirect_result_t<F&, projected<iterator_t<Rng>, Proj>>>,
+        unary_transform_result<safe_iterator_t<Rng>, O>>
+    operator()(EP&&, Rng&& rng, O result, F op, Proj proj = Proj{}) const
+    {
+        return transform_fn::par_unary_impl<EP>(nano::begin(rng),
+                                                nano::end(rng),
+                                                std::move(result), op, proj);
+    }
+
+    // Binary op, four-legged, with an execution policy
+    template <typename EP, typename I1, typename S1, typename I2, typename S2,
+              typename O, typename F, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I1> && sentinel_for<S1, I1> &&
+            forward_iterator<I2> && sentinel_for<S2, I2> &&
+            forward_iterator<O> && copy_constructible<F> &&
+            writable<O, indirect_result_t<F&, projected<I1, Proj1>,
+                                          projected<I2, Proj2>>>,
+        binary_transform_result<I1, I2, O>>
+    operator()(EP&&, I1 first1, S1 last1, I2 first2, S2 last2, O result, F op,
+               Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        return transform_fn::par_binary_impl<EP>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(result), op, proj1, proj2);
+    }
+
+    // Binary op, two ranges, with an execution policy
+    template <typename EP, typename Rng1, typename Rng2, typename O,
+              typename F, typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng1> && forward_range<Rng2> &&
+            forward_iterator<O> && copy_constructible<F> &&
+            writable<O,
+                     indirect_result_t<F&, projected<iterator_t<Rng1>, Proj1>,
+                                       projected<iterator_t<Rng2>, Proj2>>>,
+        binary_transform_result<safe_iterator_t<Rng1>, safe_iterator_t<Rng2>, O>>
+    operator()(EP&&, Rng1&& rng1, Rng2&& rng2, O result, F op,
+               Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        return transform_fn::par_binary_impl<EP>(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), std::move(result), op, proj1, proj2);
+    }
 };
 
 } // namespace detail
@@ -10,6 +10,8 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/adjacent_find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
+#include <nanorange/detail/functional/comparisons.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -26,6 +28,30 @@ private:
             return first;
         }
 
+        // first and next(first) are equal, so we keep the first of them and
+        // start from the element after
+        if constexpr (compactable_in_place<I, S>) {
+            if (!detail::is_constant_evaluated()) {
+                using E = iter_value_t<I>;
+                const auto p = detail::to_address(first);
+                const auto n = last - first;
+                if constexpr (is_equal_to_v<R> && same_as<Proj, identity> &&
+                              simd::vectorizable_integral<E>) {
+                    const auto end =
+                        detail::unique_values_in_place(p + 2, p + n, p + 1);
+                    return first + (end - p);
+                } else {
+                    const auto same = [&comp, &proj](auto& a, auto& b) {
+                        return nano::invoke(comp, nano::invoke(proj, a),
+                                            nano::invoke(proj, b));
+                    };
+                    const auto end =
+                        detail::unique_in_place(p + 2, p + n, p + 1, same);
+                    return first + (end - p);
+                }
+            }
+        }
+
         for (I n = next(first, 2, last); n != last; ++n) {
             if (!nano::invoke(comp, nano::invoke(proj, *first),
                               nano::invoke(proj, *n))) {
@@ -0,0 +1,114 @@
+// nanorange/detail/algorithm/bitwise_compare.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_BITWISE_COMPARE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_BITWISE_COMPARE_HPP_INCLUDED
+
+#include <nanorange/detail/functional/comparisons.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+#include <nanorange/detail/iterator/contiguous.hpp>
+#include <nanorange/detail/simd.hpp>
+
+#include <cstring>
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct bitwise_comparable_concept {
+    template <typename, typename, typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I1, typename I2, typename Pred, typename Proj1,
+              typename Proj2>
+    static auto test(int) -> std::enable_if_t<
+        same_as<Proj1, identity> && same_as<Proj2, identity> &&
+        memory_contiguous_iterator<I1> && memory_contiguous_iterator<I2> &&
+        same_as<iter_value_t<I1>, iter_value_t<I2>> &&
+        simd::vectorizable_integral<iter_value_t<I1>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<I1>>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<I2>>> &&
+        (is_equal_to_v<Pred> || is_less_v<Pred>),
+        std::true_type>;
+};
+
+// True if comparing elements of [I1, ...) and [I2, ...) using Pred and the
+// given projections is the same as comparing their object representations
+// (for equality), or their values as integers (for ordering)
+template <typename I1, typename I2, typename Pred, typename Proj1,
+          typename Proj2>
+NANO_CONCEPT bitwise_comparable =
+    decltype(bitwise_comparable_concept::test<I1, I2, Pred, Proj1, Proj2>(0))::value;
+
+template <typename E>
+bool equal_n(const E* first1, const E* first2, std::size_t n)
+{
+    return n == 0 || std::memcmp(first1, first2, n * sizeof(E)) == 0;
+}
+
+// Returns the index of the first element at which the two arrays differ, or n
+// if they are identical.
+template <typename E>
+std::size_t mismatch_n(const E* first1, const E* first2, std::size_t n)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+    std::size_t i = 0;
+#ifdef NANO_HAS_SIMD
+    // Equal elements have equal bytes, so we can look for the first
+    // differing byte regardless of the element size
+    const auto bytes1 = reinterpret_cast<const unsigned char*>(first1);
+    const auto bytes2 = reinterpret_cast<const unsigned char*>(first2);
+    const std::size_t nbytes = n * sizeof(E);
+    constexpr std::uint32_t all_equal =
+        static_cast<std::uint32_t>((std::uint64_t{1} << simd::width) - 1);
+
+    for (; i + simd::width <= nbytes; i += simd::width) {
+        const std::uint32_t mask = simd::movemask(
+            simd::cmpeq<1>(simd::load(bytes1 + i), simd::load(bytes2 + i)));
+        if (mask != all_equal) {
+            return (i + simd::ctz(~mask)) / sizeof(E);
+        }
+    }
+    i /= sizeof(E);
+#endif
+    while (i < n && first1[i] == first2[i]) {
+        ++i;
+    }
+    return i;
+}
+
+// Returns true if [first1, first1 + n1) is lexicographically less than
+// [first2, first2 + n2)
+template <typename E>
+bool lexicographical_less_n(const E* first1, std::size_t n1, const E* first2,
+                            std::size_t n2)
+{
+    const std::size_t n = n1 < n2 ? n1 : n2;
+
+    // memcmp() compares unsigned bytes, which is exactly what we want
+    if constexpr (sizeof(E) == 1 && std::is_unsigned_v<E>) {
+        if (n > 0) {
+            if (const int r = std::memcmp(first1, first2, n); r != 0) {
+                return r < 0;
+            }
+        }
+    } else {
+        const std::size_t i = detail::mismatch_n(first1, first2, n);
+        if (i != n) {
+            return first1[i] < first2[i];
+        }
+    }
+
+    return n1 < n2;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,137 @@
+// nanorange/detail/algorithm/bounded_random.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Uniform random integers in [0, bound), as shuffle and sample need one per
+// element. std::uniform_int_distribution typically takes a division or two for
+// each of them. Instead, when the generator gives whole 32 or 64 bit words, we
+// multiply a random word by the bound and take the high half of the product,
+// which only needs a division in the rare case that the low half shows the
+// result might be biased (see Lemire, "Fast random integer generation in an
+// interval", ACM TOMACS 29(1), 2019). While the product of two bounds fits in
+// 64 bits, the same word can give us both of them (see Brackett-Rozinsky and
+// Lemire, "Batched ranged random integer generation", 2024).
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_BOUNDED_RANDOM_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_BOUNDED_RANDOM_HPP_INCLUDED
+
+#include <nanorange/random.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether each call to a G gives a uniformly random 32 or 64 bit word
+template <typename G>
+constexpr bool gives_random_words =
+    G::min() == 0 &&
+    (static_cast<std::uint64_t>(G::max()) ==
+         std::numeric_limits<std::uint64_t>::max() ||
+     static_cast<std::uint64_t>(G::max()) ==
+         std::numeric_limits<std::uint32_t>::max());
+
+template <typename G>
+std::uint64_t random_word(G& g)
+{
+    if constexpr (static_cast<std::uint64_t>(G::max()) ==
+                  std::numeric_limits<std::uint64_t>::max()) {
+        return static_cast<std::uint64_t>(g());
+    } else {
+        const auto hi = static_cast<std::uint64_t>(g());
+        return (hi << 32) | static_cast<std::uint64_t>(g());
+    }
+}
+
+// Returns the high half of the 128-bit product of x and y, and leaves the low
+// half in lo
+inline std::uint64_t mul_wide(std::uint64_t x, std::uint64_t y,
+                              std::uint64_t& lo)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ using uint128_t = unsigned __int128;
+    const uint128_t product = static_cast<uint128_t>(x) * y;
+    lo = static_cast<std::uint64_t>(product);
+    return static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t x_lo = x & 0xffffffff;
+    const std::uint64_t x_hi = x >> 32;
+    const std::uint64_t y_lo = y & 0xffffffff;
+    const std::uint64_t y_hi = y >> 32;
+
+    const std::uint64_t ll = x_lo * y_lo;
+    const std::uint64_t lh = x_lo * y_hi;
+    const std::uint64_t hl = x_hi * y_lo;
+    const std::uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+
+    lo = (mid << 32) | (ll & 0xffffffff);
+    return x_hi * y_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+// Returns a uniformly random integer in [0, bound), for bound > 0
+template <typename G>
+std::uint64_t bounded_random(std::uint64_t bound, G& g)
+{
+    if constexpr (gives_random_words<G>) {
+        std::uint64_t lo;
+        std::uint64_t result = detail::mul_wide(detail::random_word(g), bound,
+                                                lo);
+        // 2^64 mod bound of the words would give a result one more often
+        // than the others; they are the ones which leave lo below that
+        if (lo < bound) {
+            const std::uint64_t threshold = (0 - bound) % bound;
+            while (lo < threshold) {
+                result = detail::mul_wide(detail::random_word(g), bound, lo);
+            }
+        }
+        return result;
+    } else {
+        using distr_t = std::uniform_int_distribution<std::uint64_t>;
+        return distr_t(0, bound - 1)(g);
+    }
+}
+
+// Returns uniformly random integers in [0, bound1) and [0, bound2), for bounds
+// greater than zero whose product is less than 2^64
+template <typename G>
+std::pair<std::uint64_t, std::uint64_t>
+bounded_random_pair(std::uint64_t bound1, std::uint64_t bound2, G& g)
+{
+    if constexpr (gives_random_words<G>) {
+        // Multiplying a random word by bound1 and then the low half by
+        // bound2 is the same as multiplying it by their product, with the
+        // high half giving result1 * bound2 + result2
+        const std::uint64_t product = bound1 * bound2;
+        std::uint64_t lo;
+        std::uint64_t result1 = detail::mul_wide(detail::random_word(g),
+                                                 bound1, lo);
+        std::uint64_t result2 = detail::mul_wide(lo, bound2, lo);
+        if (lo < product) {
+            const std::uint64_t threshold = (0 - product) % product;
+            while (lo < threshold) {
+                result1 = detail::mul_wide(detail::random_word(g), bound1, lo);
+                result2 = detail::mul_wide(lo, bound2, lo);
+            }
+        }
+        return {result1, result2};
+    } else {
+        const std::uint64_t result1 = detail::bounded_random(bound1, g);
+        return {result1, detail::bounded_random(bound2, g)};
+    }
+}
+
+// The bounds up to which the product of two of them is less than 2^64
+constexpr std::uint64_t bounded_random_pair_limit = std::uint64_t(1) << 32;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
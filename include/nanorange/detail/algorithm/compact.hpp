@@ -0,0 +1,269 @@
+// nanorange/detail/algorithm/compact.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Kernels for the algorithms which keep some of the elements of a range, in
+// order: remove, remove_if, unique, remove_copy, remove_copy_if and copy_if.
+// Written the obvious way, these branch on whether to keep each element, and
+// when that is unpredictable about half of those branches are mispredicted.
+// For contiguous ranges of small, trivially copyable elements we instead
+// always write each element to the output, and then advance the output by
+// one or zero, so that the loop takes the same path whichever elements are
+// kept. When whether to keep an element is just a comparison of integers, we
+// can also do that for a whole vector of elements at a time.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_COMPACT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_COMPACT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/memmove.hpp>
+#include <nanorange/detail/simd.hpp>
+
+#include <array>
+#include <cstring>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Larger elements are cheaper to copy only when they are kept
+constexpr std::size_t compact_max_element_size = 16;
+
+struct compactable_in_place_concept {
+    template <typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename S>
+    static auto test(int) -> std::enable_if_t<
+        memmove_movable<I, I> && sized_sentinel_for<S, I> &&
+        sizeof(iter_value_t<I>) <= compact_max_element_size,
+        std::true_type>;
+};
+
+// True if remove(), remove_if() and unique() may use the kernels below
+template <typename I, typename S>
+NANO_CONCEPT compactable_in_place =
+    decltype(compactable_in_place_concept::test<I, S>(0))::value;
+
+struct compactable_copy_concept {
+    template <typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename S, typename O>
+    static auto test(int) -> std::enable_if_t<
+        memmove_copyable<I, O> && sized_sentinel_for<S, I> &&
+        sizeof(iter_value_t<I>) <= compact_max_element_size,
+        std::true_type>;
+};
+
+// True if copy_if(), remove_copy() and remove_copy_if() may use the kernels
+// below
+template <typename I, typename S, typename O>
+NANO_CONCEPT compactable_copy =
+    decltype(compactable_copy_concept::test<I, S, O>(0))::value;
+
+// Writes the elements of [first, last) for which keep() is true to out, in
+// order, and returns the end of them. out may be the start of the input, or
+// before it.
+template <typename P, typename Keep>
+P compact_in_place(P first, P last, P out, Keep& keep)
+{
+    for (; first != last; ++first) {
+        const bool k = keep(*first);
+        *out = std::move(*first);
+        out += k;
+    }
+    return out;
+}
+
+// As compact_in_place(), but for an output which does not overlap the input,
+// and need only have room for the elements which are kept. We compact each
+// block of the input into a buffer, and copy what we keep from there.
+template <typename P, typename O, typename Keep>
+O compact_copy(P first, P last, O out, Keep& keep)
+{
+    using E = std::remove_cv_t<std::remove_pointer_t<P>>;
+    constexpr std::ptrdiff_t block = 1024 / sizeof(E);
+    alignas(E) unsigned char buffer[block * sizeof(E)];
+
+    while (first != last) {
+        const std::ptrdiff_t len =
+            last - first < block ? last - first : block;
+        std::size_t n = 0;
+        for (std::ptrdiff_t i = 0; i < len; ++i) {
+            const bool k = keep(first[i]);
+            std::memcpy(buffer + n * sizeof(E), first + i, sizeof(E));
+            n += k;
+        }
+        std::memcpy(out, buffer, n * sizeof(E));
+        out += n;
+        first += len;
+    }
+    return out;
+}
+
+// As compact_in_place(), keeping each element of [first, last) which is not
+// the same as the last one we kept, starting with out[-1]. We keep the last
+// element we kept in a register, rather than read it back from out[-1],
+// which would have to wait for it to be written.
+template <typename P, typename Same>
+P unique_in_place(P first, P last, P out, Same& same)
+{
+    auto kept = out[-1];
+    for (; first != last; ++first) {
+        const bool k = !same(kept, *first);
+        kept = k ? *first : kept;
+        *out = std::move(*first);
+        out += k;
+    }
+    return out;
+}
+
+#if defined(NANO_SIMD_AVX512)
+
+using compact_vec = __m512i;
+constexpr std::ptrdiff_t compact_width = 64;
+
+inline compact_vec compact_load(const void* p)
+{
+    return _mm512_loadu_si512(p);
+}
+
+template <typename E>
+compact_vec compact_splat(E e)
+{
+    if constexpr (sizeof(E) == 4) {
+        return _mm512_set1_epi32(static_cast<int>(e));
+    } else {
+        return _mm512_set1_epi64(static_cast<long long>(e));
+    }
+}
+
+// Writes the lanes of v which differ from those of w to out, packed
+// together, and returns the end of them. A whole vector is written at out.
+template <typename E>
+E* compress_not_equal(E* out, compact_vec v, compact_vec w)
+{
+    if constexpr (sizeof(E) == 4) {
+        const __mmask16 keep = _mm512_cmpneq_epi32_mask(v, w);
+        _mm512_storeu_si512(out, _mm512_maskz_compress_epi32(keep, v));
+        return out + simd::popcount(keep);
+    } else {
+        const __mmask8 keep = _mm512_cmpneq_epi64_mask(v, w);
+        _mm512_storeu_si512(out, _mm512_maskz_compress_epi64(keep, v));
+        return out + simd::popcount(keep);
+    }
+}
+
+#elif defined(NANO_SIMD_AVX2)
+
+using compact_vec = simd::vec;
+constexpr std::ptrdiff_t compact_width = simd::width;
+
+inline compact_vec compact_load(const void* p) { return simd::load(p); }
+
+template <typename E>
+compact_vec compact_splat(E e)
+{
+    return simd::splat(e);
+}
+
+// For each mask of which of eight 32-bit lanes to keep, the indices of those
+// lanes, one per byte, packed together
+constexpr std::array<std::uint64_t, 256> make_compress_indices()
+{
+    std::array<std::uint64_t, 256> indices{};
+    for (std::uint64_t mask = 0; mask < 256; ++mask) {
+        int n = 0;
+        for (std::uint64_t lane = 0; lane < 8; ++lane) {
+            if ((mask >> lane) & 1) {
+                indices[mask] |= lane << (8 * n++);
+            }
+        }
+    }
+    return indices;
+}
+
+inline constexpr std::array<std::uint64_t, 256> compress_indices =
+    make_compress_indices();
+
+// Writes the lanes of v which differ from those of w to out, packed
+// together, and returns the end of them. A whole vector is written at out.
+// Each 64-bit lane is a pair of 32-bit lanes, which are kept together.
+template <typename E>
+E* compress_not_equal(E* out, compact_vec v, compact_vec w)
+{
+    const auto equal = static_cast<std::uint32_t>(_mm256_movemask_ps(
+        _mm256_castsi256_ps(simd::cmpeq<sizeof(E)>(v, w))));
+    const std::uint32_t keep = ~equal & 0xff;
+    // _mm_cvtsi64_si128() would be simpler, but is only there on x86-64
+    const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+        reinterpret_cast<const __m128i*>(&compress_indices[keep])));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        _mm256_permutevar8x32_epi32(v, indices));
+    return out + simd::popcount(keep) / (sizeof(E) / 4);
+}
+
+#endif
+
+// As compact_in_place(), keeping the elements which are not equal to value
+template <typename E>
+E* remove_value_in_place(E* first, E* last, E* out, E value)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+#if defined(NANO_SIMD_AVX2)
+    // The vector written at out never reaches past the vector we have
+    // just read
+    if constexpr (sizeof(E) >= 4) {
+        constexpr std::ptrdiff_t per_vec = compact_width / sizeof(E);
+        const compact_vec needle = detail::compact_splat(value);
+        for (; last - first >= per_vec; first += per_vec) {
+            out = detail::compress_not_equal(out, compact_load(first),
+                                             needle);
+        }
+    }
+#endif
+
+    for (; first != last; ++first) {
+        const bool k = *first != value;
+        *out = *first;
+        out += k;
+    }
+    return out;
+}
+
+// As compact_in_place(), keeping the elements which are not equal to the one
+// before them in the input. Since equality is transitive, that is the same as
+// comparing them to the last one we kept. out must be before first.
+template <typename E>
+E* unique_values_in_place(E* first, E* last, E* out)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+#if defined(NANO_SIMD_AVX2)
+    // As out is before first, the vector written at out never reaches the
+    // element before the next vector we read
+    if constexpr (sizeof(E) >= 4) {
+        constexpr std::ptrdiff_t per_vec = compact_width / sizeof(E);
+        for (; last - first >= per_vec; first += per_vec) {
+            out = detail::compress_not_equal(out, compact_load(first),
+                                             compact_load(first - 1));
+        }
+    }
+#endif
+
+    for (; first != last; ++first) {
+        const bool k = *first != first[-1];
+        *out = *first;
+        out += k;
+    }
+    return out;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,126 @@
+// nanorange/detail/algorithm/find_value.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_FIND_VALUE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_FIND_VALUE_HPP_INCLUDED
+
+#include <nanorange/detail/iterator/contiguous.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+#include <nanorange/detail/simd.hpp>
+
+#include <cstring>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Kernels for find() and count() on contiguous ranges of integers. These
+// compare bit patterns, so the caller is responsible for converting the
+// value to the element type (and checking that doing so is lossless).
+
+template <typename E>
+const E* find_value_n(const E* first, std::size_t n, E value)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+    if constexpr (sizeof(E) == 1) {
+        const void* p = std::memchr(first, static_cast<unsigned char>(value), n);
+        return p ? static_cast<const E*>(p) : first + n;
+    } else {
+#ifdef NANO_HAS_SIMD
+        constexpr std::size_t per_vec = simd::width / sizeof(E);
+        const simd::vec needle = simd::splat(value);
+        std::size_t i = 0;
+
+        // Check four vectors at a time until we hit something...
+        for (; i + 4 * per_vec <= n; i += 4 * per_vec) {
+            const simd::vec eq = simd::bit_or(
+                simd::bit_or(
+                    simd::cmpeq<sizeof(E)>(simd::load(first + i), needle),
+                    simd::cmpeq<sizeof(E)>(simd::load(first + i + per_vec),
+                                           needle)),
+                simd::bit_or(
+                    simd::cmpeq<sizeof(E)>(
+                        simd::load(first + i + 2 * per_vec), needle),
+                    simd::cmpeq<sizeof(E)>(
+                        simd::load(first + i + 3 * per_vec), needle)));
+            if (simd::movemask(eq) != 0) {
+                break;
+            }
+        }
+
+        // ...then find out exactly where
+        for (; i + per_vec <= n; i += per_vec) {
+            const std::uint32_t mask = simd::movemask(
+                simd::cmpeq<sizeof(E)>(simd::load(first + i), needle));
+            if (mask != 0) {
+                return first + i + simd::ctz(mask) / sizeof(E);
+            }
+        }
+
+        first += i;
+        n -= i;
+#endif
+        const E* const last = first + n;
+        while (first != last && *first != value) {
+            ++first;
+        }
+        return first;
+    }
+}
+
+template <typename E>
+std::size_t count_value_n(const E* first, std::size_t n, E value)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+    std::size_t counter = 0;
+#ifdef NANO_HAS_SIMD
+    constexpr std::size_t per_vec = simd::width / sizeof(E);
+    const simd::vec needle = simd::splat(value);
+    std::size_t i = 0;
+
+    // movemask() gives us one bit per byte, so sizeof(E) bits per match
+    for (; i + per_vec <= n; i += per_vec) {
+        counter += static_cast<std::size_t>(simd::popcount(simd::movemask(
+            simd::cmpeq<sizeof(E)>(simd::load(first + i), needle))));
+    }
+    counter /= sizeof(E);
+
+    first += i;
+    n -= i;
+#endif
+    for (std::size_t j = 0; j < n; ++j) {
+        counter += first[j] == value;
+    }
+    return counter;
+}
+
+struct value_search_vectorizable_concept {
+    template <typename, typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename S, typename T, typename Proj>
+    static auto test(int) -> std::enable_if_t<
+        same_as<Proj, identity> &&
+        memory_contiguous_iterator<I> && sized_sentinel_for<S, I> &&
+        simd::vectorizable_integral<iter_value_t<I>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<I>>> &&
+        std::is_integral_v<T> && !std::is_same_v<T, bool>,
+        std::true_type>;
+};
+
+// True if find(first, last, value, proj) and count(first, last, value, proj)
+// may use the kernels above
+template <typename I, typename S, typename T, typename Proj>
+NANO_CONCEPT value_search_vectorizable =
+    decltype(value_search_vectorizable_concept::test<I, S, T, Proj>(0))::value;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
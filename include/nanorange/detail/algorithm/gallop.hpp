@@ -0,0 +1,58 @@
+// nanorange/detail/algorithm/gallop.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+
+#include <nanorange/algorithm/partition_point.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Returns the length of the longest prefix of [first, first + len) whose
+// elements satisfy pred, which must hold for a prefix of the range and not
+// for the rest. The search is exponential from the start, so it is cheap
+// when the prefix is short; the final binary search is the branchless one
+// used by partition_point.
+template <typename I, typename D, typename Pred>
+constexpr D gallop_prefix(I first, D len, Pred pred)
+{
+    D last_ofs = 0;
+    D ofs = 1;
+    while (ofs <= len && pred(first[ofs - 1])) {
+        last_ofs = ofs;
+        ofs = 2 * ofs;
+    }
+
+    // pred holds for the first last_ofs elements, and not for the one at
+    // ofs - 1 (if there is one)
+    const D hi = ofs <= len ? ofs - 1 : len;
+    return D(nano::partition_point(first + last_ofs, first + hi, pred) -
+             first);
+}
+
+// As gallop_prefix, but for the longest suffix of [last - len, last)
+template <typename I, typename D, typename Pred>
+constexpr D gallop_suffix(I last, D len, Pred pred)
+{
+    D last_ofs = 0;
+    D ofs = 1;
+    while (ofs <= len && pred(last[-ofs])) {
+        last_ofs = ofs;
+        ofs = 2 * ofs;
+    }
+
+    const D hi = ofs <= len ? ofs - 1 : len;
+    return D(last - nano::partition_point(last - hi, last - last_ofs,
+                                          [&](auto&& x) { return !pred(x); }));
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,277 @@
+// nanorange/detail/algorithm/introselect.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Selection by repeated partitioning, as pdqsort sorts, except that we only
+// continue into the side of each partition which contains the element we are
+// looking for. For large ranges the pivot is chosen as Floyd and Rivest do
+// (see "Expected time bounds for selection", CACM 18(3), 1975): we recursively
+// select from a small sample an element which should lie just to one side of
+// the nth element, so that after the first partition only a small range is
+// left to search. Like pdqsort, we count badly unbalanced partitions, and once
+// there have been too many we switch to the median of medians, which
+// guarantees O(n) time whatever the input.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_INTROSELECT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_INTROSELECT_HPP_INCLUDED
+
+#include <nanorange/algorithm/max_element.hpp>
+#include <nanorange/algorithm/min_element.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+
+#include <cmath>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges of at least this size choose their pivot from a Floyd-Rivest sample
+constexpr int select_floyd_rivest_threshold = 600;
+
+// How many badly unbalanced partitions we allow before we switch to the
+// median of medians. Unlike pdqsort, which can afford log2(n) of them before
+// it is worse than O(n log n), we keep this constant: each bad partition may
+// cost O(n), while the good ones together cost at most 8n.
+constexpr int select_bad_partitions_allowed = 4;
+
+// Partitions [first, last) around pivot *first into elements less than,
+// equal to and greater than the pivot, and returns the range of equal
+// elements
+template <typename I, typename Comp, typename Proj>
+constexpr std::pair<I, I> partition3(I first, I last, Comp& comp, Proj& proj)
+{
+    iter_value_t<I> pivot(nano::iter_move(first));
+
+    // [first + 1, lt) is less than the pivot, [lt, i) equal to it and
+    // [gt, last) greater than it
+    I lt = first + 1;
+    I i = lt;
+    I gt = last;
+    while (i < gt) {
+        if (nano::invoke(comp, nano::invoke(proj, *i),
+                         nano::invoke(proj, pivot))) {
+            nano::iter_swap(lt++, i++);
+        } else if (nano::invoke(comp, nano::invoke(proj, pivot),
+                                nano::invoke(proj, *i))) {
+            nano::iter_swap(i, --gt);
+        } else {
+            ++i;
+        }
+    }
+
+    // Fill the hole at first with the last of the lesser elements, and put
+    // the pivot in its place
+    --lt;
+    if (lt != first) {
+        *first = nano::iter_move(lt);
+    }
+    *lt = std::move(pivot);
+
+    return {std::move(lt), std::move(gt)};
+}
+
+// Selects the nth element using the median of medians as the pivot, which
+// always leaves at most about 7/10 of the range to search
+template <typename I, typename Comp, typename Proj>
+constexpr void median_of_medians_select(I first, I nth, I last, Comp& comp,
+                                        Proj& proj)
+{
+    while (true) {
+        if (last - first < pdqsort_insertion_sort_threshold) {
+            insertion_sort(first, last, comp, proj);
+            return;
+        }
+
+        // Gather the medians of each group of five at the front
+        I medians = first;
+        for (I group = first; last - group >= 5; group += 5) {
+            insertion_sort(group, group + 5, comp, proj);
+            nano::iter_swap(medians++, group + 2);
+        }
+
+        I mid = first + (medians - first) / 2;
+        detail::median_of_medians_select(first, mid, medians, comp, proj);
+        nano::iter_swap(first, mid);
+
+        const auto equal = detail::partition3(first, last, comp, proj);
+        if (nth < equal.first) {
+            last = equal.first;
+        } else if (nth < equal.second) {
+            return;
+        } else {
+            first = equal.second;
+        }
+    }
+}
+
+// Swaps a few elements of [first, last) about, as pdqsort does after a bad
+// partition, to break up patterns which might keep the pivots bad
+template <typename I>
+constexpr void select_break_patterns(I first, I last)
+{
+    const auto size = last - first;
+    if (size < pdqsort_insertion_sort_threshold) {
+        return;
+    }
+
+    nano::iter_swap(first, first + size / 4);
+    nano::iter_swap(last - 1, last - size / 4);
+    if (size > pdqsort_ninther_threshold) {
+        nano::iter_swap(first + 1, first + (size / 4 + 1));
+        nano::iter_swap(first + 2, first + (size / 4 + 2));
+        nano::iter_swap(last - 2, last - (size / 4 + 1));
+        nano::iter_swap(last - 3, last - (size / 4 + 2));
+    }
+}
+
+template <bool Branchless, typename I, typename Comp, typename Proj>
+constexpr void introselect_loop(I first, I nth, I last, Comp& comp,
+                                Proj& proj, int bad_allowed, bool leftmost);
+
+// Moves to *first a pivot which should be close to the nth element, by
+// selecting from a sample of the range around nth. The sample is chosen so
+// that elements before nth in it are no greater than the pivot, and elements
+// after it no less, so the pivot is a median of at least three elements as
+// the partitions expect.
+template <bool Branchless, typename I, typename Comp, typename Proj>
+void floyd_rivest_pivot(I first, I nth, I last, Comp& comp, Proj& proj,
+                        int bad_allowed)
+{
+    using diff_t = iter_difference_t<I>;
+
+    const diff_t size = last - first;
+    const diff_t i = nth - first;
+
+    const double n = static_cast<double>(size);
+    const double z = std::log(n);
+    const double s = 0.5 * std::exp(2 * z / 3);
+    const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) *
+                      (2 * i < size ? -1 : 1);
+    const double di = static_cast<double>(i);
+
+    diff_t l = static_cast<diff_t>(std::fmax(0.0, di - di * s / n + sd));
+    diff_t r = static_cast<diff_t>(
+                   std::fmin(n - 1, di + (n - di) * s / n + sd)) + 1;
+    l = l < i ? l : i - 1;
+    r = r > i + 1 ? r : i + 2;
+
+    detail::introselect_loop<Branchless>(first + l, nth, first + r, comp,
+                                         proj, bad_allowed, true);
+    nano::iter_swap(first, nth);
+}
+
+template <bool Branchless, typename I, typename Comp, typename Proj>
+constexpr void introselect_loop(I first, I nth, I last, Comp& comp,
+                                Proj& proj, int bad_allowed, bool leftmost)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        const diff_t size = last - first;
+
+        if (size < pdqsort_insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort(first, last, comp, proj);
+            } else {
+                unguarded_insertion_sort(first, last, comp, proj);
+            }
+            return;
+        }
+
+        // The least and greatest elements take a single pass to find
+        if (nth == first) {
+            nano::iter_swap(first, nano::min_element(first, last, comp, proj));
+            return;
+        }
+        if (nth == last - 1) {
+            nano::iter_swap(nth, nano::max_element(first, last, comp, proj));
+            return;
+        }
+
+        // Choose the pivot by Floyd-Rivest sampling, or as median of 3 or
+        // pseudomedian of 9.
+        const diff_t s2 = size / 2;
+        if (size >= select_floyd_rivest_threshold &&
+            !detail::is_constant_evaluated()) {
+            detail::floyd_rivest_pivot<Branchless>(first, nth, last, comp,
+                                                   proj, bad_allowed);
+        } else if (size > pdqsort_ninther_threshold) {
+            sort3(first, first + s2, last - 1, comp, proj);
+            sort3(first + 1, first + (s2 - 1), last - 2, comp, proj);
+            sort3(first + 2, first + (s2 + 1), last - 3, comp, proj);
+            sort3(first + (s2 - 1), first + s2, first + (s2 + 1), comp, proj);
+            nano::iter_swap(first, first + s2);
+        } else {
+            sort3(first + s2, first, last - 1, comp, proj);
+        }
+
+        // As in pdqsort, if the pivot is equal to the element before the
+        // range then it is the least element in the range, so we can put
+        // the elements equal to it on the left, and we are done if nth is
+        // among them.
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(first - 1)),
+                                       nano::invoke(proj, *first))) {
+            const I pivot_pos = partition_left(first, last, comp, proj);
+            if (nth <= pivot_pos) {
+                return;
+            }
+            first = pivot_pos + 1;
+            continue;
+        }
+
+        const I pivot_pos =
+            (Branchless ? partition_right_branchless(first, last, comp, proj)
+                        : partition_right(first, last, comp, proj))
+                .first;
+        if (pivot_pos == nth) {
+            return;
+        }
+
+        const diff_t l_size = pivot_pos - first;
+        const diff_t r_size = last - (pivot_pos + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (nth < pivot_pos) {
+            last = pivot_pos;
+        } else {
+            first = pivot_pos + 1;
+            leftmost = false;
+        }
+
+        if (highly_unbalanced) {
+            // If we had too many bad partitions, switch to the median of
+            // medians to guarantee O(n)
+            if (--bad_allowed == 0) {
+                detail::median_of_medians_select(first, nth, last, comp,
+                                                 proj);
+                return;
+            }
+            detail::select_break_patterns(first, last);
+        }
+    }
+}
+
+// Rearranges [first, last) so that *nth is the element which would be there
+// if the range were sorted, with no greater element before it and no lesser
+// element after it
+template <typename I, typename Comp, typename Proj,
+          bool Branchless = is_default_compare_v<std::remove_const_t<Comp>>&&
+              same_as<Proj, identity>&& std::is_arithmetic<iter_value_t<I>>::value>
+constexpr void introselect(I first, I nth, I last, Comp& comp, Proj& proj)
+{
+    if (nth == last) {
+        return;
+    }
+
+    detail::introselect_loop<Branchless>(std::move(first), std::move(nth),
+                                         std::move(last), comp, proj,
+                                         select_bad_partitions_allowed, true);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
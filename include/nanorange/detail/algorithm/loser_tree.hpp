@@ -0,0 +1,176 @@
+// nanorange/detail/algorithm/loser_tree.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_LOSER_TREE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_LOSER_TREE_HPP_INCLUDED
+
+#include <nanorange/ranges.hpp>
+
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// A tournament tree over k sorted sequences, which yields their elements in
+// sorted order using about log2(k) comparisons each (see Knuth, TAOCP vol. 3,
+// 5.4.1). Each internal node remembers the loser of the match played there,
+// so that when the overall winner is replaced by the next element of its
+// sequence, only the matches on the path from its leaf to the root need to be
+// replayed, each against a single stored loser.
+//
+// Ties go to the sequence which was added first, so merging is stable. The
+// comparator and projection are passed to each call rather than stored, so
+// that the tree can be kept in a view which may be copied or moved.
+template <typename I, typename S, typename Proj>
+class loser_tree {
+    using key_t = remove_cvref_t<invoke_result_t<Proj&, iter_reference_t<I>>>;
+
+    // Small keys are copied out of the sequences as they are reached, so that
+    // a match needs one load to see the element which won below it, rather
+    // than two
+    static constexpr bool cache_keys = std::is_trivially_copyable_v<key_t> &&
+                                       sizeof(key_t) <= 2 * sizeof(void*);
+
+public:
+    void add(I first, S last)
+    {
+        exhausted_.push_back(flag{first == last});
+        firsts_.push_back(std::move(first));
+        lasts_.push_back(std::move(last));
+    }
+
+    // Plays the initial tournament; must be called after the last add()
+    template <typename Comp>
+    void build(Comp& comp, Proj& proj)
+    {
+        // We pad the tree out with empty sequences to a power of two leaves,
+        // so that the leaves are in the order the sequences were added
+        std::size_t k = 1;
+        while (k < firsts_.size()) {
+            k *= 2;
+        }
+        firsts_.resize(k);
+        lasts_.resize(k);
+        exhausted_.resize(k, flag{true});
+
+        nodes_.assign(k, 0);
+        if constexpr (cache_keys) {
+            keys_.resize(k);
+            for (std::size_t i = 0; i < k; i++) {
+                if (!exhausted_[i].set) {
+                    keys_[i] = nano::invoke(proj, *firsts_[i]);
+                }
+            }
+        }
+
+        // The winners of the matches at each node, with the leaves for the
+        // sequences at [k, 2k)
+        std::vector<std::size_t> winners(2 * k);
+        for (std::size_t i = 0; i < k; i++) {
+            winners[k + i] = i;
+        }
+
+        for (std::size_t n = k - 1; n > 0; n--) {
+            std::size_t winner = winners[2 * n];
+            nodes_[n] = winners[2 * n + 1];
+            bool exhausted = exhausted_[winner].set;
+            play(nodes_[n], winner, exhausted, true, comp, proj);
+            winners[n] = winner;
+        }
+        nodes_[0] = winners[1];
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return firsts_.empty() || exhausted_[nodes_[0]].set;
+    }
+
+    // The position of the least element, which must exist
+    I& top() { return firsts_[nodes_[0]]; }
+    const I& top() const { return firsts_[nodes_[0]]; }
+
+    // Moves past the least element, and finds the next one
+    template <typename Comp>
+    void pop(Comp& comp, Proj& proj)
+    {
+        std::size_t winner = nodes_[0];
+        bool exhausted = ++firsts_[winner] == lasts_[winner];
+        exhausted_[winner].set = exhausted;
+        if constexpr (cache_keys) {
+            if (!exhausted) {
+                keys_[winner] = nano::invoke(proj, *firsts_[winner]);
+            }
+        }
+
+        // Whichever sequence comes up from a left child was added before
+        // the one stored at its parent
+        for (std::size_t n = firsts_.size() + winner; n > 1; n /= 2) {
+            play(nodes_[n / 2], winner, exhausted, n % 2 == 0, comp, proj);
+        }
+        nodes_[0] = winner;
+    }
+
+private:
+    // A bool which, unlike an element of std::vector<bool>, can be read
+    // without unpacking it, and which unlike an unsigned char does not
+    // force the compiler to assume that writing it may change anything else
+    struct flag {
+        bool set;
+    };
+
+    // Plays a match between the stored loser at a node and the winner coming
+    // up from below, and leaves the new loser in the node
+    template <typename Comp>
+    void play(std::size_t& loser, std::size_t& winner, bool& exhausted,
+              bool winner_first, Comp& comp, Proj& proj) const
+    {
+        const std::size_t other = loser;
+        if (exhausted_[other].set) {
+            return;
+        }
+
+        bool swap = exhausted;
+        if (!swap) {
+            // The winner wins ties if it was added first. Which one wins
+            // each match is unpredictable, so we choose which way round to
+            // compare, and the new winner, with arithmetic rather than
+            // branches.
+            const std::size_t x =
+                other ^ ((other ^ winner) & (std::size_t(winner_first) - 1));
+            const std::size_t y = x ^ other ^ winner;
+            if constexpr (cache_keys) {
+                swap = nano::invoke(comp, keys_[x], keys_[y]) == winner_first;
+            } else {
+                swap = nano::invoke(comp, nano::invoke(proj, *firsts_[x]),
+                                    nano::invoke(proj, *firsts_[y])) ==
+                       winner_first;
+            }
+        }
+
+        const std::size_t diff = (winner ^ other) & (0 - std::size_t(swap));
+        loser = other ^ diff;
+        winner ^= diff;
+        exhausted = exhausted && !swap;
+    }
+
+    // nodes_[0] is the overall winner, and nodes_[n] for 0 < n < k the
+    // loser of the match at internal node n, whose children are 2n and
+    // 2n + 1
+    std::vector<std::size_t> nodes_;
+    // The current position and end of each sequence, and whether it has
+    // run out
+    std::vector<I> firsts_;
+    std::vector<S> lasts_;
+    std::vector<flag> exhausted_;
+    std::vector<std::conditional_t<cache_keys, key_t, char>> keys_;
+};
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
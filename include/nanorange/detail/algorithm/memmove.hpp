@@ -0,0 +1,96 @@
+// nanorange/detail/algorithm/memmove.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+
+#include <nanorange/detail/iterator/contiguous.hpp>
+
+#include <cstring>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct memmove_compatible_concept {
+    template <typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename O>
+    static auto test(int) -> std::enable_if_t<
+        memory_contiguous_iterator<I> && memory_contiguous_iterator<O> &&
+        same_as<iter_value_t<I>, iter_value_t<O>> &&
+        std::is_trivially_copyable_v<iter_value_t<I>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<I>>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<O>>>,
+        std::true_type>;
+};
+
+template <typename I, typename O>
+NANO_CONCEPT memmove_compatible =
+    decltype(memmove_compatible_concept::test<I, O>(0))::value;
+
+struct memmove_copyable_concept {
+    template <typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename O>
+    static auto test(int) -> std::enable_if_t<
+        memmove_compatible<I, O> &&
+        std::is_trivially_assignable_v<iter_reference_t<O>,
+                                       iter_reference_t<I>>,
+        std::true_type>;
+};
+
+// True if *o = *i may be replaced by a memmove
+template <typename I, typename O>
+NANO_CONCEPT memmove_copyable =
+    decltype(memmove_copyable_concept::test<I, O>(0))::value;
+
+struct memmove_movable_concept {
+    template <typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename O>
+    static auto test(int) -> std::enable_if_t<
+        memmove_compatible<I, O> &&
+        std::is_trivially_assignable_v<iter_reference_t<O>,
+                                       iter_rvalue_reference_t<I>>,
+        std::true_type>;
+};
+
+// True if *o = iter_move(i) may be replaced by a memmove
+template <typename I, typename O>
+NANO_CONCEPT memmove_movable =
+    decltype(memmove_movable_concept::test<I, O>(0))::value;
+
+// Copies the n elements starting at first to the n elements starting at
+// result, returning result + n. Not usable in constant expressions; callers
+// must check is_constant_evaluated() first.
+template <typename I, typename O>
+O memmove_n(I first, iter_difference_t<I> n, O result)
+{
+    if (n > 0) {
+        std::memmove(detail::to_address(result), detail::to_address(first),
+                     static_cast<std::size_t>(n) * sizeof(iter_value_t<I>));
+    }
+    return result + static_cast<iter_difference_t<O>>(n);
+}
+
+// As above, but fills the n elements ending at result, and returns result - n
+template <typename I, typename O>
+O memmove_backward_n(I first, iter_difference_t<I> n, O result)
+{
+    result -= static_cast<iter_difference_t<O>>(n);
+    detail::memmove_n(std::move(first), n, result);
+    return result;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
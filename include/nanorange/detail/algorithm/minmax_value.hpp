@@ -0,0 +1,280 @@
+// nanorange/detail/algorithm/minmax_value.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Kernels for min_element(), max_element() and minmax_element(), and for
+// min(), max() and minmax() of a range, on contiguous ranges of integers and
+// floating point numbers compared with less. We keep the least and greatest
+// of each lane of a few vectors, which needs no branches and no dependence
+// of one step on the comparisons of the last, and then combine the lanes.
+//
+// To find an element rather than a value we work in blocks, and remember
+// only the first block with the least value so far and the last with the
+// greatest, so that afterwards we need only search one block for each,
+// which we do a vector at a time.
+//
+// Where any element is NaN, less is no longer a strict weak order, and the
+// results of the scalar algorithms depend on where the NaNs are. That is
+// rare enough that we leave the scalar algorithms to deal with it.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_MINMAX_VALUE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_MINMAX_VALUE_HPP_INCLUDED
+
+#include <nanorange/detail/functional/comparisons.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+#include <nanorange/detail/iterator/contiguous.hpp>
+#include <nanorange/detail/simd.hpp>
+
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct minmax_vectorizable_concept {
+    template <typename, typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    static auto test(int) -> std::enable_if_t<
+        same_as<Proj, identity> && is_less_v<Comp> &&
+        memory_contiguous_iterator<I> && sized_sentinel_for<S, I> &&
+        simd::has_minmax<iter_value_t<I>> &&
+        !std::is_volatile_v<std::remove_reference_t<iter_reference_t<I>>>,
+        std::true_type>;
+};
+
+// True if the min and max algorithms may use the kernels below
+template <typename I, typename S, typename Comp, typename Proj>
+NANO_CONCEPT minmax_vectorizable =
+    decltype(minmax_vectorizable_concept::test<I, S, Comp, Proj>(0))::value;
+
+template <typename T>
+struct minmax_bounds {
+    T min;
+    T max;
+    bool unordered;
+};
+
+// The number of elements we take at each step, in enough vectors to hide
+// the latency of the minimum and maximum instructions
+#ifdef NANO_HAS_SIMD
+template <typename T>
+constexpr std::ptrdiff_t minmax_step = 4 * simd::width / sizeof(T);
+#else
+template <typename T>
+constexpr std::ptrdiff_t minmax_step = 4;
+#endif
+
+// The number of elements in a block, when we are looking for elements
+constexpr std::ptrdiff_t minmax_block_bytes = 4096;
+
+// The least (if Min is true) and greatest (if Max is true) of the n elements
+// starting at p, where n is a non-zero multiple of minmax_step<T>, and
+// whether any of them are NaN
+template <bool Min = true, bool Max = true, typename T>
+minmax_bounds<T> vector_bounds(const T* p, std::ptrdiff_t n)
+{
+#ifdef NANO_HAS_SIMD
+    constexpr std::ptrdiff_t per_vec = simd::width / sizeof(T);
+    constexpr std::ptrdiff_t vecs = minmax_step<T> / per_vec;
+
+    simd::vec lo[vecs];
+    simd::vec hi[vecs];
+    simd::vec nan[vecs];
+    for (std::ptrdiff_t j = 0; j < vecs; ++j) {
+        lo[j] = hi[j] = simd::load(p + j * per_vec);
+        nan[j] = simd::splat(0);
+    }
+    for (std::ptrdiff_t i = minmax_step<T>; i < n; i += minmax_step<T>) {
+        for (std::ptrdiff_t j = 0; j < vecs; ++j) {
+            const simd::vec v = simd::load(p + i + j * per_vec);
+            if constexpr (Min) {
+                lo[j] = simd::min<T>(v, lo[j]);
+            }
+            if constexpr (Max) {
+                hi[j] = simd::max<T>(v, hi[j]);
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                nan[j] = simd::bit_or(nan[j], simd::unordered<T>(v, v));
+            }
+        }
+    }
+    for (std::ptrdiff_t j = 1; j < vecs; ++j) {
+        lo[0] = simd::min<T>(lo[j], lo[0]);
+        hi[0] = simd::max<T>(hi[j], hi[0]);
+        nan[0] = simd::bit_or(nan[j], nan[0]);
+    }
+
+    T lanes_lo[per_vec];
+    T lanes_hi[per_vec];
+    simd::store(lanes_lo, lo[0]);
+    simd::store(lanes_hi, hi[0]);
+    minmax_bounds<T> bounds{lanes_lo[0], lanes_hi[0], false};
+    for (std::ptrdiff_t j = 1; j < per_vec; ++j) {
+        bounds.min = lanes_lo[j] < bounds.min ? lanes_lo[j] : bounds.min;
+        bounds.max = bounds.max < lanes_hi[j] ? lanes_hi[j] : bounds.max;
+    }
+    // The lanes were filled from the first step without checking it for NaN
+    if constexpr (std::is_floating_point_v<T>) {
+        bounds.unordered = simd::movemask(nan[0]) != 0;
+        for (std::ptrdiff_t j = 0; j < minmax_step<T>; ++j) {
+            bounds.unordered |= p[j] != p[j];
+        }
+    }
+    return bounds;
+#else
+    minmax_bounds<T> bounds{p[0], p[0], false};
+    for (std::ptrdiff_t i = 1; i < n; ++i) {
+        bounds.min = p[i] < bounds.min ? p[i] : bounds.min;
+        bounds.max = bounds.max < p[i] ? p[i] : bounds.max;
+    }
+    return bounds;
+#endif
+}
+
+// The first (if First is true) or last of the n elements starting at p which
+// is equal to value, where n is a multiple of minmax_step<T> and there is
+// such an element
+template <bool First, typename T>
+const T* vector_find_equal(const T* p, std::ptrdiff_t n, T value)
+{
+#ifdef NANO_HAS_SIMD
+    constexpr std::ptrdiff_t per_vec = simd::width / sizeof(T);
+    const simd::vec needle = simd::splat(value);
+    if constexpr (First) {
+        for (;; p += per_vec) {
+            const std::uint32_t mask = simd::movemask(
+                simd::equal<T>(simd::load(p), needle));
+            if (mask != 0) {
+                return p + simd::ctz(mask) / static_cast<int>(sizeof(T));
+            }
+        }
+    } else {
+        for (p += n - per_vec;; p -= per_vec) {
+            const std::uint32_t mask = simd::movemask(
+                simd::equal<T>(simd::load(p), needle));
+            if (mask != 0) {
+                return p + simd::highest_bit(mask) /
+                               static_cast<int>(sizeof(T));
+            }
+        }
+    }
+#else
+    if constexpr (First) {
+        while (!(*p == value)) {
+            ++p;
+        }
+        return p;
+    } else {
+        p += n - 1;
+        while (!(*p == value)) {
+            --p;
+        }
+        return p;
+    }
+#endif
+}
+
+// Finds the first least element of [first, last) if Min is true, and the
+// last greatest if Max is true, as min_element(), max_element() and
+// minmax_element() do. Returns nulls if any element is NaN.
+template <bool Min, bool Max, typename T>
+std::pair<const T*, const T*> vector_minmax_element(const T* first,
+                                                    const T* last)
+{
+    constexpr std::ptrdiff_t block = minmax_block_bytes / sizeof(T);
+
+    const T* min_block = nullptr;
+    const T* max_block = nullptr;
+    std::ptrdiff_t min_len = 0;
+    std::ptrdiff_t max_len = 0;
+    T lo{};
+    T hi{};
+
+    // Whole blocks, and then what we can of the rest in whole steps
+    while (last - first >= minmax_step<T>) {
+        const std::ptrdiff_t len =
+            last - first >= block
+                ? block
+                : (last - first) / minmax_step<T> * minmax_step<T>;
+        const minmax_bounds<T> bounds =
+            detail::vector_bounds<Min, Max>(first, len);
+        if (bounds.unordered) {
+            return {nullptr, nullptr};
+        }
+        if (Min && (!min_block || bounds.min < lo)) {
+            lo = bounds.min;
+            min_block = first;
+            min_len = len;
+        }
+        if (Max && (!max_block || !(bounds.max < hi))) {
+            hi = bounds.max;
+            max_block = first;
+            max_len = len;
+        }
+        first += len;
+    }
+
+    const T* min_it = nullptr;
+    const T* max_it = nullptr;
+    if (min_block) {
+        min_it = detail::vector_find_equal<true>(min_block, min_len, lo);
+    }
+    if (max_block) {
+        max_it = detail::vector_find_equal<false>(max_block, max_len, hi);
+    }
+
+    // The rest, one at a time
+    for (; first != last; ++first) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (*first != *first) {
+                return {nullptr, nullptr};
+            }
+        }
+        if (Min && (!min_it || *first < *min_it)) {
+            min_it = first;
+        }
+        if (Max && (!max_it || !(*first < *max_it))) {
+            max_it = first;
+        }
+    }
+
+    return {min_it, max_it};
+}
+
+// The least and greatest of the elements of [first, last), which must not be
+// empty. For floating point elements, if any are NaN, or if either result is
+// zero (which might be either +0.0 or -0.0), unordered is set and the caller
+// must use the scalar algorithm.
+template <typename T>
+minmax_bounds<T> vector_minmax_value(const T* first, const T* last)
+{
+    const std::ptrdiff_t n = last - first;
+    const std::ptrdiff_t vector_n = n / minmax_step<T> * minmax_step<T>;
+
+    minmax_bounds<T> bounds{*first, *first, false};
+    if (vector_n > 0) {
+        bounds = detail::vector_bounds(first, vector_n);
+    }
+    for (const T* p = first + vector_n; p != last; ++p) {
+        bounds.min = *p < bounds.min ? *p : bounds.min;
+        bounds.max = bounds.max < *p ? *p : bounds.max;
+        if constexpr (std::is_floating_point_v<T>) {
+            bounds.unordered |= *p != *p;
+        }
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        bounds.unordered |= bounds.min == 0 || bounds.max == 0;
+    }
+    return bounds;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,235 @@
+// nanorange/detail/algorithm/natural_runs.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// A front end for sort() which looks for long natural runs, as found in
+// nearly sorted input, and merges them rather than sorting from scratch.
+// Lone elements which interrupt a run are set aside and merged back in
+// afterwards, in the manner of Ernerfeldt's drop-merge sort, so that a few
+// misplaced elements do not split the input into many short runs.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_NATURAL_RUNS_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_NATURAL_RUNS_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/powersort.hpp>
+
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges shorter than this are left to pdqsort, which already copes with
+// sorted and reversed input
+constexpr int natural_runs_threshold = 256;
+
+// Natural runs shorter than this are not worth merging
+constexpr int natural_runs_min_run = 32;
+
+// A run is ended, rather than carrying on, if that would mean setting aside
+// more than this many elements, or if it is followed by this many steps down
+constexpr int natural_runs_max_skip = 3;
+
+// At most this proportion of the elements may lie outside the long runs
+constexpr int natural_runs_max_unsorted_ratio = 8;
+
+// Once we have read this proportion of the elements, we give up early if
+// half of those we have read lie outside the long runs
+constexpr int natural_runs_probe_ratio = 32;
+
+// Sorts [first, last) if it mostly consists of ascending and descending runs
+// of at least natural_runs_min_run elements, and returns whether it did so.
+//
+// A single pass moves the elements which interrupt ascending runs out to a
+// side buffer, closing up the gaps, and notes where the runs of what remains
+// begin and end. Then descending runs are reversed, each stretch of short
+// runs between the long ones is sorted with pdqsort, as are the set-aside
+// elements, which go back at the end, and everything is merged as in
+// powersort. We give up as soon as we have seen too many elements outside
+// the long runs, so random input costs only a short scan; the range then
+// holds the same elements as before, but perhaps not in the same order.
+template <typename I, typename Comp, typename Proj>
+bool natural_runs_sort(I first, I last, Comp& comp, Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    enum class piece_kind : unsigned char { ascending, descending, unsorted };
+    struct piece {
+        D end;
+        piece_kind kind;
+    };
+
+    const auto less = [&](auto&& a, auto&& b) {
+        return nano::invoke(comp, nano::invoke(proj, a), nano::invoke(proj, b));
+    };
+
+    const D n = last - first;
+    const D max_unsorted = n / natural_runs_max_unsorted_ratio;
+    const D probe = n / natural_runs_probe_ratio;
+    D unsorted = 0;
+    std::vector<piece> pieces;
+    std::vector<iter_value_t<I>> outliers;
+
+    // The elements we have kept so far are [first, out), the last of them
+    // forming a run which began at run_begin. The gap between out and the
+    // next element to be read, it, holds exactly outliers.size() elements.
+    I out = first;
+    I run_begin = first;
+    I it = first;
+
+    const auto too_unsorted = [&] {
+        const D seen = unsorted + D(outliers.size());
+        const D read = it - first;
+        return seen > max_unsorted || (read >= probe && 2 * seen > read);
+    };
+
+    const auto give_up = [&] {
+        nano::move(outliers.begin(), outliers.end(), std::move(out));
+        return false;
+    };
+
+    // Appends [it, e) to the kept elements
+    const auto keep_until = [&](I e) {
+        if (out == it) {
+            out = e;
+        } else {
+            while (it != e) {
+                *out = nano::iter_move(it);
+                ++out;
+                ++it;
+            }
+        }
+        it = std::move(e);
+    };
+
+    while (it != last) {
+        run_begin = out;
+        keep_until(it + 1);
+        piece_kind kind = piece_kind::ascending;
+
+        while (it != last) {
+            if (out - run_begin == 1 && less(*it, *(out - 1))) {
+                kind = piece_kind::descending;
+            }
+
+            // Find how far the run carries on in the unread elements. The
+            // reversal of a descending run need not be stable, so it may
+            // carry on through equal elements.
+            I e = it;
+            if (kind == piece_kind::descending) {
+                if (!less(*(out - 1), *e)) {
+                    while (++e != last && !less(*(e - 1), *e)) {
+                    }
+                }
+                keep_until(std::move(e));
+                break;
+            }
+            if (!less(*e, *(out - 1))) {
+                while (++e != last && !less(*e, *(e - 1))) {
+                }
+            }
+            keep_until(std::move(e));
+            if (it == last) {
+                break;
+            }
+
+            // Unless a descending run starts here, we look for the fewest
+            // elements to set aside, of the last few we kept and of this one
+            // and those after it, for the run to carry on
+            if (last - it > natural_runs_max_skip) {
+                D down = 0;
+                while (down < natural_runs_max_skip &&
+                       less(*(it + down + 1), *(it + down))) {
+                    ++down;
+                }
+                if (down == natural_runs_max_skip) {
+                    break;
+                }
+            }
+
+            bool set_aside = false;
+            const D len = out - run_begin;
+            for (D skip = 1; !set_aside && skip <= natural_runs_max_skip;
+                 ++skip) {
+                for (D back = 0; back <= skip && back < len; ++back) {
+                    const D ahead = skip - back;
+                    if (ahead < last - it &&
+                        !less(*(it + ahead), *(out - back - 1))) {
+                        for (I b = out - back; b != out; ++b) {
+                            outliers.push_back(nano::iter_move(b));
+                        }
+                        out -= back;
+                        if (ahead == 0) {
+                            *out = nano::iter_move(it);
+                            ++out;
+                        } else {
+                            outliers.push_back(nano::iter_move(it));
+                        }
+                        ++it;
+                        set_aside = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!set_aside) {
+                break;
+            }
+            if (too_unsorted()) {
+                return give_up();
+            }
+        }
+
+        const D len = out - run_begin;
+        if (len >= natural_runs_min_run) {
+            pieces.push_back(piece{out - first, kind});
+        } else {
+            unsorted += len;
+            if (too_unsorted()) {
+                return give_up();
+            }
+            if (!pieces.empty() && pieces.back().kind == piece_kind::unsorted) {
+                pieces.back().end = out - first;
+            } else {
+                pieces.push_back(piece{out - first, piece_kind::unsorted});
+            }
+        }
+    }
+
+    if (!outliers.empty()) {
+        nano::move(outliers.begin(), outliers.end(), out);
+        if (pieces.back().kind == piece_kind::unsorted) {
+            pieces.back().end = n;
+        } else {
+            pieces.push_back(piece{n, piece_kind::unsorted});
+        }
+    }
+
+    std::size_t next_piece = 0;
+    auto next_run = [&](I b) {
+        const piece& p = pieces[next_piece++];
+        I e = first + p.end;
+        if (p.kind == piece_kind::descending) {
+            nano::reverse(b, e);
+        } else if (p.kind == piece_kind::unsorted) {
+            detail::pdqsort(b, e, comp, proj);
+        }
+        return e;
+    };
+
+    if (pieces.size() == 1) {
+        next_run(first);
+    } else {
+        detail::powersort_merge_runs(std::move(first), std::move(last),
+                                     next_run, comp, proj);
+    }
+    return true;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
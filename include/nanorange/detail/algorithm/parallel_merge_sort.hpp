@@ -0,0 +1,215 @@
+// nanorange/detail/algorithm/parallel_merge_sort.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_MERGE_SORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_MERGE_SORT_HPP_INCLUDED
+
+#include <nanorange/detail/execution/parallel_for.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Pieces smaller than this are not worth sorting on another thread
+inline constexpr std::size_t parallel_sort_min_grain = 16384;
+
+// True if the elements of [I, ...) may be moved into a buffer of their value
+// type and compared there, as the parallel sorts do. This excludes iterators
+// which return proxy references.
+template <typename I>
+NANO_CONCEPT buffer_sortable =
+    std::is_same_v<iter_reference_t<I>, iter_value_t<I>&>;
+
+// Returns the number of elements of the sorted run [left, left + len1) which
+// are among the first d elements of its stable merge with the sorted run
+// [right, right + len2)
+template <typename I, typename D, typename Comp, typename Proj>
+D merge_path_split(I left, D len1, I right, D len2, D d, Comp& comp,
+                   Proj& proj)
+{
+    D lo = d > len2 ? d - len2 : 0;
+    D hi = d < len1 ? d : len1;
+
+    while (lo < hi) {
+        const D mid = lo + (hi - lo) / 2;
+        // Equal elements are taken from the left run first, so left[mid]
+        // comes after right[d - mid - 1] only if it is strictly greater
+        if (nano::invoke(comp, nano::invoke(proj, right[d - mid - 1]),
+                         nano::invoke(proj, left[mid]))) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Merges each pair of adjacent sorted runs of src, whose boundaries are given
+// by bounds, into the same positions of dst. The output is split into
+// pieces, each of which is merged independently on the thread pool.
+template <typename Src, typename Dst, typename D, typename Comp,
+          typename Proj>
+void parallel_merge_round(Src src, Dst dst, const std::vector<D>& bounds,
+                          Comp& comp, Proj& proj)
+{
+    const std::size_t runs = bounds.size() - 1;
+    const D n = bounds.back();
+
+    // The index of the first run of the pair containing output position d
+    const auto pair_of = [&](D d) {
+        const auto run = static_cast<std::size_t>(
+            std::upper_bound(bounds.begin(), bounds.end(), d) -
+            bounds.begin() - 1);
+        return run - run % 2;
+    };
+    const auto pair_end = [&](std::size_t r) {
+        return bounds[r + 2 < runs ? r + 2 : runs];
+    };
+    const auto run_end = [&](std::size_t r) {
+        return bounds[r + 1 < runs ? r + 1 : runs];
+    };
+
+    // Merging moves elements out of src, so we must find where each piece
+    // starts in the input runs before any piece is merged. Each piece then
+    // knows exactly which input elements it owns.
+    const std::size_t num_pieces =
+        detail::parallel_chunk_count(static_cast<std::size_t>(n));
+    std::vector<D> splits(num_pieces);
+    for (std::size_t p = 0; p < num_pieces; p++) {
+        const D d = detail::parallel_chunk_begin(n, num_pieces, p);
+        const std::size_t r = pair_of(d);
+        const D lo = bounds[r];
+        const D mid = run_end(r);
+        splits[p] = detail::merge_path_split(src + lo, mid - lo, src + mid,
+                                             pair_end(r) - mid, d - lo, comp,
+                                             proj);
+    }
+
+    detail::parallel_for_chunks(n, num_pieces, [&](std::size_t p, D b, D e) {
+        bool piece_start = true;
+        while (b < e) {
+            const std::size_t r = pair_of(b);
+            const D lo = bounds[r];
+            const D mid = run_end(r);
+            const D hi = pair_end(r);
+            const D stop = hi < e ? hi : e;
+
+            // Merge [src + i, src + i_end) with [src + j, src + j_end) into
+            // output positions [b, stop)
+            D i = lo + (piece_start ? splits[p] : 0);
+            D j = mid + (b - lo) - (i - lo);
+            const D i_end = lo + (stop == hi ? mid - lo : splits[p + 1]);
+            const D j_end = mid + (stop - lo) - (i_end - lo);
+
+            Dst out = dst + b;
+            while (i != i_end && j != j_end) {
+                if (nano::invoke(comp, nano::invoke(proj, src[j]),
+                                 nano::invoke(proj, src[i]))) {
+                    *out = nano::iter_move(src + j);
+                    ++j;
+                } else {
+                    *out = nano::iter_move(src + i);
+                    ++i;
+                }
+                ++out;
+            }
+            for (; i != i_end; ++i, ++out) {
+                *out = nano::iter_move(src + i);
+            }
+            for (; j != j_end; ++j, ++out) {
+                *out = nano::iter_move(src + j);
+            }
+
+            b = stop;
+            piece_start = false;
+        }
+    });
+}
+
+// Sorts [first, first + n) by sorting pieces of it on the thread pool using
+// sort_piece(begin, end), and then merging the pieces in parallel. The
+// merges are stable, so the result is stable if sort_piece is. Returns false
+// (without touching the range) if a scratch buffer could not be allocated.
+template <typename I, typename Comp, typename Proj, typename SortPiece>
+bool parallel_merge_sort(I first, iter_difference_t<I> n, Comp& comp,
+                         Proj& proj, SortPiece sort_piece)
+{
+    using D = iter_difference_t<I>;
+    using T = iter_value_t<I>;
+
+    std::size_t num_pieces = detail::parallel_chunk_count(
+        static_cast<std::size_t>(n), parallel_sort_min_grain);
+    if (num_pieces < 2) {
+        sort_piece(first, first + n);
+        return true;
+    }
+
+    // Each round of merging moves the elements between the range and the
+    // buffer. We start with them in the buffer, so we choose the number of
+    // pieces such that there is an odd number of rounds, and they end up
+    // back in the range.
+    std::size_t rounds = 0;
+    while ((std::size_t{1} << rounds) < num_pieces) {
+        ++rounds;
+    }
+    if (rounds % 2 == 0) {
+        num_pieces = (std::size_t{1} << rounds) + 1;
+        ++rounds;
+    }
+
+    temporary_vector<T> buf(static_cast<std::size_t>(n));
+    if (buf.capacity() == 0) {
+        return false;
+    }
+    T* const tmp = buf.begin();
+
+    std::vector<D> bounds(num_pieces + 1);
+    for (std::size_t i = 0; i <= num_pieces; i++) {
+        bounds[i] = detail::parallel_chunk_begin(n, num_pieces, i);
+    }
+
+    detail::parallel_for_chunks(n, num_pieces, [&](std::size_t, D b, D e) {
+        sort_piece(first + b, first + e);
+        for (D i = b; i < e; ++i) {
+            ::new (static_cast<void*>(tmp + i)) T(nano::iter_move(first + i));
+        }
+    });
+    buf.set_size(static_cast<std::size_t>(n));
+
+    bool in_buf = true;
+    while (bounds.size() > 2) {
+        if (in_buf) {
+            detail::parallel_merge_round(tmp, first, bounds, comp, proj);
+        } else {
+            detail::parallel_merge_round(first, tmp, bounds, comp, proj);
+        }
+        in_buf = !in_buf;
+
+        // Every other boundary disappears
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < bounds.size(); i += 2) {
+            bounds[out++] = bounds[i];
+        }
+        if (bounds[out - 1] != n) {
+            bounds[out++] = n;
+        }
+        bounds.resize(out);
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,253 @@
+// nanorange/detail/algorithm/parallel_sort.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_SORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_SORT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/parallel_merge_sort.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/execution/parallel_for.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+
+#include <cstdint>
+#include <new>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges at least this large are sample sorted, if a buffer is available
+inline constexpr std::size_t parallel_sample_sort_threshold = std::size_t{1}
+                                                              << 20;
+
+// The most buckets a sample sort may use, so that a bucket index fits in a
+// byte
+inline constexpr std::size_t sample_sort_max_buckets = 256;
+
+// The number of elements sampled for each bucket when choosing splitters
+inline constexpr std::size_t sample_sort_oversampling = 32;
+
+// Sorts [begin, end) by partitioning as pdqsort does, and then sorting the
+// two sides of the partition concurrently on the thread pool. Partitions
+// smaller than parallel_sort_min_grain are sorted using sort_piece.
+template <bool Branchless, typename I, typename Comp, typename Proj,
+          typename SortPiece>
+void parallel_pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
+                           SortPiece& sort_piece, int bad_allowed,
+                           bool leftmost)
+{
+    using D = iter_difference_t<I>;
+
+    while (end - begin >= static_cast<D>(parallel_sort_min_grain)) {
+        I pivot_pos = begin;
+        const pdqsort_step step = detail::pdqsort_partition_step<Branchless>(
+            begin, end, pivot_pos, comp, proj, bad_allowed, leftmost);
+
+        if (step == pdqsort_step::sorted) {
+            return;
+        }
+        if (step == pdqsort_step::left_sorted) {
+            continue;
+        }
+
+        // Neither side touches the pivot, so the right-hand side may still
+        // compare against it as the end of the previous partition
+        auto task = [&](std::size_t i) {
+            if (i == 0) {
+                detail::parallel_pdqsort_loop<Branchless>(
+                    begin, pivot_pos, comp, proj, sort_piece, bad_allowed,
+                    leftmost);
+            } else {
+                detail::parallel_pdqsort_loop<Branchless>(
+                    pivot_pos + 1, end, comp, proj, sort_piece, bad_allowed,
+                    false);
+            }
+        };
+        default_thread_pool().run(2, task);
+        return;
+    }
+
+    sort_piece(std::move(begin), std::move(end));
+}
+
+template <typename I, typename Comp, typename Proj, typename SortPiece>
+void parallel_pdqsort(I begin, I end, Comp& comp, Proj& proj,
+                      SortPiece& sort_piece)
+{
+    constexpr bool branchless =
+        is_default_compare_v<std::remove_const_t<Comp>> &&
+        same_as<Proj, identity> && std::is_arithmetic<iter_value_t<I>>::value;
+
+    if (begin == end) {
+        return;
+    }
+
+    const int bad_allowed = detail::log2(end - begin);
+    detail::parallel_pdqsort_loop<branchless>(std::move(begin),
+                                              std::move(end), comp, proj,
+                                              sort_piece, bad_allowed, true);
+}
+
+// Sorts [first, first + n) by sample sort. Splitters are chosen from a
+// pseudo-random sample of the range, the elements are moved into the buckets
+// between the splitters, and then each bucket is moved back and sorted
+// independently, with each step running on the thread pool. Returns false
+// (without touching the range) if scratch space could not be allocated.
+template <typename I, typename Comp, typename Proj, typename SortPiece>
+bool parallel_sample_sort(I first, iter_difference_t<I> n, Comp& comp,
+                          Proj& proj, SortPiece& sort_piece)
+{
+    using D = iter_difference_t<I>;
+    using T = iter_value_t<I>;
+
+    std::size_t num_buckets = detail::parallel_chunk_count(
+        static_cast<std::size_t>(n), parallel_sort_min_grain);
+    if (num_buckets > sample_sort_max_buckets) {
+        num_buckets = sample_sort_max_buckets;
+    }
+    if (num_buckets < 2) {
+        return false;
+    }
+
+    temporary_vector<T> buf(static_cast<std::size_t>(n));
+    temporary_vector<unsigned char> ids(static_cast<std::size_t>(n));
+    if (buf.capacity() == 0 || ids.capacity() == 0) {
+        return false;
+    }
+    T* const tmp = buf.begin();
+    unsigned char* const bucket_ids = ids.begin();
+
+    // Choose the splitters from a sorted sample. They are referred to by
+    // their positions in the range, which do not change until every element
+    // has been assigned to a bucket.
+    const auto key_less = [&](D a, D b) {
+        return nano::invoke(comp, nano::invoke(proj, first[a]),
+                            nano::invoke(proj, first[b]));
+    };
+
+    std::vector<D> sample(num_buckets * sample_sort_oversampling);
+    std::uint64_t state = static_cast<std::uint64_t>(n);
+    for (D& s : sample) {
+        // splitmix64
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        s = static_cast<D>((z ^ (z >> 31)) % static_cast<std::uint64_t>(n));
+    }
+    identity id;
+    detail::pdqsort(sample.begin(), sample.end(), key_less, id);
+
+    std::vector<D> splitters(num_buckets - 1);
+    for (std::size_t s = 0; s < splitters.size(); s++) {
+        splitters[s] = sample[(s + 1) * sample_sort_oversampling];
+    }
+
+    // Elements equal to a splitter go in the bucket after it
+    const auto bucket_of = [&](D i) {
+        auto&& key = nano::invoke(proj, first[i]);
+        std::size_t lo = 0;
+        std::size_t hi = splitters.size();
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (nano::invoke(comp, key,
+                             nano::invoke(proj, first[splitters[mid]]))) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    };
+
+    // Classify each element, counting the size of each bucket in each chunk
+    const std::size_t num_chunks =
+        detail::parallel_chunk_count(static_cast<std::size_t>(n));
+    std::vector<D> counts(num_chunks * num_buckets);
+    detail::parallel_for_chunks(n, num_chunks, [&](std::size_t c, D b, D e) {
+        D* const count = counts.data() + c * num_buckets;
+        for (D i = b; i < e; ++i) {
+            const std::size_t k = bucket_of(i);
+            bucket_ids[i] = static_cast<unsigned char>(k);
+            ++count[k];
+        }
+    });
+
+    // Turn the counts into the position in the buffer at which each chunk
+    // writes its elements of each bucket
+    std::vector<D> bucket_begin(num_buckets + 1);
+    D offset = 0;
+    for (std::size_t k = 0; k < num_buckets; k++) {
+        bucket_begin[k] = offset;
+        for (std::size_t c = 0; c < num_chunks; c++) {
+            const D count = counts[c * num_buckets + k];
+            counts[c * num_buckets + k] = offset;
+            offset += count;
+        }
+    }
+    bucket_begin[num_buckets] = n;
+
+    detail::parallel_for_chunks(n, num_chunks, [&](std::size_t c, D b, D e) {
+        D* const pos = counts.data() + c * num_buckets;
+        for (D i = b; i < e; ++i) {
+            ::new (static_cast<void*>(tmp + pos[bucket_ids[i]]++))
+                T(nano::iter_move(first + i));
+        }
+    });
+    buf.set_size(static_cast<std::size_t>(n));
+
+    // A bucket may be much larger than the rest if the input has many equal
+    // keys, in which case it is itself sorted in parallel
+    const D large_bucket = 2 * (n / static_cast<D>(num_buckets));
+    auto sort_bucket = [&](std::size_t k) {
+        const D b = bucket_begin[k];
+        const D e = bucket_begin[k + 1];
+        for (D i = b; i < e; ++i) {
+            first[i] = nano::iter_move(tmp + i);
+        }
+        if (e - b > large_bucket) {
+            detail::parallel_pdqsort(first + b, first + e, comp, proj,
+                                     sort_piece);
+        } else {
+            sort_piece(first + b, first + e);
+        }
+    };
+    default_thread_pool().run(num_buckets, sort_bucket);
+
+    return true;
+}
+
+// Sorts [first, last) on the thread pool, using sort_piece(begin, end) to
+// sort pieces which are too small to be worth splitting further. Very large
+// ranges are sample sorted, which partitions the input in a single parallel
+// pass. Otherwise we fall back to a parallel pdqsort.
+template <typename I, typename Comp, typename Proj, typename SortPiece>
+void parallel_sort(I first, I last, Comp& comp, Proj& proj,
+                   SortPiece sort_piece)
+{
+    const iter_difference_t<I> n = last - first;
+    if (default_thread_pool().concurrency() < 2 ||
+        static_cast<std::size_t>(n) < 2 * parallel_sort_min_grain) {
+        sort_piece(std::move(first), std::move(last));
+        return;
+    }
+
+    if constexpr (buffer_sortable<I>) {
+        if (static_cast<std::size_t>(n) >= parallel_sample_sort_threshold &&
+            detail::parallel_sample_sort(first, n, comp, proj, sort_piece)) {
+            return;
+        }
+    }
+
+    detail::parallel_pdqsort(std::move(first), std::move(last), comp, proj,
+                             sort_piece);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
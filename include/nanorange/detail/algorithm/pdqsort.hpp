@@ -527,107 +527,137 @@ constexpr I partition_left(I begin, I end, Comp& comp, Proj& proj)
     return pivot_pos;
 }
 
+// The outcome of one partitioning step of pdqsort
+enum class pdqsort_step {
+    // The whole range is now sorted
+    sorted,
+    // The start of the range is sorted, and begin has been advanced past it
+    left_sorted,
+    // The range has been partitioned around pivot_pos, and both sides still
+    // need to be sorted
+    partitioned
+};
+
 template <bool Branchless, typename I, typename Comp, typename Proj>
-constexpr void pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
-                            int bad_allowed, bool leftmost = true)
+constexpr pdqsort_step pdqsort_partition_step(I& begin, I end, I& pivot_pos,
+                                              Comp& comp, Proj& proj,
+                                              int& bad_allowed, bool leftmost)
 {
     using diff_t = iter_difference_t<I>;
 
-    // Use a while loop for tail recursion elimination.
-    while (true) {
-        diff_t size = nano::distance(begin, end);
-
-        // Insertion sort is faster for small arrays.
-        if (size < pdqsort_insertion_sort_threshold) {
-            if (leftmost) {
-                insertion_sort(begin, end, comp, proj);
-            } else {
-                unguarded_insertion_sort(begin, end, comp, proj);
-            }
-            return;
-        }
+    diff_t size = nano::distance(begin, end);
 
-        // Choose pivot as median of 3 or pseudomedian of 9.
-        diff_t s2 = size / 2;
-        if (size > pdqsort_ninther_threshold) {
-            sort3(begin, begin + s2, end - 1, comp, proj);
-            sort3(begin + 1, begin + (s2 - 1), end - 2, comp, proj);
-            sort3(begin + 2, begin + (s2 + 1), end - 3, comp, proj);
-            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp, proj);
-            nano::iter_swap(begin, begin + s2);
+    // Insertion sort is faster for small arrays.
+    if (size < pdqsort_insertion_sort_threshold) {
+        if (leftmost) {
+            insertion_sort(begin, end, comp, proj);
         } else {
-            sort3(begin + s2, begin, end - 1, comp, proj);
+            unguarded_insertion_sort(begin, end, comp, proj);
         }
+        return pdqsort_step::sorted;
+    }
 
-        // If *(begin - 1) is the end of the right partition of a previous
-        // partition operation there is no element in [begin, end) that is
-        // smaller than *(begin - 1). Then if our pivot compares equal to
-        // *(begin - 1) we change strategy, putting equal elements in the left
-        // partition, greater elements in the right partition. We do not have to
-        // recurse on the left partition, since it's sorted (all equal).
-        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
-                                       nano::invoke(proj, *begin))) {
-            begin = partition_left(begin, end, comp, proj) + 1;
-            continue;
+    // Choose pivot as median of 3 or pseudomedian of 9.
+    diff_t s2 = size / 2;
+    if (size > pdqsort_ninther_threshold) {
+        sort3(begin, begin + s2, end - 1, comp, proj);
+        sort3(begin + 1, begin + (s2 - 1), end - 2, comp, proj);
+        sort3(begin + 2, begin + (s2 + 1), end - 3, comp, proj);
+        sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp, proj);
+        nano::iter_swap(begin, begin + s2);
+    } else {
+        sort3(begin + s2, begin, end - 1, comp, proj);
+    }
+
+    // If *(begin - 1) is the end of the right partition of a previous
+    // partition operation there is no element in [begin, end) that is
+    // smaller than *(begin - 1). Then if our pivot compares equal to
+    // *(begin - 1) we change strategy, putting equal elements in the left
+    // partition, greater elements in the right partition. We do not have to
+    // recurse on the left partition, since it's sorted (all equal).
+    if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                   nano::invoke(proj, *begin))) {
+        begin = partition_left(begin, end, comp, proj) + 1;
+        return pdqsort_step::left_sorted;
+    }
+
+    // Partition and get results.
+    std::pair<I, bool> part_result =
+        Branchless ? partition_right_branchless(begin, end, comp, proj)
+                   : partition_right(begin, end, comp, proj);
+    pivot_pos = part_result.first;
+    bool already_partitioned = part_result.second;
+
+    // Check for a highly unbalanced partition.
+    diff_t l_size = pivot_pos - begin;
+    diff_t r_size = end - (pivot_pos + 1);
+    bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+    // If we got a highly unbalanced partition we shuffle elements to break
+    // many patterns.
+    if (highly_unbalanced) {
+        // If we had too many bad partitions, switch to heapsort to
+        // guarantee O(n log n).
+        if (--bad_allowed == 0) {
+            nano::make_heap(begin, end, comp, proj);
+            nano::sort_heap(begin, end, comp, proj);
+            return pdqsort_step::sorted;
         }
 
-        // Partition and get results.
-        std::pair<I, bool> part_result =
-            Branchless ? partition_right_branchless(begin, end, comp, proj)
-                       : partition_right(begin, end, comp, proj);
-        I pivot_pos = part_result.first;
-        bool already_partitioned = part_result.second;
-
-        // Check for a highly unbalanced partition.
-        diff_t l_size = pivot_pos - begin;
-        diff_t r_size = end - (pivot_pos + 1);
-        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
-
-        // If we got a highly unbalanced partition we shuffle elements to break
-        // many patterns.
-        if (highly_unbalanced) {
-            // If we had too many bad partitions, switch to heapsort to
-            // guarantee O(n log n).
-            if (--bad_allowed == 0) {
-                nano::make_heap(begin, end, comp, proj);
-                nano::sort_heap(begin, end, comp, proj);
-                return;
+        if (l_size >= pdqsort_insertion_sort_threshold) {
+            nano::iter_swap(begin, begin + l_size / 4);
+            nano::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+            if (l_size > pdqsort_ninther_threshold) {
+                nano::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                nano::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                nano::iter_swap(pivot_pos - 2,
+                                pivot_pos - (l_size / 4 + 1));
+                nano::iter_swap(pivot_pos - 3,
+                                pivot_pos - (l_size / 4 + 2));
             }
+        }
 
-            if (l_size >= pdqsort_insertion_sort_threshold) {
-                nano::iter_swap(begin, begin + l_size / 4);
-                nano::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
-
-                if (l_size > pdqsort_ninther_threshold) {
-                    nano::iter_swap(begin + 1, begin + (l_size / 4 + 1));
-                    nano::iter_swap(begin + 2, begin + (l_size / 4 + 2));
-                    nano::iter_swap(pivot_pos - 2,
-                                    pivot_pos - (l_size / 4 + 1));
-                    nano::iter_swap(pivot_pos - 3,
-                                    pivot_pos - (l_size / 4 + 2));
-                }
+        if (r_size >= pdqsort_insertion_sort_threshold) {
+            nano::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+            nano::iter_swap(end - 1, end - r_size / 4);
+
+            if (r_size > pdqsort_ninther_threshold) {
+                nano::iter_swap(pivot_pos + 2,
+                                pivot_pos + (2 + r_size / 4));
+                nano::iter_swap(pivot_pos + 3,
+                                pivot_pos + (3 + r_size / 4));
+                nano::iter_swap(end - 2, end - (1 + r_size / 4));
+                nano::iter_swap(end - 3, end - (2 + r_size / 4));
             }
+        }
+    } else {
+        // If we were decently balanced and we tried to sort an already
+        // partitioned sequence try to use insertion sort.
+        if (already_partitioned &&
+            partial_insertion_sort(begin, pivot_pos, comp, proj) &&
+            partial_insertion_sort(pivot_pos + 1, end, comp, proj))
+            return pdqsort_step::sorted;
+    }
 
-            if (r_size >= pdqsort_insertion_sort_threshold) {
-                nano::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
-                nano::iter_swap(end - 1, end - r_size / 4);
-
-                if (r_size > pdqsort_ninther_threshold) {
-                    nano::iter_swap(pivot_pos + 2,
-                                    pivot_pos + (2 + r_size / 4));
-                    nano::iter_swap(pivot_pos + 3,
-                                    pivot_pos + (3 + r_size / 4));
-                    nano::iter_swap(end - 2, end - (1 + r_size / 4));
-                    nano::iter_swap(end - 3, end - (2 + r_size / 4));
-                }
-            }
-        } else {
-            // If we were decently balanced and we tried to sort an already
-            // partitioned sequence try to use insertion sort.
-            if (already_partitioned &&
-                partial_insertion_sort(begin, pivot_pos, comp, proj) &&
-                partial_insertion_sort(pivot_pos + 1, end, comp, proj))
-                return;
+    return pdqsort_step::partitioned;
+}
+
+template <bool Branchless, typename I, typename Comp, typename Proj>
+constexpr void pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
+                            int bad_allowed, bool leftmost = true)
+{
+    // Use a while loop for tail recursion elimination.
+    while (true) {
+        I pivot_pos = begin;
+        const pdqsort_step step = detail::pdqsort_partition_step<Branchless>(
+            begin, end, pivot_pos, comp, proj, bad_allowed, leftmost);
+
+        if (step == pdqsort_step::sorted) {
+            return;
+        }
+        if (step == pdqsort_step::left_sorted) {
+            continue;
         }
 
         // Sort the left partition first using recursion and do tail recursion
@@ -0,0 +1,351 @@
+// nanorange/detail/algorithm/powersort.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// An adaptive, stable merge sort which finds the natural runs of the input
+// and merges them in the order given by the "powersort" rule of Munro and
+// Wild (https://arxiv.org/abs/1805.04154), as used by CPython. Merges gallop
+// in the manner of TimSort.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_POWERSORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_POWERSORT_HPP_INCLUDED
+
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/algorithm/reverse.hpp>
+#include <nanorange/algorithm/rotate.hpp>
+#include <nanorange/algorithm/upper_bound.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+#include <nanorange/iterator/back_insert_iterator.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Natural runs shorter than this are extended using insertion sort
+constexpr int powersort_min_run = 32;
+
+// Once one run has supplied this many elements in a row during a merge, we
+// switch to searching for how many more it supplies
+constexpr int powersort_min_gallop = 7;
+
+// Merges [first, middle) with [middle, last), where the first run is no
+// longer than the buffer, by moving it into the buffer and merging forwards
+template <typename I, typename Buf, typename Comp, typename Proj>
+void powersort_merge_lo(I first, I middle, I last, Buf& buf, Comp& comp,
+                        Proj& proj)
+{
+    nano::move(first, middle, nano::back_inserter(buf));
+
+    auto a = buf.begin();
+    const auto a_end = buf.end();
+    I b = std::move(middle);
+    I out = std::move(first);
+
+    while (a != a_end && b != last) {
+        int a_wins = 0;
+        int b_wins = 0;
+        do {
+            // Ties are taken from the first run, for stability
+            if (nano::invoke(comp, nano::invoke(proj, *b),
+                             nano::invoke(proj, *a))) {
+                *out = nano::iter_move(b);
+                ++b;
+                ++b_wins;
+                a_wins = 0;
+            } else {
+                *out = nano::iter_move(a);
+                ++a;
+                ++a_wins;
+                b_wins = 0;
+            }
+            ++out;
+        } while (a != a_end && b != last && a_wins < powersort_min_gallop &&
+                 b_wins < powersort_min_gallop);
+
+        if (a == a_end || b == last) {
+            break;
+        }
+
+        if (a_wins != 0) {
+            const auto n = detail::gallop_prefix(a, a_end - a, [&](auto&& x) {
+                return !nano::invoke(comp, nano::invoke(proj, *b),
+                                     nano::invoke(proj, x));
+            });
+            out = nano::move(a, a + n, std::move(out)).out;
+            a += n;
+        } else {
+            const auto n = detail::gallop_prefix(b, last - b, [&](auto&& x) {
+                return nano::invoke(comp, nano::invoke(proj, x),
+                                    nano::invoke(proj, *a));
+            });
+            out = nano::move(b, b + n, std::move(out)).out;
+            b += n;
+        }
+    }
+
+    // Anything left of the second run is already in place
+    nano::move(a, a_end, std::move(out));
+    buf.clear();
+}
+
+// Merges [first, middle) with [middle, last), where the second run is no
+// longer than the buffer, by moving it into the buffer and merging backwards
+template <typename I, typename Buf, typename Comp, typename Proj>
+void powersort_merge_hi(I first, I middle, I last, Buf& buf, Comp& comp,
+                        Proj& proj)
+{
+    nano::move(middle, last, nano::back_inserter(buf));
+
+    const auto b_begin = buf.begin();
+    auto b = buf.end();
+    I a = std::move(middle);
+    I out = std::move(last);
+
+    while (a != first && b != b_begin) {
+        int a_wins = 0;
+        int b_wins = 0;
+        do {
+            // Ties are taken from the second run, for stability
+            if (nano::invoke(comp, nano::invoke(proj, b[-1]),
+                             nano::invoke(proj, a[-1]))) {
+                *--out = nano::iter_move(--a);
+                ++a_wins;
+                b_wins = 0;
+            } else {
+                *--out = nano::iter_move(--b);
+                ++b_wins;
+                a_wins = 0;
+            }
+        } while (a != first && b != b_begin &&
+                 a_wins < powersort_min_gallop &&
+                 b_wins < powersort_min_gallop);
+
+        if (a == first || b == b_begin) {
+            break;
+        }
+
+        if (a_wins != 0) {
+            const auto n = detail::gallop_suffix(a, a - first, [&](auto&& x) {
+                return nano::invoke(comp, nano::invoke(proj, b[-1]),
+                                    nano::invoke(proj, x));
+            });
+            out = nano::move_backward(a - n, a, std::move(out)).out;
+            a -= n;
+        } else {
+            const auto n = detail::gallop_suffix(b, b - b_begin, [&](auto&& x) {
+                return !nano::invoke(comp, nano::invoke(proj, x),
+                                     nano::invoke(proj, a[-1]));
+            });
+            out = nano::move_backward(b - n, b, std::move(out)).out;
+            b -= n;
+        }
+    }
+
+    // Anything left of the first run is already in place
+    nano::move_backward(b_begin, b, std::move(out));
+    buf.clear();
+}
+
+// Merges the adjacent sorted runs [first, middle) and [middle, last). If
+// neither run fits in the buffer once the elements which are already in
+// place have been trimmed, the merge is split into two smaller ones by
+// rotation, as inplace_merge does without a buffer.
+template <typename I, typename Buf, typename Comp, typename Proj>
+void powersort_merge(I first, I middle, I last, Buf& buf, Comp& comp,
+                     Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    if (first == middle || middle == last) {
+        return;
+    }
+
+    // Elements of the first run which are not greater than the start of the
+    // second are already in place...
+    first += detail::gallop_prefix(first, D(middle - first), [&](auto&& x) {
+        return !nano::invoke(comp, nano::invoke(proj, *middle),
+                             nano::invoke(proj, x));
+    });
+    if (first == middle) {
+        return;
+    }
+
+    // ...as are elements of the second run which are not less than the end
+    // of the first. We know that *middle is less than it, so the second run
+    // cannot become empty.
+    last -= detail::gallop_suffix(last, D(last - middle), [&](auto&& x) {
+        return !nano::invoke(comp, nano::invoke(proj, x),
+                             nano::invoke(proj, *(middle - 1)));
+    });
+
+    const D len1 = middle - first;
+    const D len2 = last - middle;
+    const auto cap = static_cast<D>(buf.capacity());
+
+    if (len1 <= len2 && len1 <= cap) {
+        detail::powersort_merge_lo(std::move(first), std::move(middle),
+                                   std::move(last), buf, comp, proj);
+    } else if (len2 <= cap) {
+        detail::powersort_merge_hi(std::move(first), std::move(middle),
+                                   std::move(last), buf, comp, proj);
+    } else {
+        I m1;
+        I m2;
+        if (len1 >= len2) {
+            m1 = first + len1 / 2;
+            m2 = nano::lower_bound(middle, last, nano::invoke(proj, *m1),
+                                   std::ref(comp), std::ref(proj));
+        } else {
+            m2 = middle + len2 / 2;
+            m1 = nano::upper_bound(first, middle, nano::invoke(proj, *m2),
+                                   std::ref(comp), std::ref(proj));
+        }
+        I new_middle = nano::rotate(m1, std::move(middle), m2).begin();
+        detail::powersort_merge(std::move(first), std::move(m1), new_middle,
+                                buf, comp, proj);
+        detail::powersort_merge(std::move(new_middle), std::move(m2),
+                                std::move(last), buf, comp, proj);
+    }
+}
+
+// Returns the end of the natural run beginning at first, which must not equal
+// last, after sorting it. Strictly descending runs are reversed; they must be
+// strict so that equal elements stay in order. Runs shorter than
+// powersort_min_run are extended using insertion sort.
+template <typename I, typename Comp, typename Proj>
+I powersort_next_run(I first, I last, Comp& comp, Proj& proj)
+{
+    I it = first + 1;
+    if (it != last) {
+        if (nano::invoke(comp, nano::invoke(proj, *it),
+                         nano::invoke(proj, *(it - 1)))) {
+            while (++it != last && nano::invoke(comp, nano::invoke(proj, *it),
+                                                nano::invoke(proj, *(it - 1)))) {
+            }
+            nano::reverse(first, it);
+        } else {
+            while (++it != last && !nano::invoke(comp, nano::invoke(proj, *it),
+                                                 nano::invoke(proj, *(it - 1)))) {
+            }
+        }
+    }
+
+    if (it - first < powersort_min_run) {
+        it = last - first > powersort_min_run ? first + powersort_min_run : last;
+        detail::insertion_sort(first, it, comp, proj);
+    }
+    return it;
+}
+
+// The depth in the merge tree of the boundary between the runs
+// [s1, s1 + n1) and [s1 + n1, s1 + n1 + n2) of a range of n elements: that
+// is, the position of the first bit in which the binary fractions of the
+// runs' midpoints (as a proportion of n) differ
+template <typename D>
+int powersort_node_power(D s1, D n1, D n2, D n)
+{
+    auto a = static_cast<std::uint64_t>(2 * s1 + n1);
+    auto b = a + static_cast<std::uint64_t>(n1 + n2);
+    const auto un = static_cast<std::uint64_t>(n);
+
+    int power = 0;
+    while (true) {
+        ++power;
+        if (a >= un) {
+            a -= un;
+            b -= un;
+        } else if (b >= un) {
+            break;
+        }
+        a <<= 1;
+        b <<= 1;
+    }
+    return power;
+}
+
+// Merges the consecutive sorted runs which make up [first, last), where
+// next_run(it) sorts the run beginning at it and returns its end. The buffer
+// ideally holds half of the elements, so that every merge fits in it; if that
+// much cannot be allocated we try successively smaller buffers, and merges
+// which do not fit are split up.
+template <typename I, typename NextRun, typename Comp, typename Proj>
+void powersort_merge_runs(I first, I last, NextRun& next_run, Comp& comp,
+                          Proj& proj)
+{
+    using D = iter_difference_t<I>;
+
+    const D n = last - first;
+    std::size_t buf_size = static_cast<std::size_t>(n - n / 2);
+    temporary_vector<iter_value_t<I>> buf(buf_size);
+    while (buf.capacity() == 0 && buf_size > powersort_min_run) {
+        buf_size /= 2;
+        buf = temporary_vector<iter_value_t<I>>(buf_size);
+    }
+
+    // The starts and node powers of the runs waiting to be merged. The
+    // powers increase strictly up the stack, so it never holds more than
+    // one run per bit of n.
+    constexpr int max_runs = std::numeric_limits<D>::digits + 1;
+    I run_begin[max_runs];
+    int run_power[max_runs];
+    int top = 0;
+
+    I begin1 = first;
+    I end1 = next_run(first);
+
+    while (end1 != last) {
+        I end2 = next_run(end1);
+        const int power = detail::powersort_node_power(
+            D(begin1 - first), D(end1 - begin1), D(end2 - end1), n);
+
+        while (top > 0 && run_power[top - 1] > power) {
+            --top;
+            detail::powersort_merge(run_begin[top], begin1, end1, buf, comp,
+                                    proj);
+            begin1 = run_begin[top];
+        }
+
+        run_begin[top] = begin1;
+        run_power[top] = power;
+        ++top;
+
+        begin1 = end1;
+        end1 = std::move(end2);
+    }
+
+    while (top > 0) {
+        --top;
+        detail::powersort_merge(run_begin[top], begin1, last, buf, comp, proj);
+        begin1 = run_begin[top];
+    }
+}
+
+// Stable sorts [first, last)
+template <typename I, typename Comp, typename Proj>
+void powersort(I first, I last, Comp& comp, Proj& proj)
+{
+    if (last - first <= powersort_min_run) {
+        detail::insertion_sort(std::move(first), std::move(last), comp, proj);
+        return;
+    }
+
+    auto next_run = [&](I it) {
+        return detail::powersort_next_run(std::move(it), last, comp, proj);
+    };
+    detail::powersort_merge_runs(std::move(first), last, next_run, comp, proj);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
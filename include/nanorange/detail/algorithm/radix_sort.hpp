@@ -0,0 +1,231 @@
+// nanorange/detail/algorithm/radix_sort.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/detail/functional/comparisons.hpp>
+#include <nanorange/detail/memory/temporary_vector.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <std::size_t Size>
+struct radix_uint;
+template <>
+struct radix_uint<1> { using type = std::uint8_t; };
+template <>
+struct radix_uint<2> { using type = std::uint16_t; };
+template <>
+struct radix_uint<4> { using type = std::uint32_t; };
+template <>
+struct radix_uint<8> { using type = std::uint64_t; };
+
+// Arithmetic types whose ordering under operator< can be reproduced by
+// comparing unsigned integers
+template <typename T>
+NANO_CONCEPT radix_key =
+    ((std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+     (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559)) &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+// Maps t to an unsigned integer, such that a < b iff to_radix_key(a) <
+// to_radix_key(b) (treating -0.0 and +0.0 as the same, and ordering
+// negative NaNs first and positive NaNs last)
+template <typename T>
+typename radix_uint<sizeof(T)>::type to_radix_key(T t)
+{
+    using U = typename radix_uint<sizeof(T)>::type;
+    constexpr U sign_bit = U(U{1} << (8 * sizeof(T) - 1));
+
+    if constexpr (std::is_unsigned_v<T>) {
+        return U(t);
+    } else if constexpr (std::is_integral_v<T>) {
+        return U(U(t) ^ sign_bit);
+    } else {
+        if (t == T{0}) {
+            t = T{0};
+        }
+        U u;
+        std::memcpy(&u, &t, sizeof(T));
+        // Negative floats are ordered backwards
+        return (u & sign_bit) ? U(~u) : U(u | sign_bit);
+    }
+}
+
+struct radix_sortable_concept {
+    template <typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename Comp, typename Proj>
+    static auto test(int) -> std::enable_if_t<
+        random_access_iterator<I> &&
+        (is_less_v<Comp> || is_greater_v<Comp>) &&
+        radix_key<remove_cvref_t<indirect_result_t<Proj&, I>>>,
+        std::true_type>;
+};
+
+// True if sorting [I, ...) by comp and proj may be done by comparing
+// unsigned integer keys
+template <typename I, typename Comp, typename Proj>
+NANO_CONCEPT radix_sortable =
+    decltype(radix_sortable_concept::test<I, Comp, Proj>(0))::value;
+
+// Stable LSD radix sort of [first, first + n), one byte of the unsigned key
+// key_of(elem) at a time. Returns false (without touching the range) if a
+// scratch buffer of n elements could not be allocated.
+template <typename K, typename I, typename KeyFn>
+bool radix_sort_by_key(I first, iter_difference_t<I> n, const KeyFn& key_of)
+{
+    using T = iter_value_t<I>;
+    constexpr std::size_t num_digits = sizeof(K);
+
+    const auto digit = [](K k, std::size_t d) {
+        return static_cast<std::size_t>((k >> (8 * d)) & 0xff);
+    };
+
+    temporary_vector<T> buf(static_cast<std::size_t>(n));
+    if (buf.capacity() == 0) {
+        return false;
+    }
+
+    // Build the histograms for every digit in a single pass, while moving
+    // the elements into the buffer
+    std::size_t counts[num_digits][256] = {};
+    I it = first;
+    for (iter_difference_t<I> i = 0; i < n; ++i, ++it) {
+        const K k = key_of(*it);
+        for (std::size_t d = 0; d < num_digits; d++) {
+            ++counts[d][digit(k, d)];
+        }
+        buf.emplace_back(nano::iter_move(it));
+    }
+
+    const auto scatter = [&](auto src, auto dst, std::size_t d,
+                             std::size_t (&offsets)[256]) {
+        for (iter_difference_t<I> i = 0; i < n; ++i, ++src) {
+            auto& pos = offsets[digit(key_of(*src), d)];
+            dst[static_cast<iter_difference_t<decltype(dst)>>(pos++)] =
+                nano::iter_move(src);
+        }
+    };
+
+    const K first_key = key_of(*buf.begin());
+    bool in_buf = true;
+
+    for (std::size_t d = 0; d < num_digits; d++) {
+        auto& offsets = counts[d];
+
+        // If every key has the same value for this digit, then this pass
+        // wouldn't change anything
+        if (offsets[digit(first_key, d)] == static_cast<std::size_t>(n)) {
+            continue;
+        }
+
+        std::size_t sum = 0;
+        for (std::size_t& c : offsets) {
+            const std::size_t count = c;
+            c = sum;
+            sum += count;
+        }
+
+        if (in_buf) {
+            scatter(buf.begin(), first, d, offsets);
+        } else {
+            scatter(first, buf.begin(), d, offsets);
+        }
+        in_buf = !in_buf;
+    }
+
+    if (in_buf) {
+        nano::move(buf.begin(), buf.end(), std::move(first));
+    }
+
+    return true;
+}
+
+// The unsigned key type used to radix sort [I, ...) using proj
+template <typename I, typename Proj>
+using radix_key_t = decltype(detail::to_radix_key(
+    std::declval<remove_cvref_t<indirect_result_t<Proj&, I>>>()));
+
+template <typename K>
+struct radix_keyed_index {
+    K key;
+    std::size_t index;
+};
+
+// True if radix_sort() moves the elements themselves on every pass, rather
+// than sorting their keys separately and then moving each element once
+template <typename I, typename Proj>
+constexpr bool radix_sort_is_direct =
+    sizeof(iter_value_t<I>) <= sizeof(radix_keyed_index<radix_key_t<I, Proj>>);
+
+// Sorts [first, first + n) by comp and proj, which must satisfy
+// radix_sortable. Returns false (without touching the range) if scratch
+// space could not be allocated.
+template <typename I, typename Comp, typename Proj>
+bool radix_sort(I first, iter_difference_t<I> n, Comp&, Proj& proj)
+{
+    using T = iter_value_t<I>;
+    using K = radix_key_t<I, Proj>;
+    using keyed = radix_keyed_index<K>;
+    constexpr bool descending = is_greater_v<Comp>;
+
+    const auto key_of = [&proj](auto&& elem) {
+        const K k = detail::to_radix_key(nano::invoke(proj, elem));
+        return descending ? K(~k) : k;
+    };
+
+    if (n < 2) {
+        return true;
+    }
+
+    if constexpr (radix_sort_is_direct<I, Proj>) {
+        return detail::radix_sort_by_key<K>(std::move(first), n, key_of);
+    } else {
+        // Moving large elements on every pass is expensive, so instead we
+        // sort their keys along with their original positions, and then
+        // move each element just once
+        const auto len = static_cast<std::size_t>(n);
+        temporary_vector<keyed> keys(len);
+        if (keys.capacity() == 0) {
+            return false;
+        }
+        I it = first;
+        for (std::size_t i = 0; i < len; ++i, ++it) {
+            keys.emplace_back(keyed{key_of(*it), i});
+        }
+
+        if (!detail::radix_sort_by_key<K>(
+                keys.begin(), n, [](const keyed& k) { return k.key; })) {
+            return false;
+        }
+
+        temporary_vector<T> buf(len);
+        if (buf.capacity() == 0) {
+            return false;
+        }
+        for (const keyed& k : keys) {
+            buf.emplace_back(nano::iter_move(
+                first + static_cast<iter_difference_t<I>>(k.index)));
+        }
+        nano::move(buf.begin(), buf.end(), std::move(first));
+        return true;
+    }
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,118 @@
+// nanorange/detail/algorithm/set_gallop.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The sorted-range set operations step through both of their ranges together,
+// which costs O(n + m) comparisons. When one range is much longer than the
+// other, most of those comparisons just skip over long stretches of the longer
+// range. As TimSort does when merging, once one range has supplied several
+// elements in a row we instead gallop through it, which finds the end of a
+// stretch of length k in O(log k) comparisons. How many elements in a row it
+// takes before we start galloping adapts to how well galloping has been
+// paying off.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SET_GALLOP_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SET_GALLOP_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/gallop.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <cstdint>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// A gallop which skips fewer elements than this did not pay off
+constexpr int set_min_gallop = 7;
+
+// Keeping count of the runs costs a little even when we never gallop, so we
+// only do so if one range is at least this many times longer than the other
+constexpr int set_gallop_min_ratio = 16;
+
+template <typename I, typename S>
+NANO_CONCEPT set_can_gallop = random_access_iterator<I> &&
+                              sized_sentinel_for<S, I>;
+
+// Returns the number of elements at the start of [first, last) which are
+// less than value
+template <typename I, typename S, typename T, typename Comp, typename Proj>
+constexpr iter_difference_t<I> set_gallop(I first, S last, const T& value,
+                                           Comp& comp, Proj& proj)
+{
+    return detail::gallop_prefix(first, iter_difference_t<I>(last - first),
+                                 [&](auto&& x) {
+                                     return nano::invoke(
+                                         comp, nano::invoke(proj, x), value);
+                                 });
+}
+
+// Whether to look for chances to gallop. If we cannot tell the lengths of
+// the ranges, we always do.
+template <typename I1, typename S1, typename I2, typename S2>
+constexpr bool set_should_gallop(const I1& first1, const S1& last1,
+                                 const I2& first2, const S2& last2)
+{
+    if constexpr (sized_sentinel_for<S1, I1> && sized_sentinel_for<S2, I2>) {
+        const auto n1 = static_cast<std::uint64_t>(last1 - first1);
+        const auto n2 = static_cast<std::uint64_t>(last2 - first2);
+        return n1 / set_gallop_min_ratio >= n2 ||
+               n2 / set_gallop_min_ratio >= n1;
+    } else {
+        return true;
+    }
+}
+
+// Counts how many elements in a row each range has supplied, and decides
+// when to gallop
+class set_gallop_counter {
+public:
+    // Records that the first range supplied an element, and returns whether
+    // to gallop through it
+    constexpr bool step1()
+    {
+        run2_ = 0;
+        return ++run1_ >= min_gallop_;
+    }
+
+    // As step1(), for the second range
+    constexpr bool step2()
+    {
+        run1_ = 0;
+        return ++run2_ >= min_gallop_;
+    }
+
+    // Records that both ranges supplied an element
+    constexpr void step_both()
+    {
+        run1_ = 0;
+        run2_ = 0;
+    }
+
+    // Records that a gallop skipped n elements. We gallop sooner after a
+    // gallop which paid off, and later after one which did not.
+    template <typename D>
+    constexpr void galloped(D n)
+    {
+        run1_ = 0;
+        run2_ = 0;
+        if (n >= set_min_gallop) {
+            min_gallop_ -= min_gallop_ > 1 ? 1 : 0;
+        } else {
+            ++min_gallop_;
+        }
+    }
+
+private:
+    int min_gallop_ = set_min_gallop;
+    int run1_ = 0;
+    int run2_ = 0;
+};
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
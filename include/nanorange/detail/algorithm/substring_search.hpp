@@ -0,0 +1,306 @@
+// nanorange/detail/algorithm/substring_search.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SUBSTRING_SEARCH_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SUBSTRING_SEARCH_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/bitwise_compare.hpp>
+#include <nanorange/detail/algorithm/find_value.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Kernels for search() on contiguous ranges of integers. Each of them returns
+// the index in the haystack of the first occurrence of the (non-empty)
+// needle, or the haystack length if there is none.
+
+// Compares the first and last elements of the needle against a vector's worth
+// of candidate positions at once, and only checks the middle of the needle
+// at positions where both match (W. Mula, "SIMD-friendly algorithms for
+// substring searching"). This is very fast for short needles, whose
+// occurrences are rarely far apart.
+template <typename E>
+std::size_t search_first_last_n(const E* hay, std::size_t n, const E* needle,
+                                std::size_t m)
+{
+    static_assert(simd::vectorizable_integral<E>);
+
+    const E first = needle[0];
+    const E last = needle[m - 1];
+    const auto middle_matches = [&](std::size_t i) {
+        return m <= 2 || detail::equal_n(hay + i + 1, needle + 1, m - 2);
+    };
+
+    std::size_t i = 0;
+#ifdef NANO_HAS_SIMD
+    constexpr std::size_t per_vec = simd::width / sizeof(E);
+    constexpr std::uint32_t elem_bits = (1u << sizeof(E)) - 1;
+    const simd::vec first_v = simd::splat(first);
+    const simd::vec last_v = simd::splat(last);
+
+    for (; i + m - 1 + per_vec <= n; i += per_vec) {
+        std::uint32_t mask = simd::movemask(simd::bit_and(
+            simd::cmpeq<sizeof(E)>(simd::load(hay + i), first_v),
+            simd::cmpeq<sizeof(E)>(simd::load(hay + i + m - 1), last_v)));
+
+        while (mask != 0) {
+            const int bit = simd::ctz(mask);
+            const std::size_t pos = i + static_cast<std::size_t>(bit) / sizeof(E);
+            if (middle_matches(pos)) {
+                return pos;
+            }
+            mask &= ~(elem_bits << bit);
+        }
+    }
+#endif
+    for (; i + m <= n; ++i) {
+        if (hay[i] == first && hay[i + m - 1] == last && middle_matches(i)) {
+            return i;
+        }
+    }
+    return n;
+}
+
+// Boyer-Moore-Horspool for single-byte elements: on a mismatch, skip ahead
+// according to the haystack byte aligned with the end of the needle.
+// Sublinear on average for long needles.
+struct horspool_table {
+    std::size_t shift[256];
+
+    template <typename E>
+    void init(const E* needle, std::size_t m)
+    {
+        static_assert(sizeof(E) == 1);
+
+        for (std::size_t& s : shift) {
+            s = m;
+        }
+        for (std::size_t i = 0; i + 1 < m; i++) {
+            shift[static_cast<unsigned char>(needle[i])] = m - 1 - i;
+        }
+    }
+};
+
+template <typename E>
+std::size_t search_horspool_n(const E* hay, std::size_t n, const E* needle,
+                              std::size_t m, const horspool_table& table)
+{
+    const E last = needle[m - 1];
+
+    for (std::size_t i = 0; i + m <= n;) {
+        const E e = hay[i + m - 1];
+        if (e == last && detail::equal_n(hay + i, needle, m - 1)) {
+            return i;
+        }
+        i += table.shift[static_cast<unsigned char>(e)];
+    }
+    return n;
+}
+
+// Crochemore-Perrin Two-Way. Linear time in the worst case and constant
+// space, so we use it for long needles of wider integers, for which a
+// Horspool table would be unwieldy.
+struct two_way_factorization {
+    // The needle is split as [0, split) + [split, m)
+    std::size_t split = 0;
+    std::size_t period = 0;
+    bool periodic = false;
+
+    template <typename E>
+    void init(const E* needle, std::size_t m)
+    {
+        std::size_t p1 = 0, p2 = 0;
+        const std::size_t s1 = maximal_suffix(needle, m, p1, false);
+        const std::size_t s2 = maximal_suffix(needle, m, p2, true);
+        if (s1 > s2) {
+            split = s1;
+            period = p1;
+        } else {
+            split = s2;
+            period = p2;
+        }
+
+        // If the left part of the needle occurs again one period later then
+        // the whole needle is periodic, and we must remember how much of it
+        // we have already matched when we shift by the period. Otherwise,
+        // we can always shift past the longer of the two parts.
+        periodic = split + period <= m &&
+                   detail::equal_n(needle, needle + period, split);
+        if (!periodic) {
+            period = (split > m - split ? split : m - split) + 1;
+        }
+    }
+
+private:
+    // Returns the start of the maximal suffix of the needle according to
+    // the element order (or its reverse), and sets period to its period
+    template <typename E>
+    static std::size_t maximal_suffix(const E* needle, std::size_t m,
+                                      std::size_t& period, bool reversed)
+    {
+        // Index of the character before the current maximal suffix, using
+        // unsigned wraparound for "before the beginning"
+        std::size_t ms = static_cast<std::size_t>(-1);
+        std::size_t j = 0;
+        std::size_t k = 1;
+        period = 1;
+
+        while (j + k < m) {
+            const E a = needle[j + k];
+            const E b = needle[ms + k];
+            if (reversed ? b < a : a < b) {
+                j += k;
+                k = 1;
+                period = j - ms;
+            } else if (a == b) {
+                if (k != period) {
+                    ++k;
+                } else {
+                    j += period;
+                    k = 1;
+                }
+            } else {
+                ms = j++;
+                k = period = 1;
+            }
+        }
+        return ms + 1;
+    }
+};
+
+template <typename E>
+std::size_t search_two_way_n(const E* hay, std::size_t n, const E* needle,
+                             std::size_t m, const two_way_factorization& fac)
+{
+    const std::size_t split = fac.split;
+    const std::size_t period = fac.period;
+    // Number of elements at the start of the needle known to match the
+    // current window; only ever non-zero for periodic needles
+    std::size_t memory = 0;
+
+    for (std::size_t j = 0; j + m <= n;) {
+        // Match the right part from left to right...
+        std::size_t i = split > memory ? split : memory;
+        while (i < m && needle[i] == hay[i + j]) {
+            ++i;
+        }
+        if (i < m) {
+            j += i - split + 1;
+            memory = 0;
+            continue;
+        }
+
+        // ...then the left part from right to left
+        i = split;
+        while (i > memory && needle[i - 1] == hay[i - 1 + j]) {
+            --i;
+        }
+        if (i <= memory) {
+            return j;
+        }
+        j += period;
+        if (fac.periodic) {
+            memory = m - period;
+        }
+    }
+    return n;
+}
+
+// A preprocessed needle, which picks the most suitable of the kernels above
+// according to the element type and needle length. This stores a pointer to
+// the needle, which must outlive it.
+template <typename E>
+class substring_searcher {
+    static_assert(simd::vectorizable_integral<E>);
+
+    struct no_table {
+        template <typename T>
+        void init(const T*, std::size_t) {}
+    };
+
+    using table_type =
+        std::conditional_t<sizeof(E) == 1, horspool_table, no_table>;
+
+    enum class strategy { element, first_last, horspool, two_way };
+
+public:
+    // Needles up to this length are searched for using first_last
+    static constexpr std::size_t first_last_max = 32;
+
+    substring_searcher() = default;
+
+    // Precondition: m > 0
+    substring_searcher(const E* needle, std::size_t m)
+        : needle_(needle), size_(m)
+    {
+        if (m == 1) {
+            strategy_ = strategy::element;
+        }
+#ifdef NANO_HAS_SIMD
+        else if (m <= first_last_max) {
+            strategy_ = strategy::first_last;
+        }
+#endif
+        else if constexpr (sizeof(E) == 1) {
+            strategy_ = strategy::horspool;
+            table_.init(needle, m);
+        } else {
+            strategy_ = strategy::two_way;
+            two_way_.init(needle, m);
+        }
+    }
+
+    // Whether this has been initialised with a needle
+    bool ready() const { return needle_ != nullptr; }
+
+    std::size_t size() const { return size_; }
+
+    std::size_t search(const E* hay, std::size_t n) const
+    {
+        if (n < size_) {
+            return n;
+        }
+
+        switch (strategy_) {
+        case strategy::element:
+            return static_cast<std::size_t>(
+                detail::find_value_n(hay, n, needle_[0]) - hay);
+        case strategy::first_last:
+            return detail::search_first_last_n(hay, n, needle_, size_);
+        case strategy::horspool:
+            if constexpr (sizeof(E) == 1) {
+                return detail::search_horspool_n(hay, n, needle_, size_,
+                                                 table_);
+            }
+            break;
+        case strategy::two_way:
+            return detail::search_two_way_n(hay, n, needle_, size_, two_way_);
+        }
+        return n;
+    }
+
+private:
+    const E* needle_ = nullptr;
+    std::size_t size_ = 0;
+    strategy strategy_ = strategy::element;
+    table_type table_{};
+    two_way_factorization two_way_{};
+};
+
+// True if search(first1, last1, first2, last2, pred, proj1, proj2) may use
+// substring_searcher
+template <typename I1, typename S1, typename I2, typename S2, typename Pred,
+          typename Proj1, typename Proj2>
+NANO_CONCEPT substring_searchable =
+    is_equal_to_v<Pred> && sized_sentinel_for<S1, I1> &&
+    sized_sentinel_for<S2, I2> && bitwise_comparable<I1, I2, Pred, Proj1, Proj2>;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,168 @@
+// nanorange/detail/algorithm/unrolled_reduce.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Kernels for reduce(), transform_reduce() and the scans. Summing a range
+// into one accumulator makes each addition wait for the one before, so the
+// loop runs at the latency of the addition rather than its throughput, and
+// for floating point numbers the compiler may not reorder the additions to
+// vectorise them. As reduce() may group and reorder the operations however
+// it likes, on random access ranges we instead keep several accumulators,
+// which are independent of each other, and combine them at the end. The
+// scans may not reorder the operations, so for them each accumulator takes
+// a contiguous part of the range instead of every k-th element.
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_UNROLLED_REDUCE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_UNROLLED_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/concepts/movable.hpp>
+#include <nanorange/detail/concepts/object.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+#include <nanorange/detail/functional/invoke.hpp>
+#include <nanorange/detail/iterator/projected.hpp>
+
+#include <array>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct reduce_operation_concept {
+    template <typename, typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename Op, typename T, typename U>
+    static auto test(int) -> std::enable_if_t<
+        movable<T> && convertible_to<U, T> &&
+        invocable<Op&, T, U> && invocable<Op&, T, T> &&
+        convertible_to<invoke_result_t<Op&, T, U>, T> &&
+        convertible_to<invoke_result_t<Op&, T, T>, T>,
+        std::true_type>;
+};
+
+// True if op may be used to reduce values of type U into an accumulator of
+// type T, in any grouping: op(T, U) and op(T, T) must both give a T
+template <typename Op, typename T, typename U>
+NANO_CONCEPT reduce_operation =
+    decltype(reduce_operation_concept::test<Op, T, U>(0))::value;
+
+// The value and reference types of the elements of I seen through Proj
+template <typename I, typename Proj>
+using projected_value_t = iter_value_t<projected<I, Proj>>;
+
+template <typename I, typename Proj>
+using projected_reference_t = iter_reference_t<projected<I, Proj>>;
+
+// The i-th element of a random access range seen through proj, as elem(i)
+// for the kernels below. Where proj gives an rvalue reference, it may be to
+// a temporary which does not outlive the call, so we return a copy.
+template <typename I, typename Proj>
+struct projected_element {
+    I first;
+    Proj& proj;
+
+    template <typename D, typename R = decltype(nano::invoke(
+                              std::declval<Proj&>(),
+                              std::declval<const I&>()[std::declval<D>()]))>
+    constexpr std::conditional_t<std::is_rvalue_reference_v<R>,
+                                 remove_cvref_t<R>, R>
+    operator()(D i) const
+    {
+        return nano::invoke(proj, first[i]);
+    }
+};
+
+// The number of accumulators we keep. Eight is enough to hide the latency
+// of a floating point addition on current hardware, and small enough to
+// stay in registers.
+inline constexpr std::size_t reduce_accumulators = 8;
+
+template <typename T, typename D, typename Elem, std::size_t... Idx>
+constexpr std::array<T, sizeof...(Idx)>
+make_accumulators(Elem& elem, std::index_sequence<Idx...>)
+{
+    return {{T(elem(static_cast<D>(Idx)))...}};
+}
+
+// Combines elem(0), ..., elem(n - 1) with op, in some order, where n > 0
+template <typename T, typename D, typename Op, typename Elem>
+constexpr T unrolled_reduce(D n, Op& op, Elem& elem)
+{
+    constexpr std::size_t k = reduce_accumulators;
+
+    if (n < static_cast<D>(2 * k)) {
+        T acc(elem(D{0}));
+        for (D i = 1; i < n; ++i) {
+            acc = nano::invoke(op, std::move(acc), elem(i));
+        }
+        return acc;
+    }
+
+    std::array<T, k> acc =
+        detail::make_accumulators<T, D>(elem, std::make_index_sequence<k>{});
+    D i = static_cast<D>(k);
+    for (; n - i >= static_cast<D>(k); i += static_cast<D>(k)) {
+        for (std::size_t j = 0; j < k; ++j) {
+            acc[j] = nano::invoke(op, std::move(acc[j]),
+                                  elem(i + static_cast<D>(j)));
+        }
+    }
+    for (std::size_t w = k / 2; w > 0; w /= 2) {
+        for (std::size_t j = 0; j < w; ++j) {
+            acc[j] = nano::invoke(op, std::move(acc[j]), std::move(acc[j + w]));
+        }
+    }
+
+    T result = std::move(acc[0]);
+    for (; i < n; ++i) {
+        result = nano::invoke(op, std::move(result), elem(i));
+    }
+    return result;
+}
+
+// As unrolled_reduce(), but combining elem(0), ..., elem(n - 1) in order,
+// so that op need only be associative
+template <typename T, typename D, typename Op, typename Elem>
+constexpr T ordered_reduce(D n, Op& op, Elem& elem)
+{
+    constexpr std::size_t k = reduce_accumulators;
+
+    if (n < static_cast<D>(2 * k)) {
+        T acc(elem(D{0}));
+        for (D i = 1; i < n; ++i) {
+            acc = nano::invoke(op, std::move(acc), elem(i));
+        }
+        return acc;
+    }
+
+    // Accumulator j takes [j * m, (j + 1) * m), and the last one also
+    // takes what is left over
+    const D m = n / static_cast<D>(k);
+    auto first_of_part = [&](D j) -> decltype(auto) { return elem(j * m); };
+    std::array<T, k> acc = detail::make_accumulators<T, D>(
+        first_of_part, std::make_index_sequence<k>{});
+    for (D i = 1; i < m; ++i) {
+        for (std::size_t j = 0; j < k; ++j) {
+            acc[j] = nano::invoke(op, std::move(acc[j]),
+                                  elem(static_cast<D>(j) * m + i));
+        }
+    }
+
+    T result = std::move(acc[0]);
+    for (std::size_t j = 1; j < k; ++j) {
+        result = nano::invoke(op, std::move(result), std::move(acc[j]));
+    }
+    for (D i = static_cast<D>(k) * m; i < n; ++i) {
+        result = nano::invoke(op, std::move(result), elem(i));
+    }
+    return result;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,109 @@
+// nanorange/detail/execution/parallel_for.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_EXECUTION_PARALLEL_FOR_HPP_INCLUDED
+#define NANORANGE_DETAIL_EXECUTION_PARALLEL_FOR_HPP_INCLUDED
+
+#include <nanorange/detail/execution/thread_pool.hpp>
+#include <nanorange/detail/iterator/concepts.hpp>
+#include <nanorange/execution.hpp>
+
+#include <atomic>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The smallest number of elements which is worth handing to another thread
+// for the cheap, per-element work done by most of the parallel algorithms
+inline constexpr std::size_t parallel_min_grain = 4096;
+
+// True if an algorithm called with policy EP over [I, S) may split the range
+// into pieces to be processed on the thread pool. Otherwise, it runs
+// sequentially.
+template <typename EP, typename I, typename S>
+NANO_CONCEPT parallelizable = is_parallel_policy_v<EP> &&
+                              random_access_iterator<I> &&
+                              sized_sentinel_for<S, I>;
+
+// The number of pieces in which to process n elements, each of which should
+// have at least min_grain elements. We use a few pieces per thread, so that
+// the load is balanced if some pieces take longer than others. With only one
+// thread there is nothing to gain from splitting the range at all.
+inline std::size_t parallel_chunk_count(std::size_t n,
+                                        std::size_t min_grain = parallel_min_grain)
+{
+    const std::size_t threads = default_thread_pool().concurrency();
+    const std::size_t max_chunks = threads > 1 ? threads * 4 : 1;
+    const std::size_t chunks = n / (min_grain > 0 ? min_grain : 1);
+    return chunks < 1 ? 1 : chunks < max_chunks ? chunks : max_chunks;
+}
+
+// The start of the i-th of num_chunks nearly-equal pieces of [0, n)
+template <typename D>
+D parallel_chunk_begin(D n, std::size_t num_chunks, std::size_t i)
+{
+    const D size = n / static_cast<D>(num_chunks);
+    const D rem = n % static_cast<D>(num_chunks);
+    const D idx = static_cast<D>(i);
+    return idx * size + (idx < rem ? idx : rem);
+}
+
+// Splits [0, n) into num_chunks pieces and calls fn(i, begin, end) for
+// each of them on the thread pool, returning when all have finished
+template <typename D, typename F>
+void parallel_for_chunks(D n, std::size_t num_chunks, F&& fn)
+{
+    auto task = [&](std::size_t i) {
+        fn(i, detail::parallel_chunk_begin(n, num_chunks, i),
+           detail::parallel_chunk_begin(n, num_chunks, i + 1));
+    };
+    default_thread_pool().run(num_chunks, task);
+}
+
+// Calls fn(begin, end) over pieces of [0, n) on the thread pool
+template <typename D, typename F>
+void parallel_for(D n, F&& fn, std::size_t min_grain = parallel_min_grain)
+{
+    const std::size_t num_chunks =
+        detail::parallel_chunk_count(static_cast<std::size_t>(n), min_grain);
+    detail::parallel_for_chunks(n, num_chunks, [&fn](std::size_t, D b, D e) {
+        fn(b, e);
+    });
+}
+
+// Returns the first position in [0, n) found by scan, or n if there is none.
+// scan(b, e) must return the first match in [b, e), or e. The pieces are
+// scanned a block at a time, so that a piece can stop early once a match
+// has been found before it.
+template <typename D, typename Scan>
+D parallel_find(D n, Scan scan, std::size_t min_grain = parallel_min_grain)
+{
+    constexpr D block = 1024;
+    std::atomic<D> found{n};
+
+    detail::parallel_for(n, [&](D b, D e) {
+        while (b < e && b < found.load(std::memory_order_relaxed)) {
+            const D stop = e - b > block ? b + block : e;
+            const D pos = scan(b, stop);
+            if (pos != stop) {
+                D prev = found.load(std::memory_order_relaxed);
+                while (pos < prev && !found.compare_exchange_weak(prev, pos)) {
+                }
+                return;
+            }
+            b = stop;
+        }
+    }, min_grain);
+
+    return found.load();
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,83 @@
+// nanorange/detail/execution/parallel_scan.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_EXECUTION_PARALLEL_SCAN_HPP_INCLUDED
+#define NANORANGE_DETAIL_EXECUTION_PARALLEL_SCAN_HPP_INCLUDED
+
+#include <nanorange/detail/execution/parallel_for.hpp>
+#include <nanorange/detail/functional/invoke.hpp>
+
+#include <optional>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Combines init with the reductions of the pieces of [0, n), in order, where
+// reduce(b, e) reduces the non-empty piece [b, e) on the thread pool. op must
+// be associative.
+template <typename T, typename D, typename Op, typename Reduce>
+T parallel_reduce(D n, T init, Op& op, Reduce reduce)
+{
+    if (n == 0) {
+        return init;
+    }
+
+    const std::size_t num_chunks =
+        detail::parallel_chunk_count(static_cast<std::size_t>(n));
+    std::vector<std::optional<T>> partial(num_chunks);
+    detail::parallel_for_chunks(n, num_chunks, [&](std::size_t i, D b, D e) {
+        partial[i].emplace(reduce(b, e));
+    });
+
+    for (auto& p : partial) {
+        init = nano::invoke(op, std::move(init), std::move(*p));
+    }
+    return init;
+}
+
+// Scans [0, n) on the thread pool in two passes over the same pieces. The
+// first pass reduces each piece but the last with reduce(b, e), and from
+// those we work out the carry into each piece: the reduction of init and
+// all the elements before it, or nothing at the start of an inclusive scan
+// with no init. The second pass scans each piece with scan(b, e, carry),
+// which writes its output. op must be associative.
+template <typename T, typename D, typename Op, typename Reduce, typename Scan>
+void parallel_scan(D n, std::optional<T> init, Op& op, Reduce reduce,
+                   Scan scan)
+{
+    const std::size_t num_chunks =
+        detail::parallel_chunk_count(static_cast<std::size_t>(n));
+    if (num_chunks == 1) {
+        scan(D{0}, n, init);
+        return;
+    }
+
+    std::vector<std::optional<T>> carry(num_chunks);
+    detail::parallel_for_chunks(n, num_chunks, [&](std::size_t i, D b, D e) {
+        if (i + 1 < num_chunks) {
+            carry[i + 1].emplace(reduce(b, e));
+        }
+    });
+
+    carry[0] = std::move(init);
+    for (std::size_t i = 1; i < num_chunks; ++i) {
+        if (carry[i - 1]) {
+            carry[i] = nano::invoke(op, *carry[i - 1], std::move(*carry[i]));
+        }
+    }
+
+    detail::parallel_for_chunks(n, num_chunks, [&](std::size_t i, D b, D e) {
+        scan(b, e, carry[i]);
+    });
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,191 @@
+// nanorange/detail/execution/thread_pool.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_EXECUTION_THREAD_POOL_HPP_INCLUDED
+#define NANORANGE_DETAIL_EXECUTION_THREAD_POOL_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// A fixed set of worker threads which cooperate with the calling thread to
+// run batches of tasks. The caller always takes part in running its own
+// batch, and while it waits for other threads to finish their share it helps
+// with any other batches which are queued. So a task may itself submit a
+// batch (as the recursive parallel sorts do) without risk of deadlock, and
+// without leaving threads idle.
+class thread_pool {
+    // A batch of n tasks, which threads claim one at a time
+    struct job {
+        std::size_t n;
+        void (*call)(void*, std::size_t);
+        void* fn;
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+
+        bool finished() const { return done.load() == n; }
+    };
+
+public:
+    explicit thread_pool(std::size_t num_workers)
+    {
+        workers_.reserve(num_workers);
+        for (std::size_t i = 0; i < num_workers; i++) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& t : workers_) {
+            t.join();
+        }
+    }
+
+    // The number of threads which may run tasks, including the caller
+    std::size_t concurrency() const { return workers_.size() + 1; }
+
+    // Calls fn(i) for each i in [0, n), possibly concurrently, and returns
+    // once all of the calls have completed
+    template <typename F>
+    void run(std::size_t n, F& fn)
+    {
+        if (n == 1 || workers_.empty()) {
+            for (std::size_t i = 0; i < n; i++) {
+                fn(i);
+            }
+            return;
+        }
+
+        const auto j = std::make_shared<job>();
+        j->n = n;
+        j->call = [](void* f, std::size_t i) { (*static_cast<F*>(f))(i); };
+        j->fn = std::addressof(fn);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(j);
+        }
+        if (n - 1 < workers_.size()) {
+            for (std::size_t i = 0; i < n - 1; i++) {
+                wake_.notify_one();
+            }
+        } else {
+            wake_.notify_all();
+        }
+
+        work(j);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!j->finished()) {
+            if (!jobs_.empty()) {
+                const std::shared_ptr<job> other = jobs_.front();
+                lock.unlock();
+                work(other);
+                lock.lock();
+            } else {
+                wake_.wait(lock);
+            }
+        }
+    }
+
+private:
+    void worker_loop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return;
+            }
+            // Leave the job queued, so that other threads can join in
+            const std::shared_ptr<job> j = jobs_.front();
+            lock.unlock();
+            work(j);
+            lock.lock();
+        }
+    }
+
+    // Runs tasks from j until they have all been claimed, then takes it off
+    // the queue. As for the standard parallel algorithms, an exception
+    // escaping from a task calls std::terminate().
+    void work(const std::shared_ptr<job>& j) noexcept
+    {
+        bool completed = false;
+        for (std::size_t i; (i = j->next.fetch_add(1)) < j->n;) {
+            j->call(j->fn, i);
+            if (j->done.fetch_add(1) + 1 == j->n) {
+                completed = true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = std::find(jobs_.begin(), jobs_.end(), j);
+            if (it != jobs_.end()) {
+                jobs_.erase(it);
+            }
+        }
+        // Wake the thread waiting for this job to complete
+        if (completed) {
+            wake_.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<job>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+// The number of worker threads in the default pool: one fewer than the
+// hardware concurrency, since the calling thread does its share, unless the
+// NANORANGE_NUM_THREADS environment variable says otherwise
+inline std::size_t default_thread_pool_workers()
+{
+    if (const char* env = std::getenv("NANORANGE_NUM_THREADS")) {
+        const long n = std::strtol(env, nullptr, 10);
+        if (n > 0) {
+            return static_cast<std::size_t>(n) - 1;
+        }
+    }
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? hw - 1 : 0;
+}
+
+// The pool used by the parallel algorithms, which is started on first use
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool(detail::default_thread_pool_workers());
+    return pool;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
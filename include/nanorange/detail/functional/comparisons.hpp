@@ -83,6 +83,42 @@ struct less_equal {
     using is_transparent = std::true_type;
 };
 
+namespace detail {
+
+// Traits identifying the standard comparison function objects, for
+// algorithms which have faster implementations when the comparison is known
+template <typename>
+struct is_equal_to : std::false_type {};
+template <>
+struct is_equal_to<nano::equal_to> : std::true_type {};
+template <>
+struct is_equal_to<std::equal_to<>> : std::true_type {};
+
+template <typename T>
+constexpr bool is_equal_to_v = is_equal_to<remove_cvref_t<T>>::value;
+
+template <typename>
+struct is_less : std::false_type {};
+template <>
+struct is_less<nano::less> : std::true_type {};
+template <>
+struct is_less<std::less<>> : std::true_type {};
+
+template <typename T>
+constexpr bool is_less_v = is_less<remove_cvref_t<T>>::value;
+
+template <typename>
+struct is_greater : std::false_type {};
+template <>
+struct is_greater<nano::greater> : std::true_type {};
+template <>
+struct is_greater<std::greater<>> : std::true_type {};
+
+template <typename T>
+constexpr bool is_greater_v = is_greater<remove_cvref_t<T>>::value;
+
+} // namespace detail
+
 NANO_END_NAMESPACE
 
 #endif
\ No newline at end of file
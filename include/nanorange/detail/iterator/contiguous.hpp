@@ -0,0 +1,79 @@
+// nanorange/detail/iterator/contiguous.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ITERATOR_CONTIGUOUS_HPP_INCLUDED
+#define NANORANGE_DETAIL_ITERATOR_CONTIGUOUS_HPP_INCLUDED
+
+#include <nanorange/detail/iterator/concepts.hpp>
+
+#include <memory>
+
+// In C++17 the standard library containers don't advertise contiguity through
+// their iterator categories, so vector<T>::iterator is "only" random-access.
+// We recognise the (pointer-wrapping) iterator types used by libstdc++ and
+// libc++ for vector, string, string_view and span so that our contiguous
+// fast paths still fire for them. As with the forward declarations in
+// detail/ranges/concepts.hpp, define NANORANGE_NO_STD_FORWARD_DECLARATIONS
+// to turn this off.
+#ifndef NANORANGE_NO_STD_FORWARD_DECLARATIONS
+#if defined(_LIBCPP_VERSION)
+NANO_BEGIN_NAMESPACE_STD
+template <typename> class __wrap_iter;
+NANO_END_NAMESPACE_STD
+#elif defined(__GLIBCXX__)
+namespace __gnu_cxx {
+template <typename, typename> class __normal_iterator;
+}
+#endif
+#endif
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename I>
+struct wrapped_pointer : std::false_type {};
+
+#ifndef NANORANGE_NO_STD_FORWARD_DECLARATIONS
+#if defined(_LIBCPP_VERSION)
+template <typename P>
+struct wrapped_pointer<std::__wrap_iter<P>> : std::is_pointer<P> {};
+#elif defined(__GLIBCXX__)
+template <typename P, typename C>
+struct wrapped_pointer<__gnu_cxx::__normal_iterator<P, C>>
+    : std::is_pointer<P> {};
+#endif
+#endif
+
+// An iterator whose elements we know to be laid out contiguously in memory,
+// either because it says so or because it's a standard library iterator
+// which wraps a plain pointer
+template <typename I>
+NANO_CONCEPT memory_contiguous_iterator =
+    contiguous_iterator<I> ||
+    (wrapped_pointer<I>::value && random_access_iterator<I>);
+
+// Returns a pointer to the element denoted by i.
+// Precondition: i is dereferenceable
+template <typename I>
+constexpr auto to_address(const I& i)
+{
+    static_assert(memory_contiguous_iterator<I>);
+
+    if constexpr (std::is_pointer_v<I>) {
+        return i;
+    } else if constexpr (wrapped_pointer<I>::value) {
+        return i.base();
+    } else {
+        return std::addressof(*i);
+    }
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,60 @@
+// nanorange/detail/iterator/segmented.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ITERATOR_SEGMENTED_HPP_INCLUDED
+#define NANORANGE_DETAIL_ITERATOR_SEGMENTED_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <type_traits>
+#include <utility>
+
+// A segmented iterator walks a sequence of ranges one after another, as
+// concat_view's does, and so must check at every step whether it has reached
+// the end of the current range. Algorithms can avoid that by running over
+// each of the ranges in turn with its own iterators instead.
+//
+// An iterator I opts in by providing, for the sentinels S it supports, a
+// function found by ADL
+//
+//     I for_each_segment(I first, S last, F&& f);
+//
+// which calls f(seg_first, seg_last) for each of the segments making up
+// [first, last), where seg_first and seg_last delimit a part of one of the
+// underlying ranges. f returns the position it reached in that range, which
+// must be seg_last (or equivalent) unless the segment was the last;
+// for_each_segment returns that final position as an I.
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct segmented_iterator_concept {
+    // Stands in for the algorithm when testing for for_each_segment()
+    struct probe {
+        template <typename I, typename S>
+        I operator()(I, S) const;
+    };
+
+    template <typename, typename>
+    static auto test(long) -> std::false_type;
+
+    template <typename I, typename S>
+    static auto test(int) -> decltype(
+        for_each_segment(std::declval<I>(), std::declval<S>(),
+                         std::declval<probe&>()),
+        std::true_type{});
+};
+
+template <typename I, typename S>
+NANO_CONCEPT segmented_iterator =
+    decltype(segmented_iterator_concept::test<I, S>(0))::value;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
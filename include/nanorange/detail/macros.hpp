@@ -27,6 +27,19 @@
 #define NANO_NO_UNIQUE_ADDRESS
 #endif // defined(__has_cpp_attribute)
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif // __has_builtin(__builtin_is_constant_evaluated)
+#endif // defined(__has_builtin)
+
+#if !defined(NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
 #define NANO_CONCEPT inline constexpr bool
 
 #define NANO_BEGIN_NAMESPACE                                                   \
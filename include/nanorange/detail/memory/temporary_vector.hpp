@@ -70,6 +70,14 @@ public:
         ++end_;
     }
 
+    // Takes ownership of elements which the caller has constructed directly
+    // in the storage, so that the first n slots are now in the vector
+    void set_size(std::size_t n)
+    {
+        assert(n <= capacity());
+        end_ = start_.get() + n;
+    }
+
     T* begin() { return start_.get(); }
     const T* begin() const { return start_.get(); }
     T* end() { return end_; }
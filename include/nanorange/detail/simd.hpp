@@ -0,0 +1,490 @@
+// nanorange/detail/simd.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_SIMD_HPP_INCLUDED
+#define NANORANGE_DETAIL_SIMD_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// A very thin layer over the x86 vector intrinsics used by our contiguous
+// fast paths. The instruction set is chosen at compile time: AVX2 if the
+// compiler has been told it may use it (e.g. -mavx2 or /arch:AVX2), otherwise
+// SSE2 on any x86 target which has it. Elsewhere (or if the user defines
+// NANORANGE_NO_SIMD) only the scalar fallbacks are used. The few kernels which
+// gain from AVX-512 instructions use them too if they are enabled, but the
+// vector type below stays 256 bits wide.
+#ifndef NANORANGE_NO_SIMD
+#if defined(__AVX2__)
+#define NANO_SIMD_AVX2 1
+#define NANO_HAS_SIMD 1
+#if defined(__AVX512F__)
+#define NANO_SIMD_AVX512 1
+#endif
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||             \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NANO_SIMD_SSE2 1
+#define NANO_HAS_SIMD 1
+#include <emmintrin.h>
+#endif
+#endif // NANORANGE_NO_SIMD
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+namespace simd {
+
+// Index of the lowest set bit. Precondition: x != 0
+inline int ctz(std::uint32_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+// Index of the lowest set bit. Precondition: x != 0
+inline int ctz64(std::uint64_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return static_cast<int>(idx);
+#elif defined(_MSC_VER) && !defined(__clang__)
+    const auto lo = static_cast<std::uint32_t>(x);
+    return lo != 0 ? ctz(lo) : 32 + ctz(static_cast<std::uint32_t>(x >> 32));
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+// Index of the highest set bit. Precondition: x != 0
+inline int highest_bit(std::uint32_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx;
+    _BitScanReverse(&idx, x);
+    return static_cast<int>(idx);
+#else
+    return 31 - __builtin_clz(x);
+#endif
+}
+
+// Hints that the cache line containing p will soon be read. This is only a
+// hint, so p need not point to a valid object.
+inline void prefetch(const void* p)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(NANO_HAS_SIMD)
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void) p;
+#endif
+#else
+    __builtin_prefetch(p);
+#endif
+}
+
+inline int popcount(std::uint32_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    return static_cast<int>((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#else
+    return __builtin_popcount(x);
+#endif
+}
+
+// Integral types which our vector kernels can handle, by bit pattern
+template <typename T>
+NANO_CONCEPT vectorizable_integral =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+#if defined(NANO_SIMD_AVX2)
+
+using vec = __m256i;
+inline constexpr std::size_t width = 32;
+
+inline vec load(const void* p)
+{
+    return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+}
+
+// One bit per byte
+inline std::uint32_t movemask(vec v)
+{
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+}
+
+inline vec bit_or(vec a, vec b) { return _mm256_or_si256(a, b); }
+
+inline vec bit_and(vec a, vec b) { return _mm256_and_si256(a, b); }
+
+template <typename T>
+vec splat(T t)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(_mm256_set1_ps(t));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(_mm256_set1_pd(t));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(t));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(t));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(t));
+    } else {
+        return _mm256_set1_epi64x(static_cast<long long>(t));
+    }
+}
+
+template <std::size_t Size>
+vec cmpeq(vec a, vec b)
+{
+    if constexpr (Size == 1) {
+        return _mm256_cmpeq_epi8(a, b);
+    } else if constexpr (Size == 2) {
+        return _mm256_cmpeq_epi16(a, b);
+    } else if constexpr (Size == 4) {
+        return _mm256_cmpeq_epi32(a, b);
+    } else {
+        return _mm256_cmpeq_epi64(a, b);
+    }
+}
+
+inline void store(void* p, vec v)
+{
+    _mm256_storeu_si256(static_cast<__m256i*>(p), v);
+}
+
+// Lanes of a where mask is set, and of b elsewhere
+inline vec select(vec mask, vec a, vec b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+// AVX2 only compares 64-bit lanes as signed; flipping the sign bits maps
+// unsigned order onto signed order
+template <typename T>
+vec cmpgt64(vec a, vec b)
+{
+    if constexpr (std::is_signed_v<T>) {
+        return _mm256_cmpgt_epi64(a, b);
+    } else {
+        const vec sign = _mm256_set1_epi64x(INT64_MIN);
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign),
+                                  _mm256_xor_si256(b, sign));
+    }
+}
+
+// Element types for which min(), max() and unordered() below are available
+template <typename T>
+NANO_CONCEPT has_minmax =
+    vectorizable_integral<T> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double>;
+
+// Lanewise minimum of two vectors of T. For floating point lanes which
+// compare equal, or which are unordered, the result is the lane of b.
+template <typename T>
+vec min(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(
+            _mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(
+            _mm256_min_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+    } else if constexpr (sizeof(T) == 8) {
+        return simd::select(simd::cmpgt64<T>(a, b), b, a);
+    } else if constexpr (std::is_signed_v<T>) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_min_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_min_epi16(a, b);
+        } else {
+            return _mm256_min_epi32(a, b);
+        }
+    } else {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_min_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_min_epu16(a, b);
+        } else {
+            return _mm256_min_epu32(a, b);
+        }
+    }
+}
+
+// Lanewise maximum of two vectors of T, as min()
+template <typename T>
+vec max(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(
+            _mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(
+            _mm256_max_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+    } else if constexpr (sizeof(T) == 8) {
+        return simd::select(simd::cmpgt64<T>(a, b), a, b);
+    } else if constexpr (std::is_signed_v<T>) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_max_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_max_epi16(a, b);
+        } else {
+            return _mm256_max_epi32(a, b);
+        }
+    } else {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_max_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_max_epu16(a, b);
+        } else {
+            return _mm256_max_epu32(a, b);
+        }
+    }
+}
+
+// All ones in the lanes where a == b, compared as T
+template <typename T>
+vec equal(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    } else {
+        return simd::cmpeq<sizeof(T)>(a, b);
+    }
+}
+
+// All ones in the lanes where a or b is NaN. Only for floating point T.
+template <typename T>
+vec unordered(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(
+            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_UNORD_Q));
+    } else {
+        return _mm256_castpd_si256(_mm256_cmp_pd(
+            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_UNORD_Q));
+    }
+}
+
+#elif defined(NANO_SIMD_SSE2)
+
+using vec = __m128i;
+inline constexpr std::size_t width = 16;
+
+inline vec load(const void* p)
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(p));
+}
+
+// One bit per byte
+inline std::uint32_t movemask(vec v)
+{
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+}
+
+inline vec bit_or(vec a, vec b) { return _mm_or_si128(a, b); }
+
+inline vec bit_and(vec a, vec b) { return _mm_and_si128(a, b); }
+
+template <typename T>
+vec splat(T t)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(_mm_set1_ps(t));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(_mm_set1_pd(t));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<char>(t));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<short>(t));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(t));
+    } else {
+        return _mm_set1_epi64x(static_cast<long long>(t));
+    }
+}
+
+template <std::size_t Size>
+vec cmpeq(vec a, vec b)
+{
+    if constexpr (Size == 1) {
+        return _mm_cmpeq_epi8(a, b);
+    } else if constexpr (Size == 2) {
+        return _mm_cmpeq_epi16(a, b);
+    } else if constexpr (Size == 4) {
+        return _mm_cmpeq_epi32(a, b);
+    } else {
+        // SSE2 has no 64-bit compare: a pair of 32-bit halves are equal
+        // iff both of them are
+        const vec eq32 = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(eq32,
+                             _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+}
+
+inline void store(void* p, vec v)
+{
+    _mm_storeu_si128(static_cast<__m128i*>(p), v);
+}
+
+// Lanes of a where mask is set, and of b elsewhere
+inline vec select(vec mask, vec a, vec b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// SSE2 has few of the integer minimum and maximum instructions, and only
+// signed comparisons; flipping the sign bits maps one order onto the other
+template <typename T>
+vec flip_sign(vec a)
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm_xor_si128(a, _mm_set1_epi8(static_cast<char>(0x80)));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_xor_si128(a, _mm_set1_epi16(static_cast<short>(0x8000)));
+    } else {
+        return _mm_xor_si128(a, _mm_set1_epi32(INT32_MIN));
+    }
+}
+
+template <typename T>
+vec cmpgt32(vec a, vec b)
+{
+    if constexpr (std::is_signed_v<T>) {
+        return _mm_cmpgt_epi32(a, b);
+    } else {
+        return _mm_cmpgt_epi32(simd::flip_sign<T>(a), simd::flip_sign<T>(b));
+    }
+}
+
+// Element types for which min(), max() and unordered() below are available.
+// SSE2 cannot compare 64-bit integers.
+template <typename T>
+NANO_CONCEPT has_minmax =
+    (vectorizable_integral<T> && sizeof(T) < 8) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Lanewise minimum of two vectors of T. For floating point lanes which
+// compare equal, or which are unordered, the result is the lane of b.
+template <typename T>
+vec min(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(
+            _mm_min_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(
+            _mm_min_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    } else if constexpr (sizeof(T) == 1) {
+        if constexpr (std::is_signed_v<T>) {
+            return simd::flip_sign<T>(_mm_min_epu8(simd::flip_sign<T>(a),
+                                                   simd::flip_sign<T>(b)));
+        } else {
+            return _mm_min_epu8(a, b);
+        }
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (std::is_signed_v<T>) {
+            return _mm_min_epi16(a, b);
+        } else {
+            return simd::flip_sign<T>(_mm_min_epi16(simd::flip_sign<T>(a),
+                                                    simd::flip_sign<T>(b)));
+        }
+    } else {
+        return simd::select(simd::cmpgt32<T>(a, b), b, a);
+    }
+}
+
+// Lanewise maximum of two vectors of T, as min()
+template <typename T>
+vec max(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(
+            _mm_max_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(
+            _mm_max_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    } else if constexpr (sizeof(T) == 1) {
+        if constexpr (std::is_signed_v<T>) {
+            return simd::flip_sign<T>(_mm_max_epu8(simd::flip_sign<T>(a),
+                                                   simd::flip_sign<T>(b)));
+        } else {
+            return _mm_max_epu8(a, b);
+        }
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (std::is_signed_v<T>) {
+            return _mm_max_epi16(a, b);
+        } else {
+            return simd::flip_sign<T>(_mm_max_epi16(simd::flip_sign<T>(a),
+                                                    simd::flip_sign<T>(b)));
+        }
+    } else {
+        return simd::select(simd::cmpgt32<T>(a, b), a, b);
+    }
+}
+
+// All ones in the lanes where a == b, compared as T
+template <typename T>
+vec equal(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(
+            _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(
+            _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    } else {
+        return simd::cmpeq<sizeof(T)>(a, b);
+    }
+}
+
+// All ones in the lanes where a or b is NaN. Only for floating point T.
+template <typename T>
+vec unordered(vec a, vec b)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(
+            _mm_cmpunord_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else {
+        return _mm_castpd_si128(
+            _mm_cmpunord_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+}
+
+#else
+
+template <typename T>
+NANO_CONCEPT has_minmax = false;
+
+#endif
+
+} // namespace simd
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -77,6 +77,18 @@ template <>
 struct priority_tag<0> {
 };
 
+// Returns true if we are (or might be) in a constant-evaluated context. If the
+// compiler gives us no way to find out, we conservatively say yes, so callers
+// always take their constexpr-friendly path.
+constexpr bool is_constant_evaluated() noexcept
+{
+#ifdef NANO_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
 } // namespace detail
 
 NANO_END_NAMESPACE
@@ -0,0 +1,64 @@
+// nanorange/execution.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_HPP_INCLUDED
+#define NANORANGE_EXECUTION_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+#include <nanorange/detail/type_traits.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// Execution policies, as in [execpol], for use with the algorithms which
+// accept them. Parallel algorithms run on a pool of std::threads shared by
+// the whole program, sized to the hardware concurrency (or to the value of
+// the NANORANGE_NUM_THREADS environment variable, if it is set). As with
+// the standard parallel algorithms, if an element access function exits
+// via an exception then std::terminate() is called.
+namespace execution {
+
+struct sequenced_policy {};
+struct parallel_policy {};
+struct parallel_unsequenced_policy {};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+} // namespace execution
+
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_unsequenced_policy>
+    : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+namespace detail {
+
+template <typename EP>
+NANO_CONCEPT execution_policy = is_execution_policy_v<remove_cvref_t<EP>>;
+
+// True if algorithms called with EP should use the thread pool
+template <typename EP>
+constexpr bool is_parallel_policy_v =
+    execution_policy<EP> &&
+    !std::is_same_v<remove_cvref_t<EP>, execution::sequenced_policy>;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,15 @@
+// nanorange/numeric.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_HPP_INCLUDED
+#define NANORANGE_NUMERIC_HPP_INCLUDED
+
+#include <nanorange/numeric/exclusive_scan.hpp>
+#include <nanorange/numeric/inclusive_scan.hpp>
+#include <nanorange/numeric/reduce.hpp>
+#include <nanorange/numeric/transform_reduce.hpp>
+
+#endif
@@ -0,0 +1,145 @@
+// nanorange/numeric/exclusive_scan.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_EXCLUSIVE_SCAN_HPP_INCLUDED
+#define NANORANGE_NUMERIC_EXCLUSIVE_SCAN_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/unrolled_reduce.hpp>
+#include <nanorange/detail/execution/parallel_scan.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+// [exclusive.scan]
+// The output may be the same as the input. With an execution policy, op
+// must be associative.
+
+template <typename I, typename O>
+using exclusive_scan_result = copy_result<I, O>;
+
+namespace detail {
+
+struct exclusive_scan_fn {
+private:
+    template <typename I, typename S, typename O, typename T, typename Op,
+              typename Proj>
+    static constexpr exclusive_scan_result<I, O>
+    impl(I first, S last, O result, T acc, Op& op, Proj& proj)
+    {
+        // We read each element before we write over it, in case the output
+        // is the input
+        while (first != last) {
+            T next = nano::invoke(op, acc, nano::invoke(proj, *first));
+            *result = std::move(acc);
+            acc = std::move(next);
+            ++first;
+            ++result;
+        }
+
+        return {std::move(first), std::move(result)};
+    }
+
+    template <typename EP, typename I, typename S, typename O, typename T,
+              typename Op, typename Proj>
+    static exclusive_scan_result<I, O>
+    par_impl(I first, S last, O result, T init, Op& op, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S> && random_access_iterator<O>) {
+            const auto n = last - first;
+            detail::parallel_scan<T>(
+                n, std::optional<T>(std::move(init)), op,
+                [&](auto b, auto e) {
+                    projected_element<I, Proj> elem{first + b, proj};
+                    return detail::ordered_reduce<T>(e - b, op, elem);
+                },
+                [&](auto b, auto e, std::optional<T>& carry) {
+                    exclusive_scan_fn::impl(first + b, first + e, result + b,
+                                            std::move(*carry), op, proj);
+                });
+            return {first + n, result + n};
+        } else {
+            return exclusive_scan_fn::impl(std::move(first), std::move(last),
+                                           std::move(result), std::move(init),
+                                           op, proj);
+        }
+    }
+
+public:
+    template <typename I, typename S, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>> &&
+            writable<O, T>,
+        exclusive_scan_result<I, O>>
+    operator()(I first, S last, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::impl(std::move(first), std::move(last),
+                                       std::move(result), std::move(init), op,
+                                       proj);
+    }
+
+    template <typename Rng, typename O, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, T>,
+        exclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(Rng&& rng, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::impl(nano::begin(rng), nano::end(rng),
+                                       std::move(result), std::move(init), op,
+                                       proj);
+    }
+
+    template <typename EP, typename I, typename S, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            forward_iterator<O> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>> &&
+            writable<O, T>,
+        exclusive_scan_result<I, O>>
+    operator()(EP&&, I first, S last, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::par_impl<EP>(std::move(first),
+                                               std::move(last),
+                                               std::move(result),
+                                               std::move(init), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename O, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> && forward_iterator<O> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, T>,
+        exclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(EP&&, Rng&& rng, O result, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return exclusive_scan_fn::par_impl<EP>(nano::begin(rng),
+                                               nano::end(rng),
+                                               std::move(result),
+                                               std::move(init), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::exclusive_scan_fn, exclusive_scan)
+
+NANO_END_NAMESPACE
+
+#endif
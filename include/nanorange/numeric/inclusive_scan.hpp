@@ -0,0 +1,230 @@
+// nanorange/numeric/inclusive_scan.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_INCLUSIVE_SCAN_HPP_INCLUDED
+#define NANORANGE_NUMERIC_INCLUSIVE_SCAN_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/unrolled_reduce.hpp>
+#include <nanorange/detail/execution/parallel_scan.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+// [inclusive.scan]
+// The output may be the same as the input. With an execution policy, op
+// must be associative.
+
+template <typename I, typename O>
+using inclusive_scan_result = copy_result<I, O>;
+
+namespace detail {
+
+struct inclusive_scan_fn {
+private:
+    template <typename I, typename S, typename O, typename T, typename Op,
+              typename Proj>
+    static constexpr inclusive_scan_result<I, O>
+    impl_init(I first, S last, O result, T acc, Op& op, Proj& proj)
+    {
+        while (first != last) {
+            acc = nano::invoke(op, std::move(acc), nano::invoke(proj, *first));
+            *result = acc;
+            ++first;
+            ++result;
+        }
+
+        return {std::move(first), std::move(result)};
+    }
+
+    template <typename I, typename S, typename O, typename Op, typename Proj>
+    static constexpr inclusive_scan_result<I, O>
+    impl(I first, S last, O result, Op& op, Proj& proj)
+    {
+        if (first == last) {
+            return {std::move(first), std::move(result)};
+        }
+
+        projected_value_t<I, Proj> acc = nano::invoke(proj, *first);
+        *result = acc;
+        ++first;
+        ++result;
+        return inclusive_scan_fn::impl_init(std::move(first), std::move(last),
+                                            std::move(result), std::move(acc),
+                                            op, proj);
+    }
+
+    template <typename EP, typename T, typename I, typename S, typename O,
+              typename Op, typename Proj>
+    static inclusive_scan_result<I, O>
+    par_impl(I first, S last, O result, std::optional<T> init, Op& op,
+             Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S> && random_access_iterator<O>) {
+            const auto n = last - first;
+            detail::parallel_scan<T>(
+                n, std::move(init), op,
+                [&](auto b, auto e) {
+                    projected_element<I, Proj> elem{first + b, proj};
+                    return detail::ordered_reduce<T>(e - b, op, elem);
+                },
+                [&](auto b, auto e, std::optional<T>& carry) {
+                    if (carry) {
+                        inclusive_scan_fn::impl_init(first + b, first + e,
+                                                     result + b,
+                                                     std::move(*carry), op,
+                                                     proj);
+                    } else {
+                        inclusive_scan_fn::impl(first + b, first + e,
+                                                result + b, op, proj);
+                    }
+                });
+            return {first + n, result + n};
+        } else if (init) {
+            return inclusive_scan_fn::impl_init(
+                std::move(first), std::move(last), std::move(result),
+                std::move(*init), op, proj);
+        } else {
+            return inclusive_scan_fn::impl(std::move(first), std::move(last),
+                                           std::move(result), op, proj);
+        }
+    }
+
+public:
+    template <typename I, typename S, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            reduce_operation<Op, projected_value_t<I, Proj>,
+                             projected_reference_t<I, Proj>> &&
+            writable<O, const projected_value_t<I, Proj>&>,
+        inclusive_scan_result<I, O>>
+    operator()(I first, S last, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl(std::move(first), std::move(last),
+                                       std::move(result), op, proj);
+    }
+
+    template <typename Rng, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            reduce_operation<Op, projected_value_t<iterator_t<Rng>, Proj>,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, const projected_value_t<iterator_t<Rng>, Proj>&>,
+        inclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(Rng&& rng, O result, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl(nano::begin(rng), nano::end(rng),
+                                       std::move(result), op, proj);
+    }
+
+    template <typename I, typename S, typename O, typename Op, typename T,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && weakly_incrementable<O> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>> &&
+            writable<O, const T&>,
+        inclusive_scan_result<I, O>>
+    operator()(I first, S last, O result, Op op, T init,
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl_init(std::move(first), std::move(last),
+                                            std::move(result), std::move(init),
+                                            op, proj);
+    }
+
+    template <typename Rng, typename O, typename Op, typename T,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && weakly_incrementable<O> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, const T&>,
+        inclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(Rng&& rng, O result, Op op, T init, Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::impl_init(nano::begin(rng), nano::end(rng),
+                                            std::move(result), std::move(init),
+                                            op, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename O,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            forward_iterator<O> &&
+            reduce_operation<Op, projected_value_t<I, Proj>,
+                             projected_reference_t<I, Proj>> &&
+            writable<O, const projected_value_t<I, Proj>&>,
+        inclusive_scan_result<I, O>>
+    operator()(EP&&, I first, S last, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::par_impl<EP, projected_value_t<I, Proj>>(
+            std::move(first), std::move(last), std::move(result),
+            std::nullopt, op, proj);
+    }
+
+    template <typename EP, typename Rng, typename O, typename Op = std::plus<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> && forward_iterator<O> &&
+            reduce_operation<Op, projected_value_t<iterator_t<Rng>, Proj>,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, const projected_value_t<iterator_t<Rng>, Proj>&>,
+        inclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(EP&&, Rng&& rng, O result, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::par_impl<
+            EP, projected_value_t<iterator_t<Rng>, Proj>>(
+            nano::begin(rng), nano::end(rng), std::move(result), std::nullopt,
+            op, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename O, typename Op,
+              typename T, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            forward_iterator<O> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>> &&
+            writable<O, const T&>,
+        inclusive_scan_result<I, O>>
+    operator()(EP&&, I first, S last, O result, Op op, T init,
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::par_impl<EP, T>(
+            std::move(first), std::move(last), std::move(result),
+            std::optional<T>(std::move(init)), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename O, typename Op, typename T,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> && forward_iterator<O> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>> &&
+            writable<O, const T&>,
+        inclusive_scan_result<safe_iterator_t<Rng>, O>>
+    operator()(EP&&, Rng&& rng, O result, Op op, T init,
+               Proj proj = Proj{}) const
+    {
+        return inclusive_scan_fn::par_impl<EP, T>(
+            nano::begin(rng), nano::end(rng), std::move(result),
+            std::optional<T>(std::move(init)), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::inclusive_scan_fn, inclusive_scan)
+
+NANO_END_NAMESPACE
+
+#endif
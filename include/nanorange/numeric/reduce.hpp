@@ -0,0 +1,177 @@
+// nanorange/numeric/reduce.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_REDUCE_HPP_INCLUDED
+#define NANORANGE_NUMERIC_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/unrolled_reduce.hpp>
+#include <nanorange/detail/execution/parallel_scan.hpp>
+#include <nanorange/ranges.hpp>
+
+#include <functional>
+
+NANO_BEGIN_NAMESPACE
+
+// [reduce]
+// As std::reduce(), op may be applied to the elements in any grouping and
+// order, so it should be associative and commutative.
+
+namespace detail {
+
+struct reduce_fn {
+private:
+    friend struct transform_reduce_fn;
+
+    template <typename I, typename S, typename T, typename Op, typename Proj>
+    static constexpr T impl(I first, S last, T init, Op& op, Proj& proj)
+    {
+        if constexpr (random_access_iterator<I> && sized_sentinel_for<S, I>) {
+            const auto n = last - first;
+            if (n <= 0) {
+                return init;
+            }
+            projected_element<I, Proj> elem{first, proj};
+            return nano::invoke(op, std::move(init),
+                                detail::unrolled_reduce<T>(n, op, elem));
+        } else {
+            for (; first != last; ++first) {
+                init = nano::invoke(op, std::move(init),
+                                    nano::invoke(proj, *first));
+            }
+            return init;
+        }
+    }
+
+    template <typename EP, typename I, typename S, typename T, typename Op,
+              typename Proj>
+    static T par_impl(I first, S last, T init, Op& op, Proj& proj)
+    {
+        if constexpr (parallelizable<EP, I, S>) {
+            return detail::parallel_reduce(
+                last - first, std::move(init), op, [&](auto b, auto e) {
+                    projected_element<I, Proj> elem{first + b, proj};
+                    return detail::unrolled_reduce<T>(e - b, op, elem);
+                });
+        } else {
+            return reduce_fn::impl(std::move(first), std::move(last),
+                                   std::move(init), op, proj);
+        }
+    }
+
+public:
+    template <typename I, typename S>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> &&
+            reduce_operation<std::plus<>, iter_value_t<I>, iter_reference_t<I>>,
+        iter_value_t<I>>
+    operator()(I first, S last) const
+    {
+        std::plus<> op{};
+        identity proj{};
+        return reduce_fn::impl(std::move(first), std::move(last),
+                               iter_value_t<I>{}, op, proj);
+    }
+
+    template <typename Rng>
+    constexpr std::enable_if_t<
+        input_range<Rng> &&
+            reduce_operation<std::plus<>, range_value_t<Rng>,
+                             range_reference_t<Rng>>,
+        range_value_t<Rng>>
+    operator()(Rng&& rng) const
+    {
+        std::plus<> op{};
+        identity proj{};
+        return reduce_fn::impl(nano::begin(rng), nano::end(rng),
+                               range_value_t<Rng>{}, op, proj);
+    }
+
+    template <typename I, typename S, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>>,
+        T>
+    operator()(I first, S last, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return reduce_fn::impl(std::move(first), std::move(last),
+                               std::move(init), op, proj);
+    }
+
+    template <typename Rng, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>>,
+        T>
+    operator()(Rng&& rng, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return reduce_fn::impl(nano::begin(rng), nano::end(rng),
+                               std::move(init), op, proj);
+    }
+
+    template <typename EP, typename I, typename S>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            reduce_operation<std::plus<>, iter_value_t<I>, iter_reference_t<I>>,
+        iter_value_t<I>>
+    operator()(EP&&, I first, S last) const
+    {
+        std::plus<> op{};
+        identity proj{};
+        return reduce_fn::par_impl<EP>(std::move(first), std::move(last),
+                                       iter_value_t<I>{}, op, proj);
+    }
+
+    template <typename EP, typename Rng>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            reduce_operation<std::plus<>, range_value_t<Rng>,
+                             range_reference_t<Rng>>,
+        range_value_t<Rng>>
+    operator()(EP&&, Rng&& rng) const
+    {
+        std::plus<> op{};
+        identity proj{};
+        return reduce_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                       range_value_t<Rng>{}, op, proj);
+    }
+
+    template <typename EP, typename I, typename S, typename T,
+              typename Op = std::plus<>, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            reduce_operation<Op, T, projected_reference_t<I, Proj>>,
+        T>
+    operator()(EP&&, I first, S last, T init, Op op = Op{},
+               Proj proj = Proj{}) const
+    {
+        return reduce_fn::par_impl<EP>(std::move(first), std::move(last),
+                                       std::move(init), op, proj);
+    }
+
+    template <typename EP, typename Rng, typename T, typename Op = std::plus<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> &&
+            reduce_operation<Op, T,
+                             projected_reference_t<iterator_t<Rng>, Proj>>,
+        T>
+    operator()(EP&&, Rng&& rng, T init, Op op = Op{}, Proj proj = Proj{}) const
+    {
+        return reduce_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                       std::move(init), op, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::reduce_fn, reduce)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,250 @@
+// nanorange/numeric/transform_reduce.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_NUMERIC_TRANSFORM_REDUCE_HPP_INCLUDED
+#define NANORANGE_NUMERIC_TRANSFORM_REDUCE_HPP_INCLUDED
+
+#include <nanorange/numeric/reduce.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// [transform.reduce]
+// The binary form stops at the end of the shorter range.
+
+namespace detail {
+
+struct transform_reduce_fn {
+private:
+    // The projection followed by the transformation, as one projection, so
+    // that the unary form is just reduce()
+    template <typename F, typename Proj>
+    struct compose {
+        F& f;
+        Proj& proj;
+
+        template <typename T>
+        constexpr auto operator()(T&& t) const
+        {
+            return nano::invoke(f, nano::invoke(proj, std::forward<T>(t)));
+        }
+    };
+
+    template <typename I1, typename S1, typename I2, typename S2, typename T,
+              typename R, typename B, typename Proj1, typename Proj2>
+    static constexpr T binary_impl(I1 first1, S1 last1, I2 first2, S2 last2,
+                                   T init, R& red, B& bin, Proj1& proj1,
+                                   Proj2& proj2)
+    {
+        if constexpr (random_access_iterator<I1> &&
+                      sized_sentinel_for<S1, I1> &&
+                      random_access_iterator<I2> &&
+                      sized_sentinel_for<S2, I2>) {
+            const auto n1 = last1 - first1;
+            const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+            const auto n = n1 < n2 ? n1 : n2;
+            if (n <= 0) {
+                return init;
+            }
+            using D2 = iter_difference_t<I2>;
+            auto elem = [&](iter_difference_t<I1> i) {
+                return nano::invoke(bin, nano::invoke(proj1, first1[i]),
+                                    nano::invoke(proj2,
+                                                 first2[static_cast<D2>(i)]));
+            };
+            return nano::invoke(red, std::move(init),
+                                detail::unrolled_reduce<T>(n, red, elem));
+        } else {
+            for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+                init = nano::invoke(red, std::move(init),
+                                    nano::invoke(bin,
+                                                 nano::invoke(proj1, *first1),
+                                                 nano::invoke(proj2, *first2)));
+            }
+            return init;
+        }
+    }
+
+    template <typename EP, typename I1, typename S1, typename I2, typename S2,
+              typename T, typename R, typename B, typename Proj1,
+              typename Proj2>
+    static T par_binary_impl(I1 first1, S1 last1, I2 first2, S2 last2, T init,
+                             R& red, B& bin, Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (parallelizable<EP, I1, S1> &&
+                      parallelizable<EP, I2, S2>) {
+            using D2 = iter_difference_t<I2>;
+            const auto n1 = last1 - first1;
+            const auto n2 = static_cast<iter_difference_t<I1>>(last2 - first2);
+            return detail::parallel_reduce(
+                n1 < n2 ? n1 : n2, std::move(init), red,
+                [&](auto b, auto e) {
+                    auto elem = [&](auto i) {
+                        const auto j = b + i;
+                        return nano::invoke(
+                            bin, nano::invoke(proj1, first1[j]),
+                            nano::invoke(proj2, first2[static_cast<D2>(j)]));
+                    };
+                    return detail::unrolled_reduce<T>(e - b, red, elem);
+                });
+        } else {
+            return transform_reduce_fn::binary_impl(
+                std::move(first1), std::move(last1), std::move(first2),
+                std::move(last2), std::move(init), red, bin, proj1, proj2);
+        }
+    }
+
+public:
+    // Unary op, iterators
+    template <typename I, typename S, typename T, typename R, typename U,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I> && sentinel_for<S, I> && copy_constructible<U> &&
+            reduce_operation<R, T, indirect_result_t<U&, projected<I, Proj>>>,
+        T>
+    operator()(I first, S last, T init, R red, U un, Proj proj = Proj{}) const
+    {
+        compose<U, Proj> f{un, proj};
+        return reduce_fn::impl(std::move(first), std::move(last),
+                               std::move(init), red, f);
+    }
+
+    // Unary op, range
+    template <typename Rng, typename T, typename R, typename U,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng> && copy_constructible<U> &&
+            reduce_operation<
+                R, T,
+                indirect_result_t<U&, projected<iterator_t<Rng>, Proj>>>,
+        T>
+    operator()(Rng&& rng, T init, R red, U un, Proj proj = Proj{}) const
+    {
+        compose<U, Proj> f{un, proj};
+        return reduce_fn::impl(nano::begin(rng), nano::end(rng),
+                               std::move(init), red, f);
+    }
+
+    // Binary op, four-legged
+    template <typename I1, typename S1, typename I2, typename S2, typename T,
+              typename R = std::plus<>, typename B = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    constexpr std::enable_if_t<
+        input_iterator<I1> && sentinel_for<S1, I1> && input_iterator<I2> &&
+            sentinel_for<S2, I2> && copy_constructible<B> &&
+            reduce_operation<R, T,
+                             indirect_result_t<B&, projected<I1, Proj1>,
+                                               projected<I2, Proj2>>>,
+        T>
+    operator()(I1 first1, S1 last1, I2 first2, S2 last2, T init, R red = R{},
+               B bin = B{}, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::binary_impl(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(init), red, bin, proj1, proj2);
+    }
+
+    // Binary op, two ranges
+    template <typename Rng1, typename Rng2, typename T,
+              typename R = std::plus<>, typename B = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    constexpr std::enable_if_t<
+        input_range<Rng1> && input_range<Rng2> && copy_constructible<B> &&
+            reduce_operation<
+                R, T,
+                indirect_result_t<B&, projected<iterator_t<Rng1>, Proj1>,
+                                  projected<iterator_t<Rng2>, Proj2>>>,
+        T>
+    operator()(Rng1&& rng1, Rng2&& rng2, T init, R red = R{}, B bin = B{},
+               Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::binary_impl(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), std::move(init), red, bin, proj1, proj2);
+    }
+
+    // Unary op, iterators, with an execution policy
+    template <typename EP, typename I, typename S, typename T, typename R,
+              typename U, typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I> && sentinel_for<S, I> &&
+            copy_constructible<U> &&
+            reduce_operation<R, T, indirect_result_t<U&, projected<I, Proj>>>,
+        T>
+    operator()(EP&&, I first, S last, T init, R red, U un,
+               Proj proj = Proj{}) const
+    {
+        compose<U, Proj> f{un, proj};
+        return reduce_fn::par_impl<EP>(std::move(first), std::move(last),
+                                       std::move(init), red, f);
+    }
+
+    // Unary op, range, with an execution policy
+    template <typename EP, typename Rng, typename T, typename R, typename U,
+              typename Proj = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng> && copy_constructible<U> &&
+            reduce_operation<
+                R, T,
+                indirect_result_t<U&, projected<iterator_t<Rng>, Proj>>>,
+        T>
+    operator()(EP&&, Rng&& rng, T init, R red, U un, Proj proj = Proj{}) const
+    {
+        compose<U, Proj> f{un, proj};
+        return reduce_fn::par_impl<EP>(nano::begin(rng), nano::end(rng),
+                                       std::move(init), red, f);
+    }
+
+    // Binary op, four-legged, with an execution policy
+    template <typename EP, typename I1, typename S1, typename I2, typename S2,
+              typename T, typename R = std::plus<>,
+              typename B = std::multiplies<>, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_iterator<I1> && sentinel_for<S1, I1> &&
+            forward_iterator<I2> && sentinel_for<S2, I2> &&
+            copy_constructible<B> &&
+            reduce_operation<R, T,
+                             indirect_result_t<B&, projected<I1, Proj1>,
+                                               projected<I2, Proj2>>>,
+        T>
+    operator()(EP&&, I1 first1, S1 last1, I2 first2, S2 last2, T init,
+               R red = R{}, B bin = B{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::par_binary_impl<EP>(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(init), red, bin, proj1, proj2);
+    }
+
+    // Binary op, two ranges, with an execution policy
+    template <typename EP, typename Rng1, typename Rng2, typename T,
+              typename R = std::plus<>, typename B = std::multiplies<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        execution_policy<EP> && forward_range<Rng1> && forward_range<Rng2> &&
+            copy_constructible<B> &&
+            reduce_operation<
+                R, T,
+                indirect_result_t<B&, projected<iterator_t<Rng1>, Proj1>,
+                                  projected<iterator_t<Rng2>, Proj2>>>,
+        T>
+    operator()(EP&&, Rng1&& rng1, Rng2&& rng2, T init, R red = R{},
+               B bin = B{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return transform_reduce_fn::par_binary_impl<EP>(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), std::move(init), red, bin, proj1, proj2);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::transform_reduce_fn, transform_reduce)
+
+NANO_END_NAMESPACE
+
+#endif
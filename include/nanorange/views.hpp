@@ -7,8 +7,12 @@
 #ifndef NANORANGE_VIEWS_HPP_INCLUDED
 #define NANORANGE_VIEWS_HPP_INCLUDED
 
+#include <nanorange/views/adjacent.hpp>
 #include <nanorange/views/all.hpp>
+#include <nanorange/views/cache_latest.hpp>
+#include <nanorange/views/chunk.hpp>
 #include <nanorange/views/common.hpp>
+#include <nanorange/views/concat.hpp>
 #include <nanorange/views/counted.hpp>
 #include <nanorange/views/drop.hpp>
 #include <nanorange/views/drop_while.hpp>
@@ -19,13 +23,18 @@
 #include <nanorange/views/iota.hpp>
 #include <nanorange/views/istream.hpp>
 #include <nanorange/views/join.hpp>
+#include <nanorange/views/merge.hpp>
 #include <nanorange/views/ref.hpp>
 #include <nanorange/views/reverse.hpp>
 #include <nanorange/views/single.hpp>
+#include <nanorange/views/slide.hpp>
 #include <nanorange/views/split.hpp>
+#include <nanorange/views/stride.hpp>
 #include <nanorange/views/subrange.hpp>
 #include <nanorange/views/take.hpp>
 #include <nanorange/views/take_while.hpp>
 #include <nanorange/views/transform.hpp>
+#include <nanorange/views/zip.hpp>
+#include <nanorange/views/zip_transform.hpp>
 
 #endif
@@ -0,0 +1,477 @@
+// nanorange/views/adjacent.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_ADJACENT_HPP_INCLUDED
+#define NANORANGE_VIEWS_ADJACENT_HPP_INCLUDED
+
+#include <nanorange/views/empty.hpp>
+#include <nanorange/views/zip.hpp>
+
+#include <array>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename T, std::size_t>
+using adjacent_repeat_t = T;
+
+template <template <typename...> class Tuple, typename T, typename Seq>
+struct adjacent_tuple;
+
+template <template <typename...> class Tuple, typename T, std::size_t... I>
+struct adjacent_tuple<Tuple, T, std::index_sequence<I...>> {
+    using type = Tuple<adjacent_repeat_t<T, I>...>;
+};
+
+// Tuple<T, T, ..., T>, with N Ts
+template <template <typename...> class Tuple, typename T, std::size_t N>
+using adjacent_tuple_t =
+    typename adjacent_tuple<Tuple, T, std::make_index_sequence<N>>::type;
+
+} // namespace detail
+
+// A view of the tuples of references to each N consecutive elements of a
+// forward range, like the windows of a slide_view but of a size known at
+// compile time
+namespace adjacent_view_ {
+
+template <typename V, std::size_t N>
+struct adjacent_view : view_interface<adjacent_view<V, N>> {
+private:
+    static_assert(forward_range<V>);
+    static_assert(view<V>);
+    static_assert(N > 0);
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct sentinel<Const>;
+        friend struct adjacent_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+        using I = iterator_t<Base>;
+
+        // The iterators to each element of the current window, so that we
+        // never need to walk back and forth within it
+        std::array<I, N> current_{};
+
+        struct as_begin {};
+        struct as_end {};
+
+        constexpr iterator(as_begin, I first, sentinel_t<Base> last)
+        {
+            current_[0] = std::move(first);
+            for (std::size_t i = 1; i < N; ++i) {
+                current_[i] = ranges::next(current_[i - 1], 1, last);
+            }
+        }
+
+        constexpr iterator(as_end, I first, I last)
+        {
+            current_[N - 1] = std::move(last);
+            for (std::size_t i = N - 1; i-- > 0; ) {
+                current_[i] = current_[i + 1];
+                if constexpr (bidirectional_range<Base>) {
+                    if (current_[i] != first) {
+                        --current_[i];
+                    }
+                }
+            }
+        }
+
+        template <std::size_t... Is>
+        constexpr auto deref(std::index_sequence<Is...>) const
+        {
+            return reference(*current_[Is]...);
+        }
+
+        template <std::size_t... Is>
+        constexpr auto subscript(range_difference_t<Base> n,
+                                 std::index_sequence<Is...>) const
+        {
+            return reference(current_[Is][n]...);
+        }
+
+        template <std::size_t... Is>
+        constexpr auto move_each(std::index_sequence<Is...>) const
+        {
+            return detail::adjacent_tuple_t<detail::zip_tuple,
+                                            range_rvalue_reference_t<Base>, N>(
+                ranges::iter_move(current_[Is])...);
+        }
+
+    public:
+        using iterator_category = detail::conditional_t<
+            derived_from<iterator_category_t<I>, contiguous_iterator_tag>,
+            random_access_iterator_tag, iterator_category_t<I>>;
+        using value_type =
+            detail::adjacent_tuple_t<std::tuple, range_value_t<Base>, N>;
+        using difference_type = range_difference_t<Base>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = detail::adjacent_tuple_t<detail::zip_tuple,
+                                                   range_reference_t<Base>, N>;
+
+        iterator() = default;
+
+        template <typename It,
+            std::enable_if_t<same_as<It, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, I>, int> = 0>
+        constexpr iterator(It i)
+        {
+            for (std::size_t k = 0; k < N; ++k) {
+                current_[k] = std::move(i.current_[k]);
+            }
+        }
+
+        constexpr reference operator*() const
+        {
+            return deref(std::make_index_sequence<N>{});
+        }
+
+        constexpr iterator& operator++()
+        {
+            for (auto& i : current_) {
+                ++i;
+            }
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            for (auto& i : current_) {
+                --i;
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            for (auto& i : current_) {
+                i += n;
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            for (auto& i : current_) {
+                i -= n;
+            }
+            return *this;
+        }
+
+        template <typename B = Base, std::enable_if_t<random_access_range<B>, int> = 0>
+        constexpr reference operator[](difference_type n) const
+        {
+            return subscript(n, std::make_index_sequence<N>{});
+        }
+
+        friend constexpr bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.current_.back() == y.current_.back();
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.current_.back() < y.current_.back();
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return x.current_.back() - y.current_.back();
+        }
+
+        friend constexpr auto iter_move(const iterator& i) noexcept(
+            noexcept(ranges::iter_move(std::declval<const I&>())) &&
+            std::is_nothrow_move_constructible_v<range_rvalue_reference_t<Base>>)
+        {
+            return i.move_each(std::make_index_sequence<N>{});
+        }
+
+        template <typename B = Base>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            noexcept(noexcept(ranges::iter_swap(std::declval<const I&>(),
+                                                std::declval<const I&>())))
+            -> std::enable_if_t<indirectly_swappable<iterator_t<B>>>
+        {
+            for (std::size_t i = 0; i < N; ++i) {
+                ranges::iter_swap(x.current_[i], y.current_[i]);
+            }
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        sentinel_t<Base> end_ = sentinel_t<Base>();
+
+        static constexpr const iterator_t<Base>& last(const iterator<Const>& i)
+        {
+            return i.current_.back();
+        }
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(sentinel_t<Base> end)
+            : end_(std::move(end))
+        {}
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<sentinel_t<VV>, sentinel_t<Base>>, int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return last(x) == y.end_;
+        }
+
+        friend constexpr bool operator==(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return !(y == x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator<Const>& x,
+                                        const sentinel& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                range_difference_t<B>>
+        {
+            return last(x) - y.end_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const sentinel& x,
+                                        const iterator<Const>& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                range_difference_t<B>>
+        {
+            return x.end_ - last(y);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        if constexpr (common_range<detail::conditional_t<Const, const V, V>>) {
+            return iterator<Const>(typename iterator<Const>::as_end{},
+                                   ranges::begin(self.base_),
+                                   ranges::end(self.base_));
+        } else {
+            return sentinel<Const>(ranges::end(self.base_));
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        const auto sz = ranges::size(self.base_);
+        constexpr auto n = static_cast<decltype(sz)>(N - 1);
+        return sz < n ? 0 : sz - n;
+    }
+
+    V base_ = V();
+
+public:
+    adjacent_view() = default;
+
+    constexpr explicit adjacent_view(V base)
+        : base_(std::move(base))
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr iterator<false> begin()
+    {
+        return iterator<false>(typename iterator<false>::as_begin{},
+                               ranges::begin(base_), ranges::end(base_));
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return iterator<true>(typename iterator<true>::as_begin{},
+                              ranges::begin(base_), ranges::end(base_));
+    }
+
+    constexpr auto end()
+    {
+        return adjacent_view::end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return adjacent_view::end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return adjacent_view::size_impl(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return adjacent_view::size_impl(*this);
+    }
+};
+
+} // namespace adjacent_view_
+
+using adjacent_view_::adjacent_view;
+
+namespace detail {
+
+template <std::size_t N>
+struct adjacent_view_fn {
+    template <typename E>
+    constexpr auto operator()(E&& e) const
+        -> decltype(adjacent_view<all_view<E>, N>{views::all(std::forward<E>(e))})
+    {
+        return adjacent_view<all_view<E>, N>{views::all(std::forward<E>(e))};
+    }
+};
+
+template <>
+struct adjacent_view_fn<0> {
+    template <typename E, std::enable_if_t<forward_range<all_view<E>>, int> = 0>
+    constexpr auto operator()(E&&) const
+    {
+        return views::empty<std::tuple<>>;
+    }
+};
+
+template <std::size_t N>
+inline constexpr bool is_raco<adjacent_view_fn<N>> = true;
+
+} // namespace detail
+
+namespace views {
+
+inline namespace function_objects {
+
+template <std::size_t N>
+inline constexpr nano::detail::adjacent_view_fn<N> adjacent{};
+
+inline constexpr nano::detail::adjacent_view_fn<2> pairwise{};
+
+}
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,279 @@
+// nanorange/views/cache_latest.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_CACHE_LATEST_HPP_INCLUDED
+#define NANORANGE_VIEWS_CACHE_LATEST_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+
+#include <optional>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// An optional which is emptied, rather than copied, when its owner is copied
+// or moved, so that a view holding one stays semiregular whatever the
+// type of the cached value
+template <typename T>
+struct non_propagating_cache : std::optional<T> {
+    non_propagating_cache() = default;
+
+    constexpr non_propagating_cache(const non_propagating_cache&) noexcept
+        : std::optional<T>()
+    {}
+
+    constexpr non_propagating_cache(non_propagating_cache&& other) noexcept
+        : std::optional<T>()
+    {
+        other.reset();
+    }
+
+    constexpr non_propagating_cache&
+    operator=(const non_propagating_cache& other) noexcept
+    {
+        if (std::addressof(other) != this) {
+            this->reset();
+        }
+        return *this;
+    }
+
+    constexpr non_propagating_cache&
+    operator=(non_propagating_cache&& other) noexcept
+    {
+        this->reset();
+        other.reset();
+        return *this;
+    }
+};
+
+} // namespace detail
+
+// A view which stores the element it last read from its base, so that
+// dereferencing the same iterator again doesn't read it again. This is
+// worthwhile when reading an element is expensive and something downstream
+// reads it more than once, which is the case for:
+//
+//  - filter_view, whose iterator reads each element to test it and whose
+//    user then reads the ones which pass
+//  - take_while_view, whose sentinel reads each element to test it
+//  - drop_while_view, whose begin() reads the first element it keeps
+//
+// when they sit after a transform_view or zip_transform_view, which call
+// their function on every read. So `r | views::transform(decode) |
+// views::cache_latest | views::filter(pred)` decodes each element once
+// rather than twice for each element which passes the filter.
+//
+// The cache lives in the view, so the result is an input range only.
+namespace cache_latest_view_ {
+
+template <typename V>
+struct cache_latest_view : view_interface<cache_latest_view<V>> {
+private:
+    static_assert(input_range<V>);
+    static_assert(view<V>);
+
+    // We keep a pointer to an element which the base range returns by
+    // reference, and the element itself otherwise
+    using cache_t = detail::conditional_t<
+        std::is_reference_v<range_reference_t<V>>,
+        std::add_pointer_t<range_reference_t<V>>, range_reference_t<V>>;
+
+    struct sentinel;
+
+    struct iterator {
+    private:
+        friend struct sentinel;
+
+        cache_latest_view* parent_ = nullptr;
+        iterator_t<V> current_ = iterator_t<V>();
+
+    public:
+        using iterator_category = input_iterator_tag;
+        using value_type = range_value_t<V>;
+        using difference_type = range_difference_t<V>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = range_reference_t<V>&;
+
+        iterator() = default;
+
+        constexpr iterator(cache_latest_view& parent, iterator_t<V> current)
+            : parent_(std::addressof(parent)),
+              current_(std::move(current))
+        {}
+
+        constexpr iterator_t<V> base() const { return current_; }
+
+        constexpr reference operator*() const
+        {
+            auto& cache = parent_->cache_;
+            if constexpr (std::is_reference_v<range_reference_t<V>>) {
+                if (!cache) {
+                    cache.emplace(std::addressof(*current_));
+                }
+                return **cache;
+            } else {
+                if (!cache) {
+                    cache.emplace(*current_);
+                }
+                return *cache;
+            }
+        }
+
+        constexpr iterator& operator++()
+        {
+            ++current_;
+            parent_->cache_.reset();
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        friend constexpr range_rvalue_reference_t<V>
+        iter_move(const iterator& i) noexcept(
+            noexcept(ranges::iter_move(i.current_)))
+        {
+            return ranges::iter_move(i.current_);
+        }
+
+        template <typename VV = V>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            noexcept(noexcept(ranges::iter_swap(x.current_, y.current_)))
+            -> std::enable_if_t<indirectly_swappable<iterator_t<VV>>>
+        {
+            ranges::iter_swap(x.current_, y.current_);
+        }
+    };
+
+    struct sentinel {
+    private:
+        sentinel_t<V> end_ = sentinel_t<V>();
+
+        static constexpr const iterator_t<V>& current(const iterator& i)
+        {
+            return i.current_;
+        }
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(sentinel_t<V> end)
+            : end_(std::move(end))
+        {}
+
+        constexpr sentinel_t<V> base() const { return end_; }
+
+        friend constexpr bool operator==(const iterator& x, const sentinel& y)
+        {
+            return current(x) == y.end_;
+        }
+
+        friend constexpr bool operator==(const sentinel& x, const iterator& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x, const iterator& y)
+        {
+            return !(y == x);
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(const iterator& x, const sentinel& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>,
+                range_difference_t<VV>>
+        {
+            return current(x) - y.end_;
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(const sentinel& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>,
+                range_difference_t<VV>>
+        {
+            return x.end_ - current(y);
+        }
+    };
+
+    V base_ = V();
+    detail::non_propagating_cache<cache_t> cache_;
+
+public:
+    cache_latest_view() = default;
+
+    constexpr explicit cache_latest_view(V base)
+        : base_(std::move(base))
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr iterator begin()
+    {
+        cache_.reset();
+        return iterator{*this, ranges::begin(base_)};
+    }
+
+    constexpr sentinel end()
+    {
+        return sentinel{ranges::end(base_)};
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return ranges::size(base_);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return ranges::size(base_);
+    }
+};
+
+template <typename R>
+cache_latest_view(R&&) -> cache_latest_view<all_view<R>>;
+
+} // namespace cache_latest_view_
+
+using cache_latest_view_::cache_latest_view;
+
+namespace detail {
+
+struct cache_latest_view_fn {
+    template <typename E>
+    constexpr auto operator()(E&& e) const
+        -> decltype(cache_latest_view<all_view<E>>{
+            views::all(std::forward<E>(e))})
+    {
+        return cache_latest_view<all_view<E>>{views::all(std::forward<E>(e))};
+    }
+};
+
+template <>
+inline constexpr bool is_raco<cache_latest_view_fn> = true;
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::cache_latest_view_fn, cache_latest)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,688 @@
+// nanorange/views/chunk.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_CHUNK_HPP_INCLUDED
+#define NANORANGE_VIEWS_CHUNK_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/iterator/default_sentinel.hpp>
+#include <nanorange/iterator/operations.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+#include <nanorange/views/subrange.hpp>
+
+#include <optional>
+
+NANO_BEGIN_NAMESPACE
+
+// A view of the successive chunks of n elements of a range, the last of
+// which may be shorter. The chunks of a forward range are subranges of its
+// iterators.
+namespace chunk_view_ {
+
+template <typename V, typename = void>
+struct chunk_view;
+
+// The chunks of an input range share a single cursor, which lives in the
+// view. Reading a chunk advances the cursor, and moving on to the next chunk
+// skips whatever is left of the current one.
+template <typename V>
+struct chunk_view<V, std::enable_if_t<!forward_range<V>>>
+    : view_interface<chunk_view<V>> {
+private:
+    static_assert(input_range<V>);
+    static_assert(view<V>);
+
+    using D = range_difference_t<V>;
+
+    struct inner_iterator {
+    private:
+        chunk_view* parent_ = nullptr;
+
+        constexpr const iterator_t<V>& cursor() const
+        {
+            return *parent_->current_;
+        }
+
+        constexpr D remainder() const { return parent_->remainder_; }
+
+        constexpr D left() const
+        {
+            const D left = ranges::end(parent_->base_) - cursor();
+            return left < parent_->remainder_ ? left : parent_->remainder_;
+        }
+
+    public:
+        using iterator_category = input_iterator_tag;
+        using difference_type = D;
+        using value_type = range_value_t<V>;
+
+        inner_iterator() = default;
+
+        constexpr explicit inner_iterator(chunk_view& parent) noexcept
+            : parent_(std::addressof(parent))
+        {}
+
+        constexpr range_reference_t<V> operator*() const
+        {
+            return **parent_->current_;
+        }
+
+        constexpr inner_iterator& operator++()
+        {
+            ++*parent_->current_;
+            if (*parent_->current_ == ranges::end(parent_->base_)) {
+                parent_->remainder_ = 0;
+            } else {
+                --parent_->remainder_;
+            }
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        friend constexpr bool operator==(const inner_iterator& x,
+                                         default_sentinel_t)
+        {
+            return x.remainder() == 0;
+        }
+
+        friend constexpr bool operator==(default_sentinel_t s,
+                                         const inner_iterator& x)
+        {
+            return x == s;
+        }
+
+        friend constexpr bool operator!=(const inner_iterator& x,
+                                         default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t s,
+                                         const inner_iterator& x)
+        {
+            return !(x == s);
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(default_sentinel_t,
+                                        const inner_iterator& x)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>, D>
+        {
+            return x.left();
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(const inner_iterator& x,
+                                        default_sentinel_t s)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>, D>
+        {
+            return -(s - x);
+        }
+
+        friend constexpr range_rvalue_reference_t<V>
+        iter_move(const inner_iterator& i) noexcept(
+            noexcept(ranges::iter_move(i.cursor())))
+        {
+            return ranges::iter_move(i.cursor());
+        }
+
+        template <typename VV = V>
+        friend constexpr auto iter_swap(const inner_iterator& x,
+                                        const inner_iterator& y)
+            noexcept(noexcept(ranges::iter_swap(x.cursor(), y.cursor())))
+            -> std::enable_if_t<indirectly_swappable<iterator_t<VV>>>
+        {
+            ranges::iter_swap(x.cursor(), y.cursor());
+        }
+    };
+
+    struct inner_view : view_interface<inner_view> {
+    private:
+        chunk_view* parent_ = nullptr;
+
+    public:
+        inner_view() = default;
+
+        constexpr explicit inner_view(chunk_view& parent) noexcept
+            : parent_(std::addressof(parent))
+        {}
+
+        constexpr inner_iterator begin() const noexcept
+        {
+            return inner_iterator(*parent_);
+        }
+
+        constexpr default_sentinel_t end() const noexcept
+        {
+            return default_sentinel;
+        }
+
+        template <typename VV = V, std::enable_if_t<
+            sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>, int> = 0>
+        constexpr auto size() const
+        {
+            return static_cast<std::make_unsigned_t<D>>(default_sentinel -
+                                                        begin());
+        }
+    };
+
+    struct outer_iterator {
+    private:
+        chunk_view* parent_ = nullptr;
+
+        constexpr bool at_end() const
+        {
+            return *parent_->current_ == ranges::end(parent_->base_) &&
+                   parent_->remainder_ != 0;
+        }
+
+        constexpr D chunks_left() const
+        {
+            const chunk_view& p = *parent_;
+            const D left = ranges::end(p.base_) - *p.current_;
+            if (left < p.remainder_) {
+                return left == 0 ? 0 : 1;
+            }
+            return (left - p.remainder_ + p.n_ - 1) / p.n_ + 1;
+        }
+
+    public:
+        using iterator_category = input_iterator_tag;
+        using difference_type = D;
+        using value_type = inner_view;
+
+        outer_iterator() = default;
+
+        constexpr explicit outer_iterator(chunk_view& parent) noexcept
+            : parent_(std::addressof(parent))
+        {}
+
+        constexpr value_type operator*() const
+        {
+            return value_type(*parent_);
+        }
+
+        constexpr outer_iterator& operator++()
+        {
+            ranges::advance(*parent_->current_, parent_->remainder_,
+                            ranges::end(parent_->base_));
+            parent_->remainder_ = parent_->n_;
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        friend constexpr bool operator==(const outer_iterator& x,
+                                         default_sentinel_t)
+        {
+            return x.at_end();
+        }
+
+        friend constexpr bool operator==(default_sentinel_t s,
+                                         const outer_iterator& x)
+        {
+            return x == s;
+        }
+
+        friend constexpr bool operator!=(const outer_iterator& x,
+                                         default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t s,
+                                         const outer_iterator& x)
+        {
+            return !(x == s);
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(default_sentinel_t,
+                                        const outer_iterator& x)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>, D>
+        {
+            return x.chunks_left();
+        }
+
+        template <typename VV = V>
+        friend constexpr auto operator-(const outer_iterator& x,
+                                        default_sentinel_t s)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<VV>, iterator_t<VV>>, D>
+        {
+            return -(s - x);
+        }
+    };
+
+    V base_ = V();
+    D n_ = 0;
+    D remainder_ = 0;
+    std::optional<iterator_t<V>> current_;
+
+public:
+    chunk_view() = default;
+
+    constexpr chunk_view(V base, D n)
+        : base_(std::move(base)),
+          n_(n)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr outer_iterator begin()
+    {
+        current_ = ranges::begin(base_);
+        remainder_ = n_;
+        return outer_iterator(*this);
+    }
+
+    constexpr default_sentinel_t end() const noexcept
+    {
+        return default_sentinel;
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        const auto sz = ranges::size(base_);
+        const auto n = static_cast<decltype(sz)>(n_);
+        return (sz + n - 1) / n;
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        const auto sz = ranges::size(base_);
+        const auto n = static_cast<decltype(sz)>(n_);
+        return (sz + n - 1) / n;
+    }
+};
+
+template <typename V>
+struct chunk_view<V, std::enable_if_t<forward_range<V>>>
+    : view_interface<chunk_view<V>> {
+private:
+    static_assert(view<V>);
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct chunk_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+        using I = iterator_t<Base>;
+        using S = sentinel_t<Base>;
+        using D = range_difference_t<Base>;
+
+        I current_ = I();
+        // The end of the chunk at current_, so that we walk a forward range
+        // just once
+        I next_ = I();
+        S end_ = S();
+        D n_ = 0;
+        // How many elements the chunk at current_ is short of n_; or, at the
+        // end, how many the last chunk was short
+        D missing_ = 0;
+
+        constexpr iterator(I current, S end, D n)
+            : current_(current),
+              next_(std::move(current)),
+              end_(std::move(end)),
+              n_(n)
+        {
+            const D m = ranges::advance(next_, n_, end_);
+            missing_ = m < n_ ? m : 0;
+        }
+
+        constexpr iterator(I current, S end, D n, D missing)
+            : current_(current),
+              next_(std::move(current)),
+              end_(std::move(end)),
+              n_(n),
+              missing_(missing)
+        {}
+
+        // How much the distance from the start of the range to current_
+        // falls short of a multiple of n_
+        constexpr D end_missing() const
+        {
+            return current_ == next_ ? missing_ : 0;
+        }
+
+    public:
+        using iterator_category = detail::conditional_t<
+            derived_from<iterator_category_t<I>, contiguous_iterator_tag>,
+            random_access_iterator_tag, iterator_category_t<I>>;
+        using value_type = subrange<I>;
+        using difference_type = D;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = subrange<I>;
+
+        iterator() = default;
+
+        template <typename It,
+            std::enable_if_t<same_as<It, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, I> &&
+            convertible_to<sentinel_t<VV>, S>, int> = 0>
+        constexpr iterator(It i)
+            : current_(std::move(i.current_)),
+              next_(std::move(i.next_)),
+              end_(std::move(i.end_)),
+              n_(i.n_),
+              missing_(i.missing_)
+        {}
+
+        constexpr I base() const { return current_; }
+
+        constexpr reference operator*() const
+        {
+            return reference(current_, next_);
+        }
+
+        constexpr iterator& operator++()
+        {
+            current_ = next_;
+            const D m = ranges::advance(next_, n_, end_);
+            if (m < n_) {
+                missing_ = m;
+            }
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            if (current_ == next_) {
+                // At the end, the last chunk may be short
+                ranges::advance(current_, missing_ - n_);
+            } else {
+                next_ = current_;
+                ranges::advance(current_, -n_);
+                missing_ = 0;
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            if (x > 0) {
+                missing_ = ranges::advance(current_, n_ * x, end_);
+                next_ = current_;
+                const D m = ranges::advance(next_, n_, end_);
+                if (m < n_) {
+                    missing_ = m;
+                }
+            } else if (x < 0) {
+                ranges::advance(current_, n_ * x + end_missing());
+                next_ = current_;
+                missing_ = ranges::advance(next_, n_, end_);
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type x)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            return *this += -x;
+        }
+
+        template <typename B = Base, std::enable_if_t<random_access_range<B>, int> = 0>
+        constexpr reference operator[](difference_type x) const
+        {
+            return *(*this + x);
+        }
+
+        friend constexpr bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.current_ == y.current_;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator==(const iterator& x, default_sentinel_t)
+        {
+            return x.current_ == x.end_;
+        }
+
+        friend constexpr bool operator==(default_sentinel_t s, const iterator& x)
+        {
+            return x == s;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t s, const iterator& x)
+        {
+            return !(x == s);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.current_ < y.current_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return (x.current_ - y.current_ + x.end_missing() -
+                    y.end_missing()) / x.n_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(default_sentinel_t, const iterator& x)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return (x.end_ - x.current_ + x.n_ - 1) / x.n_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, default_sentinel_t s)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return -(s - x);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        if constexpr (common_range<Base> && sized_range<Base>) {
+            const auto missing =
+                (self.n_ - ranges::distance(self.base_) % self.n_) % self.n_;
+            return iterator<Const>(ranges::end(self.base_),
+                                   ranges::end(self.base_), self.n_, missing);
+        } else if constexpr (common_range<Base> && !bidirectional_range<Base>) {
+            return iterator<Const>(ranges::end(self.base_),
+                                   ranges::end(self.base_), self.n_,
+                                   range_difference_t<Base>{0});
+        } else {
+            return default_sentinel;
+        }
+    }
+
+    V base_ = V();
+    range_difference_t<V> n_ = 0;
+
+public:
+    chunk_view() = default;
+
+    constexpr chunk_view(V base, range_difference_t<V> n)
+        : base_(std::move(base)),
+          n_(n)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr iterator<false> begin()
+    {
+        return iterator<false>(ranges::begin(base_), ranges::end(base_), n_);
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return iterator<true>(ranges::begin(base_), ranges::end(base_), n_);
+    }
+
+    constexpr auto end()
+    {
+        return chunk_view::end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return chunk_view::end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        const auto sz = ranges::size(base_);
+        const auto n = static_cast<decltype(sz)>(n_);
+        return (sz + n - 1) / n;
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        const auto sz = ranges::size(base_);
+        const auto n = static_cast<decltype(sz)>(n_);
+        return (sz + n - 1) / n;
+    }
+};
+
+template <typename R>
+chunk_view(R&&, range_difference_t<R>) -> chunk_view<all_view<R>>;
+
+} // namespace chunk_view_
+
+using chunk_view_::chunk_view;
+
+namespace detail {
+
+struct chunk_view_fn {
+    template <typename E, typename D>
+    constexpr auto operator()(E&& e, D n) const
+        -> decltype(chunk_view{std::forward<E>(e), n})
+    {
+        return chunk_view{std::forward<E>(e), n};
+    }
+
+    template <typename D, std::enable_if_t<std::is_integral_v<D>, int> = 0>
+    constexpr auto operator()(D n) const
+    {
+        return detail::rao_proxy{[n](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(chunk_view{std::forward<decltype(r)>(r), n})
+#endif
+        {
+            return chunk_view{std::forward<decltype(r)>(r), n};
+        }};
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::chunk_view_fn, chunk)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,630 @@
+// nanorange/views/concat.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_CONCAT_HPP_INCLUDED
+#define NANORANGE_VIEWS_CONCAT_HPP_INCLUDED
+
+#include <nanorange/detail/iterator/segmented.hpp>
+#include <nanorange/iterator/default_sentinel.hpp>
+#include <nanorange/iterator/operations.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+
+#include <tuple>
+#include <variant>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Calls f with std::integral_constant<std::size_t, i>, for a runtime i < N
+template <std::size_t I, std::size_t N, typename F>
+constexpr decltype(auto) concat_visit_index(std::size_t i, F&& f)
+{
+    if constexpr (I + 1 == N) {
+        return f(std::integral_constant<std::size_t, I>{});
+    } else {
+        if (i == I) {
+            return f(std::integral_constant<std::size_t, I>{});
+        }
+        return detail::concat_visit_index<I + 1, N>(i, std::forward<F>(f));
+    }
+}
+
+// To step back from the start of one range into the previous one, we need
+// an iterator to the end of that range
+template <typename R>
+NANO_CONCEPT concat_steppable_back =
+    bidirectional_range<R> &&
+    (common_range<R> || (random_access_range<R> && sized_range<R>));
+
+template <typename Tuple, std::size_t... I>
+constexpr bool concat_all_steppable_back(std::index_sequence<I...>)
+{
+    return (concat_steppable_back<std::tuple_element_t<I, Tuple>> && ...);
+}
+
+template <typename I, typename Tuple>
+inline constexpr bool concat_swappable_with_all = false;
+
+template <typename I, typename... Js>
+inline constexpr bool concat_swappable_with_all<I, std::tuple<Js...>> =
+    (indirectly_swappable<I, Js> && ...);
+
+} // namespace detail
+
+// A view of the elements of each of its ranges in turn, as their common
+// reference type. Its iterators are segmented (see
+// detail/iterator/segmented.hpp), so that copy() and for_each() over it run
+// a separate loop over each of the ranges.
+namespace concat_view_ {
+
+template <typename... Vs>
+struct concat_view : view_interface<concat_view<Vs...>> {
+private:
+    static_assert(sizeof...(Vs) > 0);
+    static_assert((input_range<Vs> && ...));
+    static_assert((view<Vs> && ...));
+
+    static constexpr std::size_t last_index = sizeof...(Vs) - 1;
+
+    template <bool Const, typename V>
+    using base_t = detail::conditional_t<Const, const V, V>;
+
+    template <bool Const, std::size_t N>
+    using nth_t = base_t<Const, std::tuple_element_t<N, std::tuple<Vs...>>>;
+
+    template <bool Const>
+    static constexpr bool all_forward = (forward_range<base_t<Const, Vs>> && ...);
+
+    template <bool Const>
+    static constexpr bool all_bidirectional =
+        (bidirectional_range<base_t<Const, Vs>> && ...) &&
+        detail::concat_all_steppable_back<std::tuple<base_t<Const, Vs>...>>(
+            std::make_index_sequence<last_index>{});
+
+    template <bool Const>
+    static constexpr bool all_random_access =
+        ((random_access_range<base_t<Const, Vs>> &&
+          sized_range<base_t<Const, Vs>>) && ...);
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct concat_view;
+
+        using Parent =
+            detail::conditional_t<Const, const concat_view, concat_view>;
+        using variant_t = std::variant<iterator_t<base_t<Const, Vs>>...>;
+        using rvalue_reference =
+            common_reference_t<range_rvalue_reference_t<base_t<Const, Vs>>...>;
+
+        Parent* parent_ = nullptr;
+        variant_t it_;
+
+        template <std::size_t N, typename It>
+        constexpr iterator(Parent& parent, std::in_place_index_t<N> idx,
+                           It it)
+            : parent_(std::addressof(parent)),
+              it_(idx, std::move(it))
+        {}
+
+        template <std::size_t N>
+        constexpr auto& seg() const
+        {
+            return std::get<N>(parent_->bases_);
+        }
+
+        template <typename F>
+        constexpr decltype(auto) visit(F&& f) const
+        {
+            return detail::concat_visit_index<0, sizeof...(Vs)>(
+                it_.index(), std::forward<F>(f));
+        }
+
+        // Moves on from the end of the N-th range, and of any empty ranges
+        // after it, to the start of the next non-empty one
+        template <std::size_t N>
+        constexpr void satisfy()
+        {
+            if constexpr (N < last_index) {
+                if (std::get<N>(it_) == ranges::end(seg<N>())) {
+                    it_.template emplace<N + 1>(ranges::begin(seg<N + 1>()));
+                    satisfy<N + 1>();
+                }
+            }
+        }
+
+        template <std::size_t N>
+        constexpr auto seg_end() const
+        {
+            if constexpr (common_range<nth_t<Const, N>>) {
+                return ranges::end(seg<N>());
+            } else {
+                return ranges::begin(seg<N>()) + ranges::distance(seg<N>());
+            }
+        }
+
+        template <std::size_t N>
+        constexpr void prev()
+        {
+            if constexpr (N == 0) {
+                --std::get<0>(it_);
+            } else {
+                if (std::get<N>(it_) == ranges::begin(seg<N>())) {
+                    it_.template emplace<N - 1>(seg_end<N - 1>());
+                    prev<N - 1>();
+                } else {
+                    --std::get<N>(it_);
+                }
+            }
+        }
+
+        template <std::size_t N, typename D>
+        constexpr void advance_fwd(D offset, D steps)
+        {
+            using ND = range_difference_t<nth_t<Const, N>>;
+            if constexpr (N == last_index) {
+                std::get<N>(it_) += static_cast<ND>(steps);
+            } else {
+                const auto size = static_cast<D>(ranges::distance(seg<N>()));
+                if (offset + steps < size) {
+                    std::get<N>(it_) += static_cast<ND>(steps);
+                } else {
+                    it_.template emplace<N + 1>(ranges::begin(seg<N + 1>()));
+                    advance_fwd<N + 1>(D{0}, offset + steps - size);
+                }
+            }
+        }
+
+        template <std::size_t N, typename D>
+        constexpr void advance_bwd(D offset, D steps)
+        {
+            using ND = range_difference_t<nth_t<Const, N>>;
+            if constexpr (N == 0) {
+                std::get<N>(it_) -= static_cast<ND>(steps);
+            } else {
+                if (offset >= steps) {
+                    std::get<N>(it_) -= static_cast<ND>(steps);
+                } else {
+                    const auto size =
+                        static_cast<D>(ranges::distance(seg<N - 1>()));
+                    it_.template emplace<N - 1>(ranges::begin(seg<N - 1>()) +
+                                                size);
+                    advance_bwd<N - 1>(size, steps - offset);
+                }
+            }
+        }
+
+        template <std::size_t N, typename D>
+        constexpr D size_before() const
+        {
+            if constexpr (N == 0) {
+                return D{0};
+            } else {
+                return size_before<N - 1, D>() +
+                       static_cast<D>(ranges::distance(seg<N - 1>()));
+            }
+        }
+
+        // The position of the iterator counting from the start of the
+        // first range
+        template <typename D>
+        constexpr D offset() const
+        {
+            return visit([this](auto n) -> D {
+                constexpr std::size_t N = decltype(n)::value;
+                return size_before<N, D>() +
+                       static_cast<D>(std::get<N>(it_) -
+                                      ranges::begin(seg<N>()));
+            });
+        }
+
+        // Calls f over each part of [*this, last) lying in one of the
+        // ranges, leaving *this at last. last is null for the end.
+        template <std::size_t N, typename F>
+        constexpr void segments(const iterator* last, F& f)
+        {
+            if (last && last->it_.index() == N) {
+                std::get<N>(it_) =
+                    f(std::move(std::get<N>(it_)), std::get<N>(last->it_));
+                return;
+            }
+            std::get<N>(it_) =
+                f(std::move(std::get<N>(it_)), ranges::end(seg<N>()));
+            if constexpr (N < last_index) {
+                it_.template emplace<N + 1>(ranges::begin(seg<N + 1>()));
+                segments<N + 1>(last, f);
+            }
+        }
+
+        template <typename F>
+        constexpr void segments(const iterator* last, F& f)
+        {
+            visit([this, last, &f](auto n) {
+                segments<decltype(n)::value>(last, f);
+            });
+        }
+
+    public:
+        using iterator_category = detail::conditional_t<
+            all_random_access<Const>, random_access_iterator_tag,
+            detail::conditional_t<
+                all_bidirectional<Const>, bidirectional_iterator_tag,
+                detail::conditional_t<all_forward<Const>,
+                                      forward_iterator_tag,
+                                      input_iterator_tag>>>;
+        using value_type = common_type_t<range_value_t<base_t<Const, Vs>>...>;
+        using difference_type =
+            common_type_t<range_difference_t<base_t<Const, Vs>>...>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference =
+            common_reference_t<range_reference_t<base_t<Const, Vs>>...>;
+
+        iterator() = default;
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<
+            C && (convertible_to<iterator_t<Vs>, iterator_t<base_t<C, Vs>>> &&
+                  ...),
+            int> = 0>
+        constexpr iterator(I i)
+            : parent_(i.parent_),
+              it_(i.visit([&i](auto n) {
+                  constexpr std::size_t N = decltype(n)::value;
+                  return variant_t(std::in_place_index<N>,
+                                   std::get<N>(std::move(i.it_)));
+              }))
+        {}
+
+        constexpr reference operator*() const
+        {
+            return visit([this](auto n) -> reference {
+                return *std::get<decltype(n)::value>(it_);
+            });
+        }
+
+        constexpr iterator& operator++()
+        {
+            visit([this](auto n) {
+                constexpr std::size_t N = decltype(n)::value;
+                ++std::get<N>(it_);
+                satisfy<N>();
+            });
+            return *this;
+        }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (all_forward<Const>) {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            } else {
+                ++*this;
+            }
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--()
+            -> std::enable_if_t<all_bidirectional<C>, iterator&>
+        {
+            visit([this](auto n) { prev<decltype(n)::value>(); });
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<all_bidirectional<C>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator&>
+        {
+            visit([this, n](auto i) {
+                constexpr std::size_t N = decltype(i)::value;
+                const auto offset = static_cast<difference_type>(
+                    std::get<N>(it_) - ranges::begin(seg<N>()));
+                if (n > 0) {
+                    advance_fwd<N>(offset, n);
+                } else if (n < 0) {
+                    advance_bwd<N>(offset, -n);
+                }
+            });
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator&>
+        {
+            return *this += -n;
+        }
+
+        template <bool C = Const, std::enable_if_t<all_random_access<C>, int> = 0>
+        constexpr reference operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator==(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                (equality_comparable<iterator_t<base_t<C, Vs>>> && ...), bool>
+        {
+            return x.it_ == y.it_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator!=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                (equality_comparable<iterator_t<base_t<C, Vs>>> && ...), bool>
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator==(const iterator& x, default_sentinel_t)
+        {
+            return x.it_.index() == last_index &&
+                   std::get<last_index>(x.it_) ==
+                       ranges::end(x.template seg<last_index>());
+        }
+
+        friend constexpr bool operator==(default_sentinel_t s, const iterator& x)
+        {
+            return x == s;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t s, const iterator& x)
+        {
+            return !(x == s);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return x.it_ < y.it_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return y < x;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, difference_type>
+        {
+            return x.template offset<difference_type>() -
+                   y.template offset<difference_type>();
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(default_sentinel_t, const iterator& x)
+            -> std::enable_if_t<all_random_access<C>, difference_type>
+        {
+            return x.template size_before<last_index + 1, difference_type>() -
+                   x.template offset<difference_type>();
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator& x, default_sentinel_t s)
+            -> std::enable_if_t<all_random_access<C>, difference_type>
+        {
+            return -(s - x);
+        }
+
+        friend constexpr rvalue_reference iter_move(const iterator& i)
+        {
+            return i.visit([&i](auto n) -> rvalue_reference {
+                return ranges::iter_move(std::get<decltype(n)::value>(i.it_));
+            });
+        }
+
+        template <bool C = Const>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            -> std::enable_if_t<(detail::concat_swappable_with_all<
+                                     iterator_t<base_t<C, Vs>>,
+                                     std::tuple<iterator_t<base_t<C, Vs>>...>> &&
+                                 ...)>
+        {
+            std::visit([](const auto& a, const auto& b) {
+                ranges::iter_swap(a, b);
+            }, x.it_, y.it_);
+        }
+
+        // The segmented iterator interface
+        template <typename F>
+        friend constexpr iterator for_each_segment(iterator first,
+                                                   const iterator& last, F&& f)
+        {
+            first.segments(std::addressof(last), f);
+            return first;
+        }
+
+        template <typename F>
+        friend constexpr iterator for_each_segment(iterator first,
+                                                   default_sentinel_t, F&& f)
+        {
+            first.segments(nullptr, f);
+            return first;
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr iterator<Const> begin_impl(Self& self)
+    {
+        iterator<Const> it(self, std::in_place_index<0>,
+                           ranges::begin(std::get<0>(self.bases_)));
+        it.template satisfy<0>();
+        return it;
+    }
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        // Input iterators may only be compared with the end
+        if constexpr (common_range<nth_t<Const, last_index>> &&
+                      all_forward<Const>) {
+            return iterator<Const>(
+                self, std::in_place_index<last_index>,
+                ranges::end(std::get<last_index>(self.bases_)));
+        } else {
+            return default_sentinel;
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        return std::apply([](auto&... bases) {
+            using size_type = std::make_unsigned_t<
+                common_type_t<decltype(ranges::size(bases))...>>;
+            return (size_type{0} + ... +
+                    static_cast<size_type>(ranges::size(bases)));
+        }, self.bases_);
+    }
+
+    std::tuple<Vs...> bases_;
+
+public:
+    concat_view() = default;
+
+    constexpr explicit concat_view(Vs... bases)
+        : bases_(std::move(bases)...)
+    {}
+
+    constexpr iterator<false> begin()
+    {
+        return concat_view::begin_impl<false>(*this);
+    }
+
+    template <bool C = true,
+              std::enable_if_t<C && (range<const Vs> && ...), int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return concat_view::begin_impl<true>(*this);
+    }
+
+    constexpr auto end()
+    {
+        return concat_view::end_impl<false>(*this);
+    }
+
+    template <bool C = true,
+              std::enable_if_t<C && (range<const Vs> && ...), int> = 0>
+    constexpr auto end() const
+    {
+        return concat_view::end_impl<true>(*this);
+    }
+
+    template <bool C = false,
+              std::enable_if_t<(sized_range<base_t<C, Vs>> && ...), int> = 0>
+    constexpr auto size()
+    {
+        return concat_view::size_impl(*this);
+    }
+
+    template <bool C = true,
+              std::enable_if_t<(sized_range<base_t<C, Vs>> && ...), int> = 0>
+    constexpr auto size() const
+    {
+        return concat_view::size_impl(*this);
+    }
+};
+
+template <typename... Rs>
+concat_view(Rs&&...) -> concat_view<all_view<Rs>...>;
+
+} // namespace concat_view_
+
+using concat_view_::concat_view;
+
+namespace detail {
+
+struct concat_view_fn {
+    template <typename E>
+    constexpr auto operator()(E&& e) const
+        -> decltype(views::all(std::forward<E>(e)))
+    {
+        return views::all(std::forward<E>(e));
+    }
+
+    template <typename... Es, std::enable_if_t<(sizeof...(Es) > 1), int> = 0>
+    constexpr auto operator()(Es&&... es) const
+        -> decltype(concat_view<all_view<Es>...>(
+            views::all(std::forward<Es>(es))...))
+    {
+        return concat_view<all_view<Es>...>(
+            views::all(std::forward<Es>(es))...);
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::concat_view_fn, concat)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,202 @@
+// nanorange/views/merge.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_MERGE_HPP_INCLUDED
+#define NANORANGE_VIEWS_MERGE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/loser_tree.hpp>
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/detail/views/semiregular_box.hpp>
+#include <nanorange/iterator/default_sentinel.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+
+#include <tuple>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: a view of the elements of a range of sorted ranges, in sorted
+// order, as merge_n would write them. Elements are pulled from the inner
+// ranges only as the view is iterated. As with istream_view, the merge state
+// lives in the view, so the view is an input range, and calling begin()
+// again restarts the merge.
+namespace merge_view_ {
+
+template <typename V, typename Comp = ranges::less, typename Proj = identity>
+struct merge_view : view_interface<merge_view<V, Comp, Proj>> {
+private:
+    using inner_t = range_reference_t<V>;
+
+    static_assert(forward_range<V>);
+    static_assert(view<V>);
+    static_assert(input_range<inner_t>);
+    static_assert(detail::forwarding_range<inner_t>);
+    static_assert(std::is_object_v<Comp>);
+    static_assert(indirect_strict_weak_order<
+                  Comp, projected<iterator_t<inner_t>, Proj>>);
+
+    struct iterator {
+        using iterator_category = input_iterator_tag;
+        using difference_type = iter_difference_t<iterator_t<inner_t>>;
+        using value_type = range_value_t<inner_t>;
+
+        iterator() = default;
+
+        constexpr explicit iterator(merge_view& parent) noexcept
+            : parent_(std::addressof(parent))
+        {}
+
+        iterator& operator++()
+        {
+            parent_->tree_.pop(*parent_->comp_, *parent_->proj_);
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        range_reference_t<inner_t> operator*() const
+        {
+            return *parent_->tree_.top();
+        }
+
+        friend bool operator==(const iterator& x, default_sentinel_t)
+        {
+            return x.done();
+        }
+
+        friend bool operator==(default_sentinel_t s, const iterator& x)
+        {
+            return x == s;
+        }
+
+        friend bool operator!=(const iterator& x, default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend bool operator!=(default_sentinel_t s, const iterator& x)
+        {
+            return !(x == s);
+        }
+
+    private:
+        [[nodiscard]] bool done() const
+        {
+            return parent_ == nullptr || parent_->tree_.empty();
+        }
+
+        merge_view* parent_{};
+    };
+
+    V base_ = V();
+    detail::semiregular_box<Comp> comp_;
+    detail::semiregular_box<Proj> proj_;
+    detail::loser_tree<iterator_t<inner_t>, sentinel_t<inner_t>, Proj> tree_;
+
+public:
+    merge_view() = default;
+
+    constexpr explicit merge_view(V base, Comp comp = Comp{},
+                                  Proj proj = Proj{})
+        : base_(std::move(base)),
+          comp_(std::move(comp)),
+          proj_(std::move(proj))
+    {}
+
+    constexpr V base() const { return base_; }
+
+    iterator begin()
+    {
+        tree_ = {};
+        for (auto&& r : base_) {
+            tree_.add(nano::begin(r), nano::end(r));
+        }
+        tree_.build(*comp_, *proj_);
+        return iterator{*this};
+    }
+
+    constexpr default_sentinel_t end() const noexcept
+    {
+        return default_sentinel;
+    }
+};
+
+template <typename R>
+explicit merge_view(R&&) -> merge_view<all_view<R>>;
+
+template <typename R, typename Comp>
+merge_view(R&&, Comp) -> merge_view<all_view<R>, Comp>;
+
+template <typename R, typename Comp, typename Proj>
+merge_view(R&&, Comp, Proj) -> merge_view<all_view<R>, Comp, Proj>;
+
+} // namespace merge_view_
+
+using merge_view_::merge_view;
+
+namespace detail {
+
+struct merge_view_fn {
+    template <typename E>
+    constexpr auto operator()(E&& e) const
+        -> decltype(merge_view{views::all(std::forward<E>(e))})
+    {
+        return merge_view{views::all(std::forward<E>(e))};
+    }
+
+    template <typename E, typename Comp, typename... Proj,
+              std::enable_if_t<viewable_range<E> && sizeof...(Proj) <= 1,
+                               int> = 0>
+    constexpr auto operator()(E&& e, Comp comp, Proj... proj) const
+        -> decltype(merge_view{views::all(std::forward<E>(e)), std::move(comp),
+                               std::move(proj)...})
+    {
+        return merge_view{views::all(std::forward<E>(e)), std::move(comp),
+                          std::move(proj)...};
+    }
+
+    template <typename Comp, typename... Proj,
+              std::enable_if_t<!range<Comp> && sizeof...(Proj) <= 1,
+                               int> = 0>
+    constexpr auto operator()(Comp comp, Proj... proj) const
+    {
+        return detail::rao_proxy{
+            [c = std::move(comp), p = std::make_tuple(std::move(proj)...)](
+                auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(merge_view{views::all(std::forward<decltype(r)>(r)),
+                                   std::declval<Comp&&>(),
+                                   std::declval<Proj&&>()...})
+#endif
+            {
+                return std::apply(
+                    [&](auto&... ps) {
+                        return merge_view{
+                            views::all(std::forward<decltype(r)>(r)),
+                            std::move(c), std::move(ps)...};
+                    },
+                    p);
+            }};
+    }
+};
+
+template <>
+inline constexpr bool is_raco<merge_view_fn> = true;
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::merge_view_fn, merge)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,413 @@
+// nanorange/views/slide.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_SLIDE_HPP_INCLUDED
+#define NANORANGE_VIEWS_SLIDE_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/iterator/operations.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+#include <nanorange/views/subrange.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// A view of the windows of n consecutive elements of a forward range, as
+// subranges of its iterators. A range of fewer than n elements has no
+// windows.
+namespace slide_view_ {
+
+template <typename V>
+struct slide_view : view_interface<slide_view<V>> {
+private:
+    static_assert(forward_range<V>);
+    static_assert(view<V>);
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct sentinel<Const>;
+        friend struct slide_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+        using I = iterator_t<Base>;
+
+        I current_ = I();
+        // The last element of the window at current_. We compare these
+        // rather than current_, as the end of the windows is the end of the
+        // range here.
+        I last_ = I();
+
+        constexpr iterator(I current, I last)
+            : current_(std::move(current)),
+              last_(std::move(last))
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            derived_from<iterator_category_t<I>, contiguous_iterator_tag>,
+            random_access_iterator_tag, iterator_category_t<I>>;
+        using value_type = subrange<I>;
+        using difference_type = range_difference_t<Base>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = subrange<I>;
+
+        iterator() = default;
+
+        template <typename It,
+            std::enable_if_t<same_as<It, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, I>, int> = 0>
+        constexpr iterator(It i)
+            : current_(std::move(i.current_)),
+              last_(std::move(i.last_))
+        {}
+
+        constexpr I base() const { return current_; }
+
+        constexpr reference operator*() const
+        {
+            return reference(current_, ranges::next(last_));
+        }
+
+        constexpr iterator& operator++()
+        {
+            ++current_;
+            ++last_;
+            return *this;
+        }
+
+        constexpr iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            --current_;
+            --last_;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            current_ += n;
+            last_ += n;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            current_ -= n;
+            last_ -= n;
+            return *this;
+        }
+
+        template <typename B = Base, std::enable_if_t<random_access_range<B>, int> = 0>
+        constexpr reference operator[](difference_type n) const
+        {
+            return reference(current_ + n, last_ + (n + 1));
+        }
+
+        friend constexpr bool operator==(const iterator& x, const iterator& y)
+        {
+            return x.last_ == y.last_;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, const iterator& y)
+        {
+            return !(x == y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.last_ < y.last_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return x.last_ - y.last_;
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        sentinel_t<Base> end_ = sentinel_t<Base>();
+
+        static constexpr const iterator_t<Base>& last(const iterator<Const>& i)
+        {
+            return i.last_;
+        }
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(sentinel_t<Base> end)
+            : end_(std::move(end))
+        {}
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<sentinel_t<VV>, sentinel_t<Base>>, int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return last(x) == y.end_;
+        }
+
+        friend constexpr bool operator==(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return !(y == x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator<Const>& x,
+                                        const sentinel& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                range_difference_t<B>>
+        {
+            return last(x) - y.end_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const sentinel& x,
+                                        const iterator<Const>& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                range_difference_t<B>>
+        {
+            return x.end_ - last(y);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr iterator<Const> begin_impl(Self& self)
+    {
+        auto first = ranges::begin(self.base_);
+        auto last = ranges::next(first, self.n_ - 1, ranges::end(self.base_));
+        return iterator<Const>(std::move(first), std::move(last));
+    }
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        if constexpr (random_access_range<Base> && sized_range<Base>) {
+            const auto first = ranges::begin(self.base_);
+            const auto sz = ranges::distance(self.base_);
+            const auto windows = sz < self.n_ ? 0 : sz - self.n_ + 1;
+            return iterator<Const>(first + windows, first + sz);
+        } else if constexpr (bidirectional_range<Base> && common_range<Base>) {
+            const auto first = ranges::begin(self.base_);
+            auto last = ranges::end(self.base_);
+            auto current = last;
+            for (range_difference_t<Base> i = 1;
+                 i < self.n_ && current != first; ++i) {
+                --current;
+            }
+            return iterator<Const>(std::move(current), std::move(last));
+        } else if constexpr (common_range<Base>) {
+            return iterator<Const>(ranges::end(self.base_),
+                                   ranges::end(self.base_));
+        } else {
+            return sentinel<Const>(ranges::end(self.base_));
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        const auto sz = ranges::size(self.base_);
+        const auto n = static_cast<decltype(sz)>(self.n_);
+        return sz < n ? 0 : sz - n + 1;
+    }
+
+    V base_ = V();
+    range_difference_t<V> n_ = 0;
+
+public:
+    slide_view() = default;
+
+    constexpr slide_view(V base, range_difference_t<V> n)
+        : base_(std::move(base)),
+          n_(n)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr iterator<false> begin()
+    {
+        return slide_view::begin_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return slide_view::begin_impl<true>(*this);
+    }
+
+    constexpr auto end()
+    {
+        return slide_view::end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<forward_range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return slide_view::end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return slide_view::size_impl(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return slide_view::size_impl(*this);
+    }
+};
+
+template <typename R>
+slide_view(R&&, range_difference_t<R>) -> slide_view<all_view<R>>;
+
+} // namespace slide_view_
+
+using slide_view_::slide_view;
+
+namespace detail {
+
+struct slide_view_fn {
+    template <typename E, typename D>
+    constexpr auto operator()(E&& e, D n) const
+        -> decltype(slide_view{std::forward<E>(e), n})
+    {
+        return slide_view{std::forward<E>(e), n};
+    }
+
+    template <typename D, std::enable_if_t<std::is_integral_v<D>, int> = 0>
+    constexpr auto operator()(D n) const
+    {
+        return detail::rao_proxy{[n](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(slide_view{std::forward<decltype(r)>(r), n})
+#endif
+        {
+            return slide_view{std::forward<decltype(r)>(r), n};
+        }};
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::slide_view_fn, slide)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
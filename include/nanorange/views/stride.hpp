@@ -0,0 +1,412 @@
+// nanorange/views/stride.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_STRIDE_HPP_INCLUDED
+#define NANORANGE_VIEWS_STRIDE_HPP_INCLUDED
+
+#include <nanorange/detail/views/range_adaptors.hpp>
+#include <nanorange/iterator/default_sentinel.hpp>
+#include <nanorange/iterator/operations.hpp>
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/interface.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename I>
+constexpr I stride_div_ceil(I num, I denom)
+{
+    return num / denom + (num % denom != 0 ? 1 : 0);
+}
+
+} // namespace detail
+
+// A view of every n-th element of a range, starting with the first. Each
+// step is a single bounded ranges::advance(), so random-access ranges are
+// stepped through in constant time rather than element by element.
+namespace stride_view_ {
+
+template <typename V>
+struct stride_view : view_interface<stride_view<V>> {
+private:
+    static_assert(input_range<V>);
+    static_assert(view<V>);
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct stride_view;
+
+        using Base = detail::conditional_t<Const, const V, V>;
+        using I = iterator_t<Base>;
+        using S = sentinel_t<Base>;
+        using D = range_difference_t<Base>;
+
+        I current_ = I();
+        S end_ = S();
+        D stride_ = 0;
+        // How far short of the stride the last step fell, on reaching the
+        // end, so that we can step back from it
+        D missing_ = 0;
+
+        constexpr iterator(I current, S end, D stride, D missing = 0)
+            : current_(std::move(current)),
+              end_(std::move(end)),
+              stride_(stride),
+              missing_(missing)
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            derived_from<iterator_category_t<I>, contiguous_iterator_tag>,
+            random_access_iterator_tag, iterator_category_t<I>>;
+        using value_type = range_value_t<Base>;
+        using difference_type = D;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = range_reference_t<Base>;
+
+        iterator() = default;
+
+        template <typename It,
+            std::enable_if_t<same_as<It, iterator<!Const>>, int> = 0,
+            bool C = Const, typename VV = V, std::enable_if_t<
+            C && convertible_to<iterator_t<VV>, I> &&
+            convertible_to<sentinel_t<VV>, S>, int> = 0>
+        constexpr iterator(It i)
+            : current_(std::move(i.current_)),
+              end_(std::move(i.end_)),
+              stride_(i.stride_),
+              missing_(i.missing_)
+        {}
+
+        constexpr I base() const { return current_; }
+
+        constexpr decltype(auto) operator*() const { return *current_; }
+
+        constexpr iterator& operator++()
+        {
+            missing_ = ranges::advance(current_, stride_, end_);
+            return *this;
+        }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (forward_range<Base>) {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            } else {
+                ++*this;
+            }
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<B>, iterator&>
+        {
+            ranges::advance(current_, missing_ - stride_);
+            missing_ = 0;
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<B>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            if (n > 0) {
+                missing_ = ranges::advance(current_, stride_ * n, end_);
+            } else if (n < 0) {
+                ranges::advance(current_, stride_ * n + missing_);
+                missing_ = 0;
+            }
+            return *this;
+        }
+
+        template <typename B = Base>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator&>
+        {
+            return *this += -n;
+        }
+
+        template <typename B = Base, std::enable_if_t<random_access_range<B>, int> = 0>
+        constexpr decltype(auto) operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator==(const iterator& x, const iterator& y)
+            -> std::enable_if_t<equality_comparable<iterator_t<B>>, bool>
+        {
+            return x.current_ == y.current_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator!=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<equality_comparable<iterator_t<B>>, bool>
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator==(const iterator& x, default_sentinel_t)
+        {
+            return x.current_ == x.end_;
+        }
+
+        friend constexpr bool operator==(default_sentinel_t s, const iterator& x)
+        {
+            return x == s;
+        }
+
+        friend constexpr bool operator!=(const iterator& x, default_sentinel_t s)
+        {
+            return !(x == s);
+        }
+
+        friend constexpr bool operator!=(default_sentinel_t s, const iterator& x)
+        {
+            return !(x == s);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return x.current_ < y.current_;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return y < x;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<B>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<B>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                sized_sentinel_for<iterator_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            const D n = x.current_ - y.current_;
+            if constexpr (forward_range<Base>) {
+                return (n + x.missing_ - y.missing_) / x.stride_;
+            } else {
+                // Input iterators never step back, so have no use for
+                // missing_; we round away from zero instead
+                return n < 0 ? -detail::stride_div_ceil(-n, x.stride_)
+                             : detail::stride_div_ceil(n, x.stride_);
+            }
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(default_sentinel_t, const iterator& x)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return detail::stride_div_ceil(D(x.end_ - x.current_), x.stride_);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto operator-(const iterator& x, default_sentinel_t s)
+            -> std::enable_if_t<
+                sized_sentinel_for<sentinel_t<B>, iterator_t<B>>,
+                difference_type>
+        {
+            return -(s - x);
+        }
+
+        friend constexpr range_rvalue_reference_t<Base>
+        iter_move(const iterator& i) noexcept(
+            noexcept(ranges::iter_move(i.current_)))
+        {
+            return ranges::iter_move(i.current_);
+        }
+
+        template <typename B = Base>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            noexcept(noexcept(ranges::iter_swap(x.current_, y.current_)))
+            -> std::enable_if_t<indirectly_swappable<iterator_t<B>>>
+        {
+            ranges::iter_swap(x.current_, y.current_);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        using Base = detail::conditional_t<Const, const V, V>;
+
+        if constexpr (common_range<Base> && sized_range<Base> &&
+                      forward_range<Base>) {
+            const auto missing =
+                (self.stride_ - ranges::distance(self.base_) % self.stride_) %
+                self.stride_;
+            return iterator<Const>(ranges::end(self.base_),
+                                   ranges::end(self.base_), self.stride_,
+                                   missing);
+        } else if constexpr (common_range<Base> && forward_range<Base> &&
+                             !bidirectional_range<Base>) {
+            return iterator<Const>(ranges::end(self.base_),
+                                   ranges::end(self.base_), self.stride_);
+        } else {
+            return default_sentinel;
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        const auto sz = ranges::size(self.base_);
+        return detail::stride_div_ceil(
+            sz, static_cast<decltype(sz)>(self.stride_));
+    }
+
+    V base_ = V();
+    range_difference_t<V> stride_ = 1;
+
+public:
+    stride_view() = default;
+
+    constexpr stride_view(V base, range_difference_t<V> stride)
+        : base_(std::move(base)),
+          stride_(stride)
+    {}
+
+    constexpr V base() const { return base_; }
+
+    constexpr range_difference_t<V> stride() const noexcept { return stride_; }
+
+    constexpr iterator<false> begin()
+    {
+        return iterator<false>(ranges::begin(base_), ranges::end(base_),
+                               stride_);
+    }
+
+    template <typename VV = V, std::enable_if_t<range<const VV>, int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return iterator<true>(ranges::begin(base_), ranges::end(base_),
+                              stride_);
+    }
+
+    constexpr auto end()
+    {
+        return stride_view::end_impl<false>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<range<const VV>, int> = 0>
+    constexpr auto end() const
+    {
+        return stride_view::end_impl<true>(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<VV>, int> = 0>
+    constexpr auto size()
+    {
+        return stride_view::size_impl(*this);
+    }
+
+    template <typename VV = V, std::enable_if_t<sized_range<const VV>, int> = 0>
+    constexpr auto size() const
+    {
+        return stride_view::size_impl(*this);
+    }
+};
+
+template <typename R>
+stride_view(R&&, range_difference_t<R>) -> stride_view<all_view<R>>;
+
+} // namespace stride_view_
+
+using stride_view_::stride_view;
+
+namespace detail {
+
+struct stride_view_fn {
+    template <typename E, typename D>
+    constexpr auto operator()(E&& e, D n) const
+        -> decltype(stride_view{std::forward<E>(e), n})
+    {
+        return stride_view{std::forward<E>(e), n};
+    }
+
+    template <typename D, std::enable_if_t<std::is_integral_v<D>, int> = 0>
+    constexpr auto operator()(D n) const
+    {
+        return detail::rao_proxy{[n](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+            -> decltype(stride_view{std::forward<decltype(r)>(r), n})
+#endif
+        {
+            return stride_view{std::forward<decltype(r)>(r), n};
+        }};
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::stride_view_fn, stride)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
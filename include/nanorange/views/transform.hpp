@@ -14,6 +14,9 @@
 
 NANO_BEGIN_NAMESPACE
 
+// The function is called each time an element is read. If something further
+// down the pipeline reads each element more than once, as filter_view does,
+// put a views::cache_latest after the transform to call it just once.
 namespace transform_view_ {
 
 template <typename V, typename F>
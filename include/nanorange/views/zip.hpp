@@ -0,0 +1,667 @@
+// nanorange/views/zip.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_ZIP_HPP_INCLUDED
+#define NANORANGE_VIEWS_ZIP_HPP_INCLUDED
+
+#include <nanorange/views/all.hpp>
+#include <nanorange/views/empty.hpp>
+#include <nanorange/views/interface.hpp>
+
+#include <tuple>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <typename Tuple, typename Other, std::size_t... I>
+constexpr bool zip_tuple_constructible_impl(std::index_sequence<I...>)
+{
+    return (std::is_constructible_v<
+                std::tuple_element_t<I, Tuple>,
+                decltype(std::get<I>(std::declval<Other>()))> && ...);
+}
+
+template <typename Tuple, typename Other, typename = void>
+inline constexpr bool zip_tuple_constructible = false;
+
+template <typename Tuple, typename Other>
+inline constexpr bool zip_tuple_constructible<
+    Tuple, Other,
+    std::enable_if_t<std::tuple_size<Tuple>::value ==
+                     std::tuple_size<remove_cvref_t<Other>>::value>> =
+    zip_tuple_constructible_impl<Tuple, Other>(
+        std::make_index_sequence<std::tuple_size<Tuple>::value>{});
+
+template <typename Target, typename Other, std::size_t... I>
+constexpr bool zip_tuple_assignable_impl(std::index_sequence<I...>)
+{
+    return (std::is_assignable_v<
+                decltype(std::get<I>(std::declval<Target>())),
+                decltype(std::get<I>(std::declval<Other>()))> && ...);
+}
+
+template <typename Target, typename Other, typename = void>
+inline constexpr bool zip_tuple_assignable = false;
+
+template <typename Target, typename Other>
+inline constexpr bool zip_tuple_assignable<
+    Target, Other,
+    std::enable_if_t<std::tuple_size<remove_cvref_t<Target>>::value ==
+                     std::tuple_size<remove_cvref_t<Other>>::value>> =
+    zip_tuple_assignable_impl<Target, Other>(std::make_index_sequence<
+        std::tuple_size<remove_cvref_t<Target>>::value>{});
+
+// The reference type of zip_view: a std::tuple of the references of the
+// zipped ranges. Like a reference, it assigns through to the elements even
+// when it is const, and it converts to and from tuples of the values, so
+// that zipped ranges are writable and sortable.
+template <typename... Ts>
+struct zip_tuple : std::tuple<Ts...> {
+private:
+    using base_t = std::tuple<Ts...>;
+
+    template <std::size_t... I, typename Other>
+    constexpr zip_tuple(std::index_sequence<I...>, Other&& other)
+        : base_t(std::get<I>(std::forward<Other>(other))...)
+    {}
+
+    template <typename Target, typename Other, std::size_t... I>
+    static constexpr void assign(Target& target, Other&& other,
+                                 std::index_sequence<I...>)
+    {
+        ((void) (std::get<I>(target) = std::get<I>(std::forward<Other>(other))),
+         ...);
+    }
+
+public:
+    using std::tuple<Ts...>::tuple;
+
+    template <typename Other,
+              std::enable_if_t<!same_as<remove_cvref_t<Other>, zip_tuple> &&
+                               zip_tuple_constructible<base_t, Other>, int> = 0>
+    constexpr zip_tuple(Other&& other)
+        : zip_tuple(std::index_sequence_for<Ts...>{},
+                    std::forward<Other>(other))
+    {}
+
+    template <typename Other,
+              std::enable_if_t<zip_tuple_assignable<base_t&, Other>, int> = 0>
+    constexpr zip_tuple& operator=(Other&& other)
+    {
+        zip_tuple::assign(static_cast<base_t&>(*this),
+                          std::forward<Other>(other),
+                          std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+
+    template <typename Other,
+              std::enable_if_t<zip_tuple_assignable<const base_t&, Other>,
+                               int> = 0>
+    constexpr const zip_tuple& operator=(Other&& other) const
+    {
+        zip_tuple::assign(static_cast<const base_t&>(*this),
+                          std::forward<Other>(other),
+                          std::index_sequence_for<Ts...>{});
+        return *this;
+    }
+};
+
+template <typename T, typename U, typename = void>
+struct zip_tuple_common_reference {};
+
+template <typename... Ts, typename... Us>
+struct zip_tuple_common_reference<
+    std::tuple<Ts...>, std::tuple<Us...>,
+    std::void_t<zip_tuple<common_reference_t<Ts, Us>...>>> {
+    using type = zip_tuple<common_reference_t<Ts, Us>...>;
+};
+
+} // namespace detail
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<detail::zip_tuple<Ts...>,
+                              detail::zip_tuple<Us...>, TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<TQual<Ts>...>,
+                                         std::tuple<UQual<Us>...>> {};
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<detail::zip_tuple<Ts...>, std::tuple<Us...>,
+                              TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<TQual<Ts>...>,
+                                         std::tuple<UQual<Us>...>> {};
+
+template <typename... Ts, typename... Us, template <class> class TQual,
+          template <class> class UQual>
+struct basic_common_reference<std::tuple<Ts...>, detail::zip_tuple<Us...>,
+                              TQual, UQual>
+    : detail::zip_tuple_common_reference<std::tuple<TQual<Ts>...>,
+                                         std::tuple<UQual<Us>...>> {};
+
+namespace detail {
+
+template <typename T, typename U, std::size_t... I>
+constexpr bool zip_any_equal(const T& x, const U& y, std::index_sequence<I...>)
+{
+    return ((std::get<I>(x) == std::get<I>(y)) || ...);
+}
+
+// Of the distances between the corresponding iterators of x and y, the one
+// nearest zero, which is the distance to the end of the shortest range
+template <typename D, typename T, typename U, std::size_t... I>
+constexpr D zip_min_distance(const T& x, const U& y, std::index_sequence<I...>)
+{
+    const D dists[] = {static_cast<D>(std::get<I>(x) - std::get<I>(y))...};
+    D min = dists[0];
+    for (const D d : dists) {
+        if ((d < 0 ? -d : d) < (min < 0 ? -min : min)) {
+            min = d;
+        }
+    }
+    return min;
+}
+
+template <typename F, typename Tuple>
+constexpr auto zip_transform_each(F& f, Tuple& t)
+{
+    return std::apply(
+        [&f](auto&... elems) {
+            return std::tuple<decltype(f(elems))...>(f(elems)...);
+        },
+        t);
+}
+
+} // namespace detail
+
+namespace zip_view_ {
+
+template <typename... Vs>
+struct zip_view : view_interface<zip_view<Vs...>> {
+private:
+    static_assert(sizeof...(Vs) > 0);
+    static_assert((input_range<Vs> && ...));
+    static_assert((view<Vs> && ...));
+
+    template <bool Const, typename V>
+    using base_t = detail::conditional_t<Const, const V, V>;
+
+    template <bool Const>
+    static constexpr bool all_forward = (forward_range<base_t<Const, Vs>> && ...);
+
+    template <bool Const>
+    static constexpr bool all_bidirectional =
+        (bidirectional_range<base_t<Const, Vs>> && ...);
+
+    template <bool Const>
+    static constexpr bool all_random_access =
+        (random_access_range<base_t<Const, Vs>> && ...);
+
+    // Whether end() can return an iterator: if we compare the iterators of
+    // bidirectional ranges elementwise, then the end iterator must have
+    // been reached by advancing begin() by the size
+    template <bool Const>
+    static constexpr bool is_common =
+        (sizeof...(Vs) == 1 && (common_range<base_t<Const, Vs>> && ...)) ||
+        (!all_bidirectional<Const> && (common_range<base_t<Const, Vs>> && ...)) ||
+        (all_random_access<Const> && (sized_range<base_t<Const, Vs>> && ...));
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct sentinel<Const>;
+        friend struct zip_view;
+
+        using tuple_t = std::tuple<iterator_t<base_t<Const, Vs>>...>;
+
+        tuple_t current_;
+
+        constexpr explicit iterator(tuple_t current)
+            : current_(std::move(current))
+        {}
+
+    public:
+        using iterator_category = detail::conditional_t<
+            all_random_access<Const>, random_access_iterator_tag,
+            detail::conditional_t<
+                all_bidirectional<Const>, bidirectional_iterator_tag,
+                detail::conditional_t<all_forward<Const>,
+                                      forward_iterator_tag,
+                                      input_iterator_tag>>>;
+        using value_type = std::tuple<range_value_t<base_t<Const, Vs>>...>;
+        using difference_type =
+            common_type_t<range_difference_t<base_t<Const, Vs>>...>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference =
+            detail::zip_tuple<range_reference_t<base_t<Const, Vs>>...>;
+
+        iterator() = default;
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<
+            C && (convertible_to<iterator_t<Vs>, iterator_t<base_t<C, Vs>>> &&
+                  ...),
+            int> = 0>
+        constexpr iterator(I i)
+            : current_(std::move(i.current_))
+        {}
+
+        constexpr reference operator*() const
+        {
+            return std::apply(
+                [](const auto&... its) { return reference(*its...); },
+                current_);
+        }
+
+        constexpr iterator& operator++()
+        {
+            std::apply([](auto&... its) { (++its, ...); }, current_);
+            return *this;
+        }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (all_forward<Const>) {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            } else {
+                ++*this;
+            }
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--()
+            -> std::enable_if_t<all_bidirectional<C>, iterator&>
+        {
+            std::apply([](auto&... its) { (--its, ...); }, current_);
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<all_bidirectional<C>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator&>
+        {
+            std::apply([n](auto&... its) {
+                ((its += static_cast<iter_difference_t<
+                      remove_cvref_t<decltype(its)>>>(n)), ...);
+            }, current_);
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator&>
+        {
+            std::apply([n](auto&... its) {
+                ((its -= static_cast<iter_difference_t<
+                      remove_cvref_t<decltype(its)>>>(n)), ...);
+            }, current_);
+            return *this;
+        }
+
+        template <bool C = Const, std::enable_if_t<all_random_access<C>, int> = 0>
+        constexpr reference operator[](difference_type n) const
+        {
+            return std::apply([n](const auto&... its) {
+                return reference(its[static_cast<iter_difference_t<
+                    remove_cvref_t<decltype(its)>>>(n)]...);
+            }, current_);
+        }
+
+        // Iterators into bidirectional ranges must compare equal only when
+        // they all do, so that we can decrement from end(); otherwise we
+        // stop at the end of the shortest range
+        template <bool C = Const>
+        friend constexpr auto operator==(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                (equality_comparable<iterator_t<base_t<C, Vs>>> && ...), bool>
+        {
+            if constexpr (all_bidirectional<Const>) {
+                return x.current_ == y.current_;
+            } else {
+                return detail::zip_any_equal(x.current_, y.current_,
+                                             std::index_sequence_for<Vs...>{});
+            }
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator!=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<
+                (equality_comparable<iterator_t<base_t<C, Vs>>> && ...), bool>
+        {
+            return !(x == y);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return x.current_ < y.current_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return y < x;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<all_random_access<C>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<all_random_access<C>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<(sized_sentinel_for<iterator_t<base_t<C, Vs>>,
+                                                    iterator_t<base_t<C, Vs>>> &&
+                                 ...),
+                                difference_type>
+        {
+            return detail::zip_min_distance<difference_type>(
+                x.current_, y.current_, std::index_sequence_for<Vs...>{});
+        }
+
+        friend constexpr auto iter_move(const iterator& i) noexcept(
+            (noexcept(ranges::iter_move(
+                 std::declval<const iterator_t<base_t<Const, Vs>>&>())) &&
+             ...) &&
+            (std::is_nothrow_move_constructible_v<
+                 range_rvalue_reference_t<base_t<Const, Vs>>> &&
+             ...))
+        {
+            return std::apply([](const auto&... its) {
+                return detail::zip_tuple<
+                    range_rvalue_reference_t<base_t<Const, Vs>>...>(
+                    ranges::iter_move(its)...);
+            }, i.current_);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto iter_swap(const iterator& x, const iterator& y)
+            noexcept((noexcept(ranges::iter_swap(
+                          std::declval<const iterator_t<base_t<C, Vs>>&>(),
+                          std::declval<const iterator_t<base_t<C, Vs>>&>())) &&
+                      ...))
+            -> std::enable_if_t<
+                (indirectly_swappable<iterator_t<base_t<C, Vs>>> && ...)>
+        {
+            iterator::swap_each(x.current_, y.current_,
+                                std::index_sequence_for<Vs...>{});
+        }
+
+    private:
+        template <std::size_t... I>
+        static constexpr void swap_each(const tuple_t& x, const tuple_t& y,
+                                        std::index_sequence<I...>)
+        {
+            (ranges::iter_swap(std::get<I>(x), std::get<I>(y)), ...);
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+        friend struct zip_view;
+
+        using tuple_t = std::tuple<sentinel_t<base_t<Const, Vs>>...>;
+
+        tuple_t end_;
+
+        constexpr explicit sentinel(tuple_t end)
+            : end_(std::move(end))
+        {}
+
+        static constexpr const auto& current(const iterator<Const>& i)
+        {
+            return i.current_;
+        }
+
+    public:
+        sentinel() = default;
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<
+            C && (convertible_to<sentinel_t<Vs>, sentinel_t<base_t<C, Vs>>> &&
+                  ...),
+            int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return detail::zip_any_equal(current(x), y.end_,
+                                         std::index_sequence_for<Vs...>{});
+        }
+
+        friend constexpr bool operator==(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return !(y == x);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator<Const>& x,
+                                        const sentinel& y)
+            -> std::enable_if_t<(sized_sentinel_for<sentinel_t<base_t<C, Vs>>,
+                                                    iterator_t<base_t<C, Vs>>> &&
+                                 ...),
+                                iter_difference_t<iterator<Const>>>
+        {
+            return detail::zip_min_distance<iter_difference_t<iterator<Const>>>(
+                current(x), y.end_, std::index_sequence_for<Vs...>{});
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const sentinel& x,
+                                        const iterator<Const>& y)
+            -> std::enable_if_t<(sized_sentinel_for<sentinel_t<base_t<C, Vs>>,
+                                                    iterator_t<base_t<C, Vs>>> &&
+                                 ...),
+                                iter_difference_t<iterator<Const>>>
+        {
+            return -(y - x);
+        }
+    };
+
+    template <bool Const, typename Self>
+    static constexpr auto end_impl(Self& self)
+    {
+        if constexpr (!is_common<Const>) {
+            return sentinel<Const>(
+                detail::zip_transform_each(ranges::end, self.views_));
+        } else if constexpr (all_random_access<Const>) {
+            return self.begin() +
+                   static_cast<iter_difference_t<iterator<Const>>>(
+                       self.size());
+        } else {
+            return iterator<Const>(
+                detail::zip_transform_each(ranges::end, self.views_));
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto size_impl(Self& self)
+    {
+        return std::apply([](auto&... views) {
+            using size_type = std::make_unsigned_t<
+                common_type_t<decltype(ranges::size(views))...>>;
+            const size_type sizes[] = {
+                static_cast<size_type>(ranges::size(views))...};
+            size_type min = sizes[0];
+            for (const size_type s : sizes) {
+                min = s < min ? s : min;
+            }
+            return min;
+        }, self.views_);
+    }
+
+    std::tuple<Vs...> views_;
+
+public:
+    zip_view() = default;
+
+    constexpr explicit zip_view(Vs... views)
+        : views_(std::move(views)...)
+    {}
+
+    constexpr iterator<false> begin()
+    {
+        return iterator<false>(
+            detail::zip_transform_each(ranges::begin, views_));
+    }
+
+    template <bool C = true,
+              std::enable_if_t<C && (range<const Vs> && ...), int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return iterator<true>(
+            detail::zip_transform_each(ranges::begin, views_));
+    }
+
+    constexpr auto end()
+    {
+        return zip_view::end_impl<false>(*this);
+    }
+
+    template <bool C = true,
+              std::enable_if_t<C && (range<const Vs> && ...), int> = 0>
+    constexpr auto end() const
+    {
+        return zip_view::end_impl<true>(*this);
+    }
+
+    template <bool C = false,
+              std::enable_if_t<(sized_range<base_t<C, Vs>> && ...), int> = 0>
+    constexpr auto size()
+    {
+        return zip_view::size_impl(*this);
+    }
+
+    template <bool C = true,
+              std::enable_if_t<(sized_range<base_t<C, Vs>> && ...), int> = 0>
+    constexpr auto size() const
+    {
+        return zip_view::size_impl(*this);
+    }
+};
+
+template <typename... Rs>
+zip_view(Rs&&...) -> zip_view<all_view<Rs>...>;
+
+} // namespace zip_view_
+
+using zip_view_::zip_view;
+
+namespace detail {
+
+struct zip_view_fn {
+    constexpr auto operator()() const noexcept
+    {
+        return views::empty<std::tuple<>>;
+    }
+
+    template <typename... Es, std::enable_if_t<(sizeof...(Es) > 0), int> = 0>
+    constexpr auto operator()(Es&&... es) const
+        -> decltype(zip_view<all_view<Es>...>(
+            views::all(std::forward<Es>(es))...))
+    {
+        return zip_view<all_view<Es>...>(views::all(std::forward<Es>(es))...);
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::zip_view_fn, zip)
+
+}
+
+NANO_END_NAMESPACE
+
+namespace std {
+
+template <typename... Ts>
+class tuple_size<::nano::detail::zip_tuple<Ts...>>
+    : public integral_constant<size_t, sizeof...(Ts)> {
+};
+
+template <size_t I, typename... Ts>
+class tuple_element<I, ::nano::detail::zip_tuple<Ts...>> {
+public:
+    using type = tuple_element_t<I, tuple<Ts...>>;
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,392 @@
+// nanorange/views/zip_transform.hpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_VIEWS_ZIP_TRANSFORM_HPP_INCLUDED
+#define NANORANGE_VIEWS_ZIP_TRANSFORM_HPP_INCLUDED
+
+#include <nanorange/detail/views/semiregular_box.hpp>
+#include <nanorange/views/zip.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace zip_transform_view_ {
+
+template <typename F, typename... Vs>
+struct zip_transform_view : view_interface<zip_transform_view<F, Vs...>> {
+private:
+    static_assert(sizeof...(Vs) > 0);
+    static_assert((input_range<Vs> && ...));
+    static_assert((view<Vs> && ...));
+    static_assert(copy_constructible<F>);
+    static_assert(std::is_object_v<F>);
+    static_assert(regular_invocable<F&, range_reference_t<Vs>...>);
+
+    using inner_view = zip_view<Vs...>;
+
+    template <bool Const>
+    using inner_t = detail::conditional_t<Const, const inner_view, inner_view>;
+
+    template <bool> struct sentinel;
+
+    template <bool Const>
+    struct iterator {
+    private:
+        friend struct iterator<!Const>;
+        friend struct sentinel<Const>;
+
+        using Parent = detail::conditional_t<Const, const zip_transform_view,
+                                             zip_transform_view>;
+        using F_ref = detail::conditional_t<Const, const F&, F&>;
+        using inner_iterator = iterator_t<inner_t<Const>>;
+
+        Parent* parent_ = nullptr;
+        inner_iterator inner_ = inner_iterator();
+
+        // We call the function with the elements of the zip_tuple, rather
+        // than the tuple itself
+        template <typename Tuple>
+        constexpr decltype(auto) apply(Tuple&& t) const
+        {
+            return std::apply(
+                [this](auto&&... elems) -> decltype(auto) {
+                    return nano::invoke(*parent_->fun_,
+                                        std::forward<decltype(elems)>(elems)...);
+                },
+                std::forward<Tuple>(t));
+        }
+
+    public:
+        using iterator_category = iterator_category_t<inner_iterator>;
+        using value_type = remove_cvref_t<invoke_result_t<
+            F_ref, range_reference_t<detail::conditional_t<Const, const Vs, Vs>>...>>;
+        using difference_type = iter_difference_t<inner_iterator>;
+        // Extension: legacy typedefs
+        using pointer = void;
+        using reference = invoke_result_t<
+            F_ref, range_reference_t<detail::conditional_t<Const, const Vs, Vs>>...>;
+
+        iterator() = default;
+
+        constexpr iterator(Parent& parent, inner_iterator inner)
+            : parent_(std::addressof(parent)),
+              inner_(std::move(inner))
+        {}
+
+        template <typename I,
+            std::enable_if_t<same_as<I, iterator<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<
+            C && convertible_to<iterator_t<inner_view>, inner_iterator>,
+            int> = 0>
+        constexpr iterator(I i)
+            : parent_(i.parent_),
+              inner_(std::move(i.inner_))
+        {}
+
+        constexpr decltype(auto) operator*() const
+        {
+            return apply(*inner_);
+        }
+
+        constexpr iterator& operator++() { ++inner_; return *this; }
+
+        constexpr auto operator++(int)
+        {
+            if constexpr (forward_range<inner_t<Const>>) {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            } else {
+                ++inner_;
+            }
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--()
+            -> std::enable_if_t<bidirectional_range<inner_t<C>>, iterator&>
+        {
+            --inner_;
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator--(int)
+            -> std::enable_if_t<bidirectional_range<inner_t<C>>, iterator>
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator+=(difference_type n)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, iterator&>
+        {
+            inner_ += n;
+            return *this;
+        }
+
+        template <bool C = Const>
+        constexpr auto operator-=(difference_type n)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, iterator&>
+        {
+            inner_ -= n;
+            return *this;
+        }
+
+        template <bool C = Const,
+                  std::enable_if_t<random_access_range<inner_t<C>>, int> = 0>
+        constexpr decltype(auto) operator[](difference_type n) const
+        {
+            return apply(inner_[n]);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator==(const iterator& x, const iterator& y)
+            -> std::enable_if_t<equality_comparable<iterator_t<inner_t<C>>>,
+                                bool>
+        {
+            return x.inner_ == y.inner_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator!=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<equality_comparable<iterator_t<inner_t<C>>>,
+                                bool>
+        {
+            return !(x == y);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, bool>
+        {
+            return x.inner_ < y.inner_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, bool>
+        {
+            return y < x;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator<=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, bool>
+        {
+            return !(y < x);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator>=(const iterator& x, const iterator& y)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, bool>
+        {
+            return !(x < y);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator+(difference_type n, iterator i)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, iterator>
+        {
+            i += n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(iterator i, difference_type n)
+            -> std::enable_if_t<random_access_range<inner_t<C>>, iterator>
+        {
+            i -= n;
+            return i;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator& x, const iterator& y)
+            -> std::enable_if_t<sized_sentinel_for<iterator_t<inner_t<C>>,
+                                                   iterator_t<inner_t<C>>>,
+                                difference_type>
+        {
+            return x.inner_ - y.inner_;
+        }
+    };
+
+    template <bool Const>
+    struct sentinel {
+    private:
+        friend struct sentinel<!Const>;
+
+        using inner_sentinel = sentinel_t<inner_t<Const>>;
+
+        inner_sentinel end_ = inner_sentinel();
+
+        static constexpr const auto& inner(const iterator<Const>& i)
+        {
+            return i.inner_;
+        }
+
+    public:
+        sentinel() = default;
+
+        constexpr explicit sentinel(inner_sentinel end)
+            : end_(std::move(end))
+        {}
+
+        template <typename S,
+            std::enable_if_t<same_as<S, sentinel<!Const>>, int> = 0,
+            bool C = Const, std::enable_if_t<
+            C && convertible_to<sentinel_t<inner_view>, inner_sentinel>,
+            int> = 0>
+        constexpr sentinel(S s)
+            : end_(std::move(s.end_))
+        {}
+
+        friend constexpr bool operator==(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return inner(x) == y.end_;
+        }
+
+        friend constexpr bool operator==(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return y == x;
+        }
+
+        friend constexpr bool operator!=(const iterator<Const>& x,
+                                         const sentinel& y)
+        {
+            return !(x == y);
+        }
+
+        friend constexpr bool operator!=(const sentinel& x,
+                                         const iterator<Const>& y)
+        {
+            return !(y == x);
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const iterator<Const>& x,
+                                        const sentinel& y)
+            -> std::enable_if_t<sized_sentinel_for<sentinel_t<inner_t<C>>,
+                                                   iterator_t<inner_t<C>>>,
+                                range_difference_t<inner_t<C>>>
+        {
+            return inner(x) - y.end_;
+        }
+
+        template <bool C = Const>
+        friend constexpr auto operator-(const sentinel& x,
+                                        const iterator<Const>& y)
+            -> std::enable_if_t<sized_sentinel_for<sentinel_t<inner_t<C>>,
+                                                   iterator_t<inner_t<C>>>,
+                                range_difference_t<inner_t<C>>>
+        {
+            return x.end_ - inner(y);
+        }
+    };
+
+    inner_view zip_;
+    detail::semiregular_box<F> fun_;
+
+public:
+    zip_transform_view() = default;
+
+    constexpr explicit zip_transform_view(F fun, Vs... views)
+        : zip_(std::move(views)...),
+          fun_(std::move(fun))
+    {}
+
+    constexpr iterator<false> begin()
+    {
+        return iterator<false>{*this, zip_.begin()};
+    }
+
+    template <bool C = true, std::enable_if_t<
+        C && range<const inner_view> &&
+        regular_invocable<const F&, range_reference_t<const Vs>...>, int> = 0>
+    constexpr iterator<true> begin() const
+    {
+        return iterator<true>{*this, zip_.begin()};
+    }
+
+    constexpr auto end()
+    {
+        if constexpr (common_range<inner_view>) {
+            return iterator<false>{*this, zip_.end()};
+        } else {
+            return sentinel<false>{zip_.end()};
+        }
+    }
+
+    template <bool C = true, std::enable_if_t<
+        C && range<const inner_view> &&
+        regular_invocable<const F&, range_reference_t<const Vs>...>, int> = 0>
+    constexpr auto end() const
+    {
+        if constexpr (common_range<const inner_view>) {
+            return iterator<true>{*this, zip_.end()};
+        } else {
+            return sentinel<true>{zip_.end()};
+        }
+    }
+
+    template <bool C = false,
+              std::enable_if_t<sized_range<inner_t<C>>, int> = 0>
+    constexpr auto size() { return zip_.size(); }
+
+    template <bool C = true,
+              std::enable_if_t<sized_range<inner_t<C>>, int> = 0>
+    constexpr auto size() const { return zip_.size(); }
+};
+
+template <typename F, typename... Rs>
+zip_transform_view(F, Rs&&...) -> zip_transform_view<F, all_view<Rs>...>;
+
+} // namespace zip_transform_view_
+
+using zip_transform_view_::zip_transform_view;
+
+namespace detail {
+
+struct zip_transform_view_fn {
+    template <typename F, std::enable_if_t<
+        copy_constructible<std::decay_t<F>> &&
+        regular_invocable<std::decay_t<F>&>, int> = 0>
+    constexpr auto operator()(F&&) const
+    {
+        return views::empty<std::decay_t<invoke_result_t<std::decay_t<F>&>>>;
+    }
+
+    template <typename F, typename... Es,
+              std::enable_if_t<(sizeof...(Es) > 0), int> = 0>
+    constexpr auto operator()(F&& f, Es&&... es) const
+        -> decltype(zip_transform_view<std::decay_t<F>, all_view<Es>...>(
+            std::forward<F>(f), views::all(std::forward<Es>(es))...))
+    {
+        return zip_transform_view<std::decay_t<F>, all_view<Es>...>(
+            std::forward<F>(f), views::all(std::forward<Es>(es))...);
+    }
+};
+
+} // namespace detail
+
+namespace views {
+
+NANO_INLINE_VAR(nano::detail::zip_transform_view_fn, zip_transform)
+
+}
+
+NANO_END_NAMESPACE
+
+#endif
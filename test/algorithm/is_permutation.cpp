@@ -27,6 +27,12 @@
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace stl2 = nano;
 
 namespace {
@@ -856,3 +862,80 @@ TEST_CASE("alg.is_permutation")
 		CHECK(stl2::is_permutation(stl2::begin(a), stl2::end(a), stl2::begin(b)));
 	}
 }
+
+TEST_CASE("alg.is_permutation (large ranges)")
+{
+	std::mt19937 gen(1729);
+
+	std::vector<int> a(100000);
+	for (auto& x : a) {
+		x = static_cast<int>(gen() % 1000);
+	}
+	auto b = a;
+	std::shuffle(b.begin(), b.end(), gen);
+
+	SECTION("hashable values")
+	{
+		CHECK(stl2::is_permutation(a, b));
+		CHECK(stl2::is_permutation(a.begin(), a.end(), b.begin(), b.end()));
+		b[b.size() / 2] = 1000;
+		CHECK(!stl2::is_permutation(a, b));
+		std::swap(b[b.size() / 2], b.back());
+		b.back() = a.front();
+		CHECK(!stl2::is_permutation(a, b));
+	}
+
+	SECTION("projections")
+	{
+		std::vector<S> sa;
+		std::vector<T> tb;
+		for (int x : a) sa.push_back(S{x});
+		for (int x : b) tb.push_back(T{x});
+		CHECK(stl2::is_permutation(sa, tb, stl2::equal_to{}, &S::i, &T::i));
+		tb[0].i += 1000;
+		CHECK(!stl2::is_permutation(sa, tb, stl2::equal_to{}, &S::i, &T::i));
+	}
+
+	SECTION("strings")
+	{
+		std::vector<std::string> sa;
+		for (int x : a) sa.push_back(std::to_string(x));
+		auto sb = sa;
+		std::shuffle(sb.begin(), sb.end(), gen);
+		CHECK(stl2::is_permutation(sa, sb));
+		sb.back() += "!";
+		CHECK(!stl2::is_permutation(sa, sb));
+	}
+
+	SECTION("totally ordered values without std::hash")
+	{
+		std::vector<std::pair<int, int>> pa;
+		for (int x : a) pa.emplace_back(x % 7, x);
+		auto pb = pa;
+		std::shuffle(pb.begin(), pb.end(), gen);
+		CHECK(stl2::is_permutation(pa, pb));
+		pb.back().first += 7;
+		CHECK(!stl2::is_permutation(pa, pb));
+	}
+
+	SECTION("with a hasher")
+	{
+		// Equal if they have the same last digit
+		const auto same_digit = [](int x, int y) { return x % 10 == y % 10; };
+		const auto digit_hash = [](int x) { return std::size_t(x % 10); };
+
+		std::vector<int> c = b;
+		for (auto& x : c) {
+			x = x % 10 + 10 * static_cast<int>(gen() % 100);
+		}
+		CHECK(stl2::is_permutation(a, c, same_digit, stl2::identity{},
+		                           stl2::identity{}, digit_hash));
+		CHECK(stl2::is_permutation(a.begin(), a.end(), c.begin(), c.end(),
+		                           same_digit, stl2::identity{},
+		                           stl2::identity{}, digit_hash));
+		CHECK(!stl2::is_permutation(a, c));
+		c.back() = c.back() / 10 * 10 + (c.back() + 1) % 10;
+		CHECK(!stl2::is_permutation(a, c, same_digit, stl2::identity{},
+		                            stl2::identity{}, digit_hash));
+	}
+}
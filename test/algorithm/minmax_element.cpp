@@ -18,7 +18,15 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <nanorange/algorithm/max.hpp>
+#include <nanorange/algorithm/max_element.hpp>
+#include <nanorange/algorithm/min.hpp>
+#include <nanorange/algorithm/min_element.hpp>
+#include <nanorange/algorithm/minmax.hpp>
 #include <nanorange/algorithm/minmax_element.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <random>
@@ -189,6 +197,94 @@ struct S {
 	int i;
 };
 
+// The first least and last greatest elements, one at a time
+template <typename T>
+std::pair<const T*, const T*> reference_minmax(const std::vector<T>& v)
+{
+	const T* lo = v.data();
+	const T* hi = v.data();
+	for (const T& x : v) {
+		if (x < *lo) lo = &x;
+		if (!(x < *hi)) hi = &x;
+	}
+	return {lo, hi};
+}
+
+// Checks the vector kernels for contiguous ranges against
+// reference_minmax(), with few distinct values so that there are many ties
+template <typename T>
+void test_arithmetic()
+{
+	for (int size : {1, 2, 31, 32, 33, 127, 128, 129, 1000, 4096, 5000,
+	                 20000}) {
+		for (int distinct : {1, 3, 100}) {
+			std::vector<T> v(static_cast<std::size_t>(size));
+			for (auto& x : v) {
+				x = static_cast<T>(static_cast<int>(gen() % distinct) - 1);
+			}
+			// Put the extremes of T somewhere
+			if (size > 10 && distinct > 1) {
+				v[gen() % v.size()] = std::numeric_limits<T>::lowest();
+				v[gen() % v.size()] = std::numeric_limits<T>::max();
+			}
+
+			const auto expected = reference_minmax(v);
+			CHECK(&*stl2::min_element(v) == expected.first);
+			CHECK(&*stl2::max_element(v) == expected.second);
+			const auto both = stl2::minmax_element(v);
+			CHECK(&*both.min == expected.first);
+			CHECK(&*both.max == expected.second);
+
+			CHECK(stl2::min(v) == *expected.first);
+			CHECK(stl2::max(v) == *expected.second);
+			const auto values = stl2::minmax(v);
+			CHECK(values.min == *expected.first);
+			CHECK(values.max == *expected.second);
+		}
+	}
+}
+
+template <typename T>
+void test_floating_point()
+{
+	test_arithmetic<T>();
+
+	// Which of -0.0 and +0.0 we return depends on where they are
+	std::vector<T> v(1000, T(1));
+	v[100] = T(-0.0);
+	v[900] = T(0.0);
+	CHECK(stl2::min_element(v) == v.begin() + 100);
+	CHECK(std::signbit(stl2::min(v)));
+	CHECK(std::signbit(stl2::minmax(v).min));
+	std::fill(v.begin(), v.end(), T(-1));
+	v[100] = T(0.0);
+	v[900] = T(-0.0);
+	CHECK(stl2::max_element(v) == v.begin() + 900);
+	CHECK(!std::signbit(stl2::max(v)));
+	CHECK(std::signbit(stl2::minmax(v).max));
+
+	// With NaNs, the results are as the scalar algorithms give them
+	for (std::size_t pos : {0, 5, 500, 999}) {
+		std::vector<T> w(1000);
+		for (auto& x : w) {
+			x = static_cast<T>(gen() % 100);
+		}
+		w[pos] = std::numeric_limits<T>::quiet_NaN();
+		const auto expected = reference_minmax(w);
+		CHECK(&*stl2::min_element(w) == expected.first);
+		CHECK(&*stl2::max_element(w) == expected.second);
+
+		T lo = w[0];
+		T hi = w[0];
+		for (const T& x : w) {
+			if (x < lo) lo = x;
+			if (hi < x) hi = x;
+		}
+		CHECK((std::isnan(lo) ? std::isnan(stl2::min(w)) : stl2::min(w) == lo));
+		CHECK((std::isnan(hi) ? std::isnan(stl2::max(w)) : stl2::max(w) == hi));
+	}
+}
+
 }
 
 TEST_CASE("alg.minmax_element")
@@ -215,3 +311,17 @@ TEST_CASE("alg.minmax_element")
 	CHECK(ps.min->i == -4);
 	CHECK(ps.max->i == 40);
 }
+
+TEST_CASE("alg.minmax_element (arithmetic ranges)")
+{
+	test_arithmetic<signed char>();
+	test_arithmetic<unsigned char>();
+	test_arithmetic<short>();
+	test_arithmetic<unsigned short>();
+	test_arithmetic<int>();
+	test_arithmetic<unsigned>();
+	test_arithmetic<std::int64_t>();
+	test_arithmetic<std::uint64_t>();
+	test_floating_point<float>();
+	test_floating_point<double>();
+}
@@ -23,25 +23,29 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include <stl2/detail/algorithm/sample.hpp>
-
+#include <nanorange/algorithm/sample.hpp>
+#include <nanorange/algorithm/equal.hpp>
+#include <nanorange/algorithm/is_sorted.hpp>
+#include <nanorange/iterator/move_iterator.hpp>
+#include <algorithm>
 #include <array>
 #include <numeric>
-#include <stl2/detail/algorithm/equal.hpp>
-#include "../simple_test.hpp"
-#include "../test_utils.hpp"
+#include <random>
+#include "../catch.hpp"
 #include "../test_iterators.hpp"
+#include "../test_utils.hpp"
 
-namespace ranges = __stl2;
+namespace ranges = nano;
 
 namespace {
-	ranges::Sentinel{S, I}
-	bool in_sequence(I first, I mid, S last)
+	template <typename I, typename S>
+	bool in_sequence(I first, I last, S sfirst, S slast)
 	{
-		for (; first != mid; ++first)
-			STL2_ASSERT(first != last);
-		for (; first != last; ++first)
-			;
+		for (; first != last; ++first) {
+			if (std::find(sfirst, slast, *first) == slast) {
+				return false;
+			}
+		}
 		return true;
 	}
 
@@ -52,7 +56,7 @@ namespace {
 	};
 }
 
-int main()
+TEST_CASE("alg.sample")
 {
 	constexpr unsigned N = 100;
 	constexpr unsigned K = 10;
@@ -65,23 +69,22 @@ int main()
 		{
 			auto result = ranges::sample(random_access_iterator<int*>(i.data()),
 				sentinel<int*>(i.data()+N), a.begin(), K, g1);
-			CHECK(in_sequence(i.data(), result.in().base(), i.data() + N));
-			CHECK(result.out() == a.end());
+			CHECK(result == a.end());
 			CHECK(!ranges::equal(a, c));
+			CHECK(in_sequence(a.begin(), a.end(), i.begin(), i.end()));
+			CHECK(ranges::is_sorted(a));
 		}
 
 		{
 			auto result = ranges::sample(i.begin(), i.end(), b.begin(), K, g1);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
+			CHECK(result == b.end());
 			CHECK(!ranges::equal(a, b));
 			CHECK(!ranges::equal(b, c));
 		}
 
 		{
 			auto result = ranges::sample(i.begin(), i.end(), c.begin(), K, g2);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == c.end());
+			CHECK(result == c.end());
 			CHECK(ranges::equal(a, c));
 		}
 	}
@@ -91,26 +94,23 @@ int main()
 		std::iota(std::begin(i), std::end(i), 0);
 		std::array<int, K> a{}, b{}, c{};
 		std::minstd_rand g1, g2 = g1;
-		auto rng = ranges::ext::make_range(random_access_iterator<int*>(i.data()), sentinel<int*>(i.data() + N));
+		auto rng = ranges::subrange(random_access_iterator<int*>(i.data()), sentinel<int*>(i.data() + N));
 
 		{
 			auto result = ranges::sample(rng, a.begin(), K, g1);
-			CHECK(in_sequence(ranges::begin(rng), result.in(), ranges::end(rng)));
-			CHECK(result.out() == a.end());
+			CHECK(result == a.end());
 			CHECK(!ranges::equal(a, b));
 		}
 
 		{
 			auto result = ranges::sample(i, b.begin(), K, g2);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
+			CHECK(result == b.end());
 			CHECK(ranges::equal(a, b));
 		}
 
 		{
 			auto result = ranges::sample(i, b.begin(), K, g1);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
+			CHECK(result == b.end());
 			CHECK(!ranges::equal(a, b));
 			CHECK(!ranges::equal(b, c));
 		}
@@ -118,163 +118,102 @@ int main()
 		{
 			a.fill(0);
 			auto result = ranges::sample(std::move(rng), a.begin(), K, g1);
-			CHECK(in_sequence(ranges::begin(rng), result.in().get_unsafe(), ranges::end(rng)));
-			CHECK(result.out() == a.end());
+			CHECK(result == a.end());
 			CHECK(!ranges::equal(a, c));
 		}
 	}
 
-	{
-		std::array<int, N> i;
-		std::iota(std::begin(i), std::end(i), 0);
-		std::array<int, K> a{}, b{}, c{};
-
-		{
-			auto result = ranges::sample(random_access_iterator<int*>(i.data()),
-				sentinel<int*>(i.data() + N), a.begin(), K);
-			CHECK(in_sequence(i.data(), result.in().base(), i.data() + N));
-			CHECK(result.out() == a.end());
-			CHECK(!ranges::equal(a, b));
-		}
-
-		{
-			auto result = ranges::sample(i, b.begin(), K);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
-			CHECK(!ranges::equal(b, c));
-			CHECK(!ranges::equal(a, b));
-		}
-	}
-
 	{
 		std::array<MoveOnly, 10> source;
 		std::array<MoveOnly, 4> dest;
+		std::minstd_rand g;
 		auto result = ranges::sample(ranges::make_move_iterator(source.begin()),
 			ranges::make_move_sentinel(source.end()),
-			forward_iterator<MoveOnly*>(dest.data()), dest.size());
-		CHECK(in_sequence(ranges::make_move_iterator(source.begin()),
-			result.in(),
-			ranges::make_move_sentinel(source.end())));
-		CHECK(result.out() == forward_iterator<MoveOnly*>(dest.data() + dest.size()));
+			random_access_iterator<MoveOnly*>(dest.data()), dest.size(), g);
+		CHECK(result == random_access_iterator<MoveOnly*>(dest.data() + dest.size()));
 	}
 
 	{
-		std::array<int, N> i;
-		std::iota(std::begin(i), std::end(i), 0);
-		std::array<int, K> a{}, b{}, c{};
-		std::minstd_rand g1, g2 = g1;
-
+		int data[] = {0,1,2,3};
+		int sample[2];
+		std::minstd_rand g;
 		{
-			auto result = ranges::sample(random_access_iterator<int*>(i.data()),
-				sentinel<int*>(i.data()+N), a, g1);
-			CHECK(in_sequence(i.data(), result.in().base(), i.data() + N));
-			CHECK(result.out() == a.end());
-			CHECK(!ranges::equal(a, c));
+			auto result = ranges::sample(data, sample, 2, g);
+			CHECK(result == ranges::end(sample));
+			CHECK(in_sequence(sample, sample + 2, data, data + 4));
+			CHECK(sample[0] < sample[1]);
 		}
-
 		{
-			auto result = ranges::sample(i.begin(), i.end(), b, g1);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
-			CHECK(!ranges::equal(a, b));
-			CHECK(!ranges::equal(b, c));
-		}
-
-		{
-			auto result = ranges::sample(i.begin(), i.end(), c, g2);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == c.end());
-			CHECK(ranges::equal(a, c));
+			int all[4];
+			auto result = ranges::sample(data, all, 10, g);
+			CHECK(result == ranges::end(all));
+			CHECK(ranges::equal(all, data));
 		}
 	}
+}
 
-	{
-		std::array<int, N> i;
-		std::iota(std::begin(i), std::end(i), 0);
-		std::array<int, K> a{}, b{}, c{};
-		std::minstd_rand g1, g2 = g1;
-		auto rng = ranges::ext::make_range(random_access_iterator<int*>(i.data()), sentinel<int*>(i.data() + N));
-
-		{
-			auto result = ranges::sample(rng, a, g1);
-			CHECK(in_sequence(i.data(), result.in().base(), i.data() + N));
-			CHECK(result.out() == a.end());
-			CHECK(!ranges::equal(a, b));
-		}
-
-		{
-			auto result = ranges::sample(i, b, g2);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
-			CHECK(ranges::equal(a, b));
-		}
-
-		{
-			auto result = ranges::sample(i, b, g1);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
-			CHECK(!ranges::equal(a, b));
-			CHECK(!ranges::equal(b, c));
-		}
+TEST_CASE("alg.sample (input ranges)")
+{
+	// Without a forward range or a size, we need a reservoir
+	constexpr int N = 1000;
+	constexpr int K = 10;
+	std::array<int, N> i;
+	std::iota(std::begin(i), std::end(i), 0);
+	std::array<int, K> a{}, b{};
+	std::mt19937_64 g1, g2 = g1;
 
-		{
-			a.fill(0);
-			auto result = ranges::sample(std::move(rng), a, g1);
-			CHECK(in_sequence(i.data(), result.in().get_unsafe().base(), i.data() + N));
-			CHECK(result.out() == a.end());
-			CHECK(!ranges::equal(a, c));
-		}
+	{
+		auto rng = ranges::subrange(input_iterator<int*>(i.data()), sentinel<int*>(i.data() + N));
+		auto result = ranges::sample(rng, a.begin(), K, g1);
+		CHECK(result == a.end());
+		CHECK(in_sequence(a.begin(), a.end(), i.begin(), i.end()));
+		std::sort(a.begin(), a.end());
+		CHECK(std::adjacent_find(a.begin(), a.end()) == a.end());
 	}
 
 	{
-		std::array<int, N> i;
-		std::iota(std::begin(i), std::end(i), 0);
-		std::array<int, K> a{}, b{}, c{};
-
-		{
-			auto result = ranges::sample(random_access_iterator<int*>(i.data()),
-				sentinel<int*>(i.data() + N), a);
-			CHECK(in_sequence(i.data(), result.in().base(), i.data() + N));
-			CHECK(result.out() == a.end());
-			CHECK(!ranges::equal(a, b));
-		}
-
-		{
-			auto result = ranges::sample(i, b);
-			CHECK(in_sequence(i.begin(), result.in(), i.end()));
-			CHECK(result.out() == b.end());
-			CHECK(!ranges::equal(b, c));
-			CHECK(!ranges::equal(a, b));
-		}
+		auto result = ranges::sample(input_iterator<int*>(i.data()),
+			sentinel<int*>(i.data() + N), b.begin(), K, g2);
+		CHECK(result == b.end());
+		std::sort(b.begin(), b.end());
+		CHECK(ranges::equal(a, b));
 	}
 
 	{
-		std::array<MoveOnly, 10> source;
-		std::array<MoveOnly, 4> dest;
-		auto out = ranges::ext::make_range(
-			forward_iterator<MoveOnly*>(dest.data()),
-			sentinel<MoveOnly*, true>(dest.data() + dest.size()));
-		auto result = ranges::sample(ranges::make_move_iterator(source.begin()),
-			ranges::make_move_sentinel(source.end()), out);
-		CHECK(in_sequence(source.data(), result.in().base(), source.data() + source.size()));
-		CHECK(result.out() == ranges::end(out));
+		auto result = ranges::sample(input_iterator<int*>(i.data()),
+			sentinel<int*>(i.data() + 5), b.begin(), K, g2);
+		CHECK(result == b.begin() + 5);
+		CHECK(ranges::equal(b.begin(), b.begin() + 5, i.begin(), i.begin() + 5));
 	}
+}
 
-	{
-		int data[] = {0,1,2,3};
-		int sample[2];
-		std::minstd_rand g;
-		{
-			auto result = ranges::sample(data, sample, g);
-			CHECK(in_sequence(ranges::begin(data), result.in(), ranges::end(data)));
-			CHECK(result.out() == ranges::end(sample));
-		}
-		{
-			auto result = ranges::sample(data, sample);
-			CHECK(in_sequence(ranges::begin(data), result.in(), ranges::end(data)));
-			CHECK(result.out() == ranges::end(sample));
+TEST_CASE("alg.sample (uniformity)")
+{
+	// Each element should be equally likely to be chosen, however we sample
+	auto check_uniform = [](auto make_range) {
+		constexpr int N = 20;
+		constexpr int K = 5;
+		constexpr int trials = 8000;
+		std::array<int, N> i;
+		std::iota(std::begin(i), std::end(i), 0);
+		int counts[N] = {};
+		std::mt19937 g;
+		for (int t = 0; t < trials; ++t) {
+			std::array<int, K> out;
+			CHECK(ranges::sample(make_range(i), out.begin(), K, g) == out.end());
+			for (int x : out) {
+				++counts[x];
+			}
+		}
+		for (int c : counts) {
+			CHECK(c > trials * K / N - 200);
+			CHECK(c < trials * K / N + 200);
 		}
-	}
+	};
 
-	return ::test_result();
+	check_uniform([](auto& i) { return ranges::subrange(i.begin(), i.end()); });
+	check_uniform([](auto& i) {
+		return ranges::subrange(input_iterator<int*>(i.data()),
+			sentinel<int*>(i.data() + i.size()));
+	});
 }
@@ -24,6 +24,7 @@
 
 #include <nanorange/algorithm/shuffle.hpp>
 #include <nanorange/algorithm/equal.hpp>
+#include <algorithm>
 #include <numeric>
 #include <random>
 #include "../catch.hpp"
@@ -69,3 +70,28 @@ TEST_CASE("alg.shuffle")
 		CHECK(!stl2::equal(ia, orig));
 	}
 }
+
+TEST_CASE("alg.shuffle (word generators)")
+{
+	// Generators which give whole 32 or 64 bit words take the division-free
+	// path, which should still give each element an even chance of ending up
+	// in each position
+	auto check_uniform = [](auto g) {
+		constexpr int s = 8;
+		constexpr int trials = 16000;
+		int counts[s] = {};
+		for (int t = 0; t < trials; ++t) {
+			int ia[s];
+			std::iota(ia, ia + s, 0);
+			CHECK(stl2::shuffle(ia, g) == ia + s);
+			++counts[std::find(ia, ia + s, 0) - ia];
+		}
+		for (int c : counts) {
+			CHECK(c > trials / s - 250);
+			CHECK(c < trials / s + 250);
+		}
+	};
+
+	check_uniform(std::mt19937{});
+	check_uniform(std::mt19937_64{});
+}
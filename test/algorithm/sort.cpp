@@ -299,6 +299,52 @@ TEST_CASE("alg.sort")
 		}
 	}
 
+	// Check inputs made of long natural runs, which are merged rather than
+	// sorted from scratch
+	{
+		const int N = 5000;
+		std::vector<int> v(N);
+		const auto check_sorted = [&v] {
+			std::vector<int> expected = v;
+			std::sort(expected.begin(), expected.end());
+			CHECK(stl2::sort(v) == v.end());
+			CHECK(v == expected);
+		};
+
+		// Sorted, with a few random swaps
+		for (int swaps : {1, 5, 20}) {
+			for (int i = 0; i < N; ++i)
+				v[i] = i;
+			std::uniform_int_distribution<int> dist(0, N - 1);
+			for (int k = 0; k < swaps; ++k)
+				std::swap(v[dist(gen)], v[dist(gen)]);
+			check_sorted();
+		}
+
+		// Descending runs containing equal elements, with unsorted stretches
+		// between the runs
+		for (int i = 0; i < N; ++i)
+			v[i] = (i / 1000) * 1000 + (999 - i % 1000) / 3;
+		std::shuffle(v.begin() + 1500, v.begin() + 1600, gen);
+		std::shuffle(v.begin() + 4950, v.end(), gen);
+		check_sorted();
+
+		// A sorted log with a shuffled tail
+		for (int i = 0; i < N; ++i)
+			v[i] = i % 4000;
+		std::shuffle(v.begin() + 4400, v.end(), gen);
+		check_sorted();
+
+		// Move-only elements and projections
+		std::vector<std::unique_ptr<int>> p(N);
+		for (int i = 0; i < N; ++i)
+			p[i].reset(new int(i < N / 2 ? i : N + N / 2 - 1 - i));
+		std::swap(p[10], p[N - 10]);
+		stl2::sort(p, std::less<int>{}, [](const auto& q) { return *q; });
+		for (int i = 0; i < N; ++i)
+			CHECK(*p[i] == i);
+	}
+
 #if 0
 	// Check sorting a zip view, which uses iter_move
 	{
@@ -238,4 +238,26 @@ TEST_CASE("alg.stable_sort")
 			CHECK((std::size_t)v[i].j == v.size() - i - 1);
 		}
 	}
+
+	// Check stability on inputs made of natural runs, including descending
+	// runs of equal keys
+	{
+		const int N = 5000;
+		const auto sawtooth = [](int i) { return i % 300; };
+		const auto descending = [](int i) { return N - i / 7; };
+		const auto organ_pipe = [](int i) { return i < N / 2 ? i / 3 : (N - i) / 3; };
+		const auto check_pattern = [](auto key) {
+			std::vector<S> v(N);
+			for(int i = 0; i < N; ++i)
+				v[i] = S{key(i), i};
+			stl2::stable_sort(v, std::less<int>{}, &S::i);
+			CHECK(std::is_sorted(v.begin(), v.end(), [](const S& x, const S& y)
+			{
+				return x.i < y.i || (x.i == y.i && x.j < y.j);
+			}));
+		};
+		check_pattern(sawtooth);
+		check_pattern(descending);
+		check_pattern(organ_pipe);
+	}
 }
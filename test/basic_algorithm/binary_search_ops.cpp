@@ -3,6 +3,10 @@
 
 #include "../catch.hpp"
 
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <random>
 #include <vector>
 
 TEST_CASE("alg.basic.lower_bound")
@@ -65,4 +69,185 @@ TEST_CASE("alg.basic.binary_search")
         CHECK(nano::binary_search(vec, 3));
         CHECK_FALSE((nano::binary_search(vec, 42)));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("alg.basic.bounds_all_sizes")
+{
+    // Every size and every position, with and without duplicates
+    for (int n = 0; n < 70; n++) {
+        std::vector<int> vec(n);
+        for (int i = 0; i < n; i++) {
+            vec[i] = 2 * (i / 2);
+        }
+
+        for (int val = -1; val <= n + 1; val++) {
+            CHECK(nano::lower_bound(vec, val) ==
+                  std::lower_bound(vec.begin(), vec.end(), val));
+            CHECK(nano::upper_bound(vec, val) ==
+                  std::upper_bound(vec.begin(), vec.end(), val));
+            const auto rng = nano::equal_range(vec, val);
+            const auto expected = std::equal_range(vec.begin(), vec.end(), val);
+            CHECK(rng.begin() == expected.first);
+            CHECK(rng.end() == expected.second);
+        }
+    }
+}
+
+TEST_CASE("alg.basic.eytzinger_index")
+{
+    SECTION("empty") {
+        const nano::eytzinger_index<int> index(std::vector<int>{});
+        CHECK(index.empty());
+        CHECK(nano::lower_bound(index, 1) == index.data());
+        CHECK_FALSE(nano::binary_search(index, 1));
+    }
+
+    SECTION("agrees with searching the sorted range") {
+        for (int n = 1; n < 300; n++) {
+            std::vector<int> vec(n);
+            for (int i = 0; i < n; i++) {
+                vec[i] = 3 * (i / 2);
+            }
+            const nano::eytzinger_index<int> index(vec);
+            REQUIRE(index.size() == vec.size());
+            REQUIRE(std::is_permutation(index.data(), index.data() + n,
+                                        vec.begin()));
+
+            for (int val = -1; val <= 3 * n; val++) {
+                const auto expected = std::lower_bound(vec.begin(), vec.end(), val);
+                const int* const pos = nano::lower_bound(index, val);
+                if (expected == vec.end()) {
+                    CHECK(pos == index.data() + n);
+                } else {
+                    REQUIRE(pos != index.data() + n);
+                    CHECK(*pos == *expected);
+                }
+                CHECK(nano::binary_search(index, val) ==
+                      std::binary_search(vec.begin(), vec.end(), val));
+            }
+        }
+    }
+
+    SECTION("with comparator and projection") {
+        struct S {
+            int key;
+        };
+        std::vector<S> vec;
+        for (int i = 10; i > 0; i--) {
+            vec.push_back(S{i});
+        }
+        const nano::eytzinger_index<S> index(vec);
+
+        const S* const pos = nano::lower_bound(index, 4, nano::greater{}, &S::key);
+        REQUIRE(pos != index.data() + index.size());
+        CHECK(pos->key == 4);
+        CHECK(nano::binary_search(index, 7, nano::greater{}, &S::key));
+        CHECK_FALSE(nano::binary_search(index, 11, nano::greater{}, &S::key));
+    }
+}
+
+TEST_CASE("alg.basic.lower_bound_many")
+{
+    std::vector<int> vec(1000);
+    for (int i = 0; i < 1000; i++) {
+        vec[i] = 2 * (i / 3);
+    }
+
+    const auto check = [&](const std::vector<int>& keys) {
+        std::vector<std::vector<int>::iterator> out;
+        const auto res =
+            nano::lower_bound_many(vec, keys, nano::back_inserter(out));
+        CHECK(res.in == keys.end());
+        REQUIRE(out.size() == keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            CHECK(out[i] ==
+                  std::lower_bound(vec.begin(), vec.end(), keys[i]));
+        }
+    };
+
+    SECTION("empty") {
+        check({});
+        std::vector<int> none;
+        std::vector<std::vector<int>::iterator> out;
+        nano::lower_bound_many(none, std::vector<int>{1, 2, 3},
+                               nano::back_inserter(out));
+        CHECK(out == std::vector<std::vector<int>::iterator>(3, none.begin()));
+    }
+
+    SECTION("random keys") {
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> dist(-10, 700);
+        for (int n : {1, 15, 16, 17, 100, 333}) {
+            std::vector<int> keys(n);
+            for (int& k : keys) {
+                k = dist(gen);
+            }
+            check(keys);
+        }
+    }
+
+    SECTION("sorted keys") {
+        std::vector<int> keys;
+        for (int k = -3; k < 700; k += 3) {
+            keys.push_back(k);
+            keys.push_back(k);
+        }
+        check(keys);
+
+        // Too far apart to follow one by one
+        keys.clear();
+        for (int k = -3; k < 700; k += 50) {
+            keys.push_back(k);
+        }
+        check(keys);
+    }
+
+    SECTION("sorted keys which become unsorted and sorted again") {
+        std::vector<int> keys;
+        for (int k = 0; k < 300; k += 7) {
+            keys.push_back(k);
+        }
+        for (int k = 600; k > 0; k -= 11) {
+            keys.push_back(k);
+        }
+        for (int k = 0; k < 500; k++) {
+            keys.push_back(k);
+        }
+        check(keys);
+    }
+
+    SECTION("with comparator and projections") {
+        struct S {
+            int key;
+        };
+        std::vector<S> hay;
+        for (int i = 100; i > 0; i--) {
+            hay.push_back(S{i});
+        }
+        std::vector<S> keys{{50}, {101}, {0}, {50}, {73}, {1}};
+        std::vector<std::vector<S>::iterator> out;
+        nano::lower_bound_many(hay.begin(), hay.end(), keys.begin(), keys.end(),
+                               nano::back_inserter(out), nano::greater{},
+                               &S::key, &S::key);
+        REQUIRE(out.size() == keys.size());
+        CHECK(out[0] - hay.begin() == 50);
+        CHECK(out[1] == hay.begin());
+        CHECK(out[2] == hay.end());
+        CHECK(out[3] - hay.begin() == 50);
+        CHECK(out[4] - hay.begin() == 27);
+        CHECK(out[5] - hay.begin() == 99);
+    }
+
+    SECTION("with a forward haystack") {
+        const std::forward_list<int> list(vec.begin(), vec.end());
+        const std::vector<int> keys{5, -1, 2000, 6, 0};
+        std::vector<std::forward_list<int>::const_iterator> out;
+        nano::lower_bound_many(list, keys, nano::back_inserter(out));
+        REQUIRE(out.size() == keys.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            CHECK(std::distance(list.begin(), out[i]) ==
+                  std::lower_bound(vec.begin(), vec.end(), keys[i]) -
+                      vec.begin());
+        }
+    }
+}
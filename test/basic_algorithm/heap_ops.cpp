@@ -3,6 +3,8 @@
 
 #include "../catch.hpp"
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 namespace {
@@ -12,6 +14,58 @@ const auto greater = [](const auto& lhs, const auto& rhs) {
     return lhs > rhs;
 };
 
+template <std::size_t D>
+void test_heap_arity()
+{
+    constexpr auto arity = nano::heap_arity<D>;
+
+    std::mt19937 gen(D);
+    std::vector<int> vec(500);
+    for (auto& i : vec) {
+        i = static_cast<int>(gen() % 100);
+    }
+    std::vector<int> sorted = vec;
+    std::sort(sorted.begin(), sorted.end());
+
+    // make_heap, is_heap and sort_heap
+    {
+        auto v = vec;
+        CHECK(nano::make_heap(arity, v) == v.end());
+        CHECK(nano::is_heap(arity, v));
+        CHECK(nano::is_heap_until(arity, v.begin(), v.end()) == v.end());
+        CHECK(nano::sort_heap(arity, v.begin(), v.end()) == v.end());
+        CHECK(v == sorted);
+    }
+
+    // push_heap and pop_heap, with a comparator and projection
+    {
+        std::vector<int> v;
+        for (int i : vec) {
+            v.push_back(i);
+            nano::push_heap(arity, v, greater, [](int x) { return x + 1; });
+            REQUIRE(nano::is_heap(arity, v.begin(), v.end(), greater));
+        }
+
+        std::vector<int> popped;
+        while (!v.empty()) {
+            nano::pop_heap(arity, v.begin(), v.end(), greater);
+            popped.push_back(v.back());
+            v.pop_back();
+            REQUIRE(nano::is_heap(arity, v, greater));
+        }
+        CHECK(popped == sorted);
+    }
+
+    // is_heap_until finds the first child which is greater than its parent
+    {
+        std::vector<int> v(20, 1);
+        v[0] = 2;
+        v[2 * D + 1] = 3;
+        CHECK(nano::is_heap_until(arity, v) == v.begin() + (2 * D + 1));
+        CHECK_FALSE(nano::is_heap(arity, v));
+    }
+}
+
 }
 
 TEST_CASE("alg.basic.is_heap")
@@ -222,4 +276,17 @@ TEST_CASE("alg.basic.pop_heap (with comparator)")
     }
 
     REQUIRE(vec.back() == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("alg.basic.heap_arity")
+{
+    test_heap_arity<2>();
+    test_heap_arity<3>();
+    test_heap_arity<4>();
+    test_heap_arity<8>();
+
+    // A valid 4-ary heap need not be a binary heap
+    const std::vector<int> v{4, 1, 1, 1, 3};
+    CHECK(nano::is_heap(nano::heap_arity<4>, v));
+    CHECK_FALSE(nano::is_heap(v));
+}
@@ -5,6 +5,7 @@
 #include <nanorange/iterator/back_insert_iterator.hpp>
 #include <nanorange/iterator/ostream_iterator.hpp>
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <functional>
@@ -84,6 +85,68 @@ TEST_CASE("alg.basic.copy_backward")
     }
 }
 
+TEST_CASE("alg.basic.copy (trivially copyable)")
+{
+    struct pod {
+        int i;
+        double d;
+    };
+
+    std::vector<pod> src(100);
+    for (int i = 0; i < 100; i++) {
+        src[i] = pod{i, i * 2.0};
+    }
+
+    const auto same = [](const pod& a, const pod& b) {
+        return a.i == b.i && a.d == b.d;
+    };
+
+    SECTION("copy from vector to pointer")
+    {
+        pod dest[100] = {};
+        const auto res = rng::copy(src, dest);
+        REQUIRE(res.in == src.end());
+        REQUIRE(res.out == dest + 100);
+        REQUIRE(rng::equal(src, dest, same));
+    }
+
+    SECTION("copy_n with zero and negative counts")
+    {
+        int dest[3] = {1, 2, 3};
+        const int* in = dest;
+        auto res = rng::copy_n(in, 0, dest + 1);
+        REQUIRE(res.in == dest);
+        REQUIRE(res.out == dest + 1);
+        res = rng::copy_n(in, -2, dest + 1);
+        REQUIRE(res.in == dest);
+        REQUIRE(res.out == dest + 1);
+        REQUIRE(dest[1] == 2);
+    }
+
+    SECTION("overlapping copy_backward and move_backward")
+    {
+        std::vector<int> v{1, 2, 3, 4, 5, 0, 0};
+        auto res = rng::copy_backward(v.begin(), v.begin() + 5, v.end());
+        REQUIRE(res.in == v.begin() + 5);
+        REQUIRE(res.out == v.begin() + 2);
+        REQUIRE(v == (std::vector<int>{1, 2, 1, 2, 3, 4, 5}));
+
+        res = rng::move_backward(v.begin(), v.begin() + 2, v.begin() + 3);
+        REQUIRE(res.out == v.begin() + 1);
+        REQUIRE(v == (std::vector<int>{1, 1, 2, 2, 3, 4, 5}));
+    }
+
+    SECTION("overlapping move")
+    {
+        int arr[] = {1, 2, 3, 4, 5};
+        const auto res = rng::move(arr + 1, arr + 5, arr);
+        REQUIRE(res.in == arr + 5);
+        REQUIRE(res.out == arr + 4);
+        REQUIRE(arr[0] == 2);
+        REQUIRE(arr[3] == 5);
+    }
+}
+
 namespace {
 
 struct mark_move {
@@ -634,3 +697,96 @@ TEST_CASE("alg.basic.unique_copy (with predicate)")
         REQUIRE(dest.str() == "1 2 3 4 5 ");
     }
 }
+
+namespace {
+
+// Checks remove, unique and copy_if on contiguous ranges, which use the
+// branchless and vector kernels, against the std:: versions, for sizes
+// around the vector widths and for various proportions of repeated elements
+template <typename T>
+void check_compaction()
+{
+    std::mt19937 gen(42);
+    const auto positive = [](T x) { return x > 0; };
+    const auto same_sign = [](T a, T b) { return (a > 0) == (b > 0); };
+
+    for (int size : {0, 1, 2, 7, 8, 15, 16, 17, 31, 33, 63, 64, 65, 100, 1000,
+                     3000}) {
+        for (double repeats : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+            std::bernoulli_distribution repeat(repeats);
+            std::vector<T> src(static_cast<std::size_t>(size));
+            for (std::size_t i = 0; i < src.size(); ++i) {
+                src[i] = i > 0 && repeat(gen) ? src[i - 1]
+                                               : static_cast<T>(gen() % 3);
+            }
+
+            auto expected = src;
+            auto got = src;
+            auto exp_end = std::remove(expected.begin(), expected.end(), T(0));
+            auto got_end = rng::remove(got, T(0));
+            REQUIRE(got_end - got.begin() == exp_end - expected.begin());
+            REQUIRE(std::equal(got.begin(), got_end, expected.begin()));
+
+            expected = src;
+            got = src;
+            exp_end = std::remove_if(expected.begin(), expected.end(), positive);
+            got_end = rng::remove_if(got, positive);
+            REQUIRE(got_end - got.begin() == exp_end - expected.begin());
+            REQUIRE(std::equal(got.begin(), got_end, expected.begin()));
+
+            expected = src;
+            got = src;
+            exp_end = std::unique(expected.begin(), expected.end());
+            got_end = rng::unique(got);
+            REQUIRE(got_end - got.begin() == exp_end - expected.begin());
+            REQUIRE(std::equal(got.begin(), got_end, expected.begin()));
+
+            expected = src;
+            got = src;
+            exp_end = std::unique(expected.begin(), expected.end(), same_sign);
+            got_end = rng::unique(got, rng::equal_to{}, positive);
+            REQUIRE(got_end - got.begin() == exp_end - expected.begin());
+            REQUIRE(std::equal(got.begin(), got_end, expected.begin()));
+
+            // The copies must not write past the elements they keep
+            expected.assign(src.size(), T(7));
+            got.assign(src.size(), T(7));
+            exp_end = std::copy_if(src.begin(), src.end(), expected.begin(),
+                                   positive);
+            auto res = rng::copy_if(src, got.begin(), positive);
+            REQUIRE(res.in == src.end());
+            REQUIRE(res.out - got.begin() == exp_end - expected.begin());
+            REQUIRE(got == expected);
+
+            expected.assign(src.size(), T(7));
+            got.assign(src.size(), T(7));
+            exp_end = std::remove_copy(src.begin(), src.end(), expected.begin(),
+                                       T(1));
+            res = rng::remove_copy(src, got.begin(), T(1));
+            REQUIRE(res.in == src.end());
+            REQUIRE(res.out - got.begin() == exp_end - expected.begin());
+            REQUIRE(got == expected);
+
+            expected.assign(src.size(), T(7));
+            got.assign(src.size(), T(7));
+            exp_end = std::remove_copy_if(src.begin(), src.end(),
+                                          expected.begin(), positive);
+            res = rng::remove_copy_if(src, got.begin(), positive);
+            REQUIRE(res.in == src.end());
+            REQUIRE(res.out - got.begin() == exp_end - expected.begin());
+            REQUIRE(got == expected);
+        }
+    }
+}
+
+}
+
+TEST_CASE("alg.basic.remove and unique (contiguous ranges)")
+{
+    check_compaction<signed char>();
+    check_compaction<short>();
+    check_compaction<int>();
+    check_compaction<unsigned>();
+    check_compaction<long long>();
+    check_compaction<double>();
+}
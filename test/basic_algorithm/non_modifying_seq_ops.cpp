@@ -4,6 +4,9 @@
 #include <nanorange/algorithm.hpp>
 
 #include <array>
+#include <cstdint>
+#include <list>
+#include <string>
 #include <vector>
 
 namespace rng = nano::ranges;
@@ -75,6 +78,30 @@ TEST_CASE("alg.basic.count")
     REQUIRE(n == 3);
 }
 
+TEST_CASE("alg.basic.count (contiguous integers)")
+{
+    SECTION("bytes") {
+        std::string str(1000, 'a');
+        str[0] = str[499] = str[999] = 'b';
+        REQUIRE(rng::count(str, 'b') == 3);
+        REQUIRE(rng::count(str.data(), str.data() + 998, 'b') == 2);
+    }
+
+    SECTION("64-bit values") {
+        std::vector<std::int64_t> vec(77, -1);
+        vec[3] = vec[64] = 1;
+        REQUIRE(rng::count(vec, -1) == 75);
+        REQUIRE(rng::count(vec, 1) == 2);
+    }
+
+    SECTION("values which don't fit in the element type") {
+        const std::vector<unsigned char> vec(100, 0xff);
+        REQUIRE(rng::count(vec, 0xff) == 100);
+        REQUIRE(rng::count(vec, -1) == 0);
+        REQUIRE(rng::count(vec, 0x1ff) == 0);
+    }
+}
+
 TEST_CASE("alg.basic.count_if")
 {
     constexpr std::array<int, 3> arr = {{2, 2, 2}};
@@ -140,6 +167,43 @@ TEST_CASE("alg.basic.mismatch (four-legged with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.mismatch (contiguous integers)")
+{
+    SECTION("bytes") {
+        const std::string str1(100, 'a');
+        for (std::size_t i = 0; i < str1.size(); i++) {
+            std::string str2 = str1;
+            str2[i] = 'b';
+            const auto p = rng::mismatch(str1, str2);
+            REQUIRE(p.in1 == str1.begin() + i);
+            REQUIRE(p.in2 == str2.begin() + i);
+        }
+    }
+
+    SECTION("64-bit values") {
+        const std::vector<std::int64_t> vec1(50, -1);
+        for (std::size_t i = 0; i < vec1.size(); i++) {
+            std::vector<std::int64_t> vec2 = vec1;
+            // Differ in the top byte only
+            vec2[i] = 0x00ffffffffffffff;
+            const auto p = rng::mismatch(vec1, vec2, std::equal_to<>{});
+            REQUIRE(p.in1 == vec1.begin() + i);
+        }
+    }
+
+    SECTION("ranges of different lengths") {
+        const std::vector<int> vec1(40, 1);
+        const std::vector<int> vec2(33, 1);
+        auto p = rng::mismatch(vec1, vec2);
+        REQUIRE(p.in1 == vec1.begin() + 33);
+        REQUIRE(p.in2 == vec2.end());
+
+        p = rng::mismatch(vec1.begin(), vec1.begin() + 10, vec2.begin());
+        REQUIRE(p.in1 == vec1.begin() + 10);
+        REQUIRE(p.in2 == vec2.begin() + 10);
+    }
+}
+
 TEST_CASE("alg.basic.equal (three-legged)")
 {
     constexpr std::array<int, 3> arr = {{1, 2, 3}};
@@ -193,6 +257,57 @@ TEST_CASE("alg.basic.equal (four-legged with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.equal (contiguous integers)")
+{
+    const std::vector<unsigned short> vec1(100, 7);
+    std::vector<unsigned short> vec2 = vec1;
+    REQUIRE(rng::equal(vec1, vec2));
+    REQUIRE(rng::equal(vec1.begin(), vec1.end(), vec2.begin()));
+
+    vec2.back() = 8;
+    REQUIRE_FALSE(rng::equal(vec1, vec2));
+    REQUIRE(rng::equal(vec1.begin(), vec1.end() - 1, vec2.begin()));
+
+    vec2.pop_back();
+    REQUIRE_FALSE(rng::equal(vec1, vec2));
+    REQUIRE(rng::equal(vec2, std::vector<unsigned short>(99, 7)));
+}
+
+TEST_CASE("alg.basic.lexicographical_compare (contiguous integers)")
+{
+    SECTION("unsigned bytes") {
+        const std::vector<unsigned char> vec1 = {1, 2, 3, 0xff};
+        const std::vector<unsigned char> vec2 = {1, 2, 3, 4, 5};
+        REQUIRE(rng::lexicographical_compare(vec2, vec1));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec1, vec2));
+        REQUIRE(rng::lexicographical_compare(vec1.begin(), vec1.end() - 1,
+                                             vec2.begin(), vec2.end()));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec1, vec1));
+    }
+
+    SECTION("signed bytes") {
+        const std::vector<signed char> vec1 = {1, 2, 3, -1};
+        const std::vector<signed char> vec2 = {1, 2, 3, 4, 5};
+        REQUIRE(rng::lexicographical_compare(vec1, vec2));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec2, vec1));
+    }
+
+    SECTION("ints") {
+        std::vector<int> vec1(70, 5);
+        std::vector<int> vec2 = vec1;
+        vec1[65] = -256;
+        REQUIRE(rng::lexicographical_compare(vec1, vec2, std::less<>{}));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec2, vec1));
+
+        vec1[65] = 5;
+        vec1.pop_back();
+        REQUIRE(rng::lexicographical_compare(vec1, vec2));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec2, vec1));
+        REQUIRE(rng::lexicographical_compare(std::vector<int>{}, vec1));
+        REQUIRE_FALSE(rng::lexicographical_compare(vec1, std::vector<int>{}));
+    }
+}
+
 TEST_CASE("alg.basic.find")
 {
     constexpr std::array<int, 3> arr = {{1, 2, 3}};
@@ -214,6 +329,34 @@ TEST_CASE("alg.basic.find")
     }
 }
 
+TEST_CASE("alg.basic.find (contiguous integers)")
+{
+    SECTION("bytes") {
+        std::string str(300, 'a');
+        str[257] = 'z';
+        REQUIRE(rng::find(str, 'z') == str.begin() + 257);
+        REQUIRE(rng::find(str.begin(), str.begin() + 257, 'z') ==
+                str.begin() + 257);
+        REQUIRE(rng::find(str, 'q') == str.end());
+    }
+
+    SECTION("every position") {
+        std::vector<std::uint16_t> vec(100);
+        for (std::size_t i = 0; i < vec.size(); i++) {
+            vec[i] = 7;
+            REQUIRE(rng::find(vec, 7) == vec.begin() + i);
+            vec[i] = 0;
+        }
+        REQUIRE(rng::find(vec, 7) == vec.end());
+    }
+
+    SECTION("mixed signedness") {
+        const std::vector<int> vec{1, 2, -1, 3};
+        REQUIRE(rng::find(vec, -1) == vec.begin() + 2);
+        REQUIRE(rng::find(vec, -1L) == vec.begin() + 2);
+        REQUIRE(rng::find(vec, 0xFFFFFFFFLL) == vec.end());
+    }
+}
 
 TEST_CASE("alg.basic.find_if")
 {
@@ -378,6 +521,102 @@ TEST_CASE("alg.basic.search (with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.search (contiguous integers)")
+{
+    // Needle lengths chosen to exercise each of the substring search
+    // strategies
+    for (std::size_t len : {1, 2, 7, 32, 33, 100}) {
+        std::string hay(1000, 'a');
+        std::string needle(len, 'a');
+        needle.back() = 'b';
+        hay.replace(hay.size() - len, len, needle);
+        hay.replace(500, len, needle);
+
+        auto sub = rng::search(hay, needle);
+        REQUIRE(sub.begin() == hay.begin() + 500);
+        REQUIRE(sub.end() == hay.begin() + 500 + len);
+
+        sub = rng::find_end(hay, needle);
+        REQUIRE(sub.begin() == hay.end() - len);
+        REQUIRE(sub.end() == hay.end());
+
+        const std::vector<int> ihay(hay.begin(), hay.end());
+        const std::vector<int> ineedle(needle.begin(), needle.end());
+        REQUIRE(rng::search(ihay, ineedle).begin() == ihay.begin() + 500);
+        REQUIRE(rng::find_end(ihay, ineedle).begin() == ihay.end() - len);
+
+        needle.back() = 'c';
+        REQUIRE(rng::search(hay, needle).empty());
+        REQUIRE(rng::search(hay, needle).begin() == hay.end());
+    }
+
+    SECTION("periodic needles") {
+        const std::vector<short> needle = [] {
+            std::vector<short> v;
+            for (int i = 0; i < 40; i++) {
+                v.push_back(static_cast<short>(i % 3));
+            }
+            return v;
+        }();
+        std::vector<short> hay = needle;
+        hay[38] = 5;
+        hay.insert(hay.end(), needle.begin(), needle.end());
+        hay.insert(hay.end(), needle.begin(), needle.begin() + 39);
+
+        const auto sub = rng::search(hay, needle);
+        REQUIRE(sub.begin() == hay.begin() + 40);
+        REQUIRE(rng::find_end(hay, needle).begin() == hay.begin() + 40);
+    }
+
+    SECTION("needle longer than haystack") {
+        const std::string hay = "abc";
+        const std::string needle = "abcd";
+        REQUIRE(rng::search(hay, needle).begin() == hay.end());
+        REQUIRE(rng::find_end(hay, needle).begin() == hay.end());
+    }
+}
+
+TEST_CASE("alg.basic.searcher")
+{
+    const std::string needle = "needle";
+    const nano::searcher s(needle);
+
+    const std::vector<std::string> hays = {"haystack", "a needle", "needleneedle",
+                                           "need", ""};
+    for (const auto& hay : hays) {
+        const auto sub = s(hay);
+        const auto expected = std::search(hay.begin(), hay.end(),
+                                          needle.begin(), needle.end());
+        REQUIRE(sub.begin() == expected);
+        if (expected != hay.end()) {
+            REQUIRE(sub.end() == expected + 6);
+        }
+    }
+
+    SECTION("with a non-contiguous haystack") {
+        const std::list<char> hay(hays[1].begin(), hays[1].end());
+        const auto sub = s(hay);
+        REQUIRE(sub.begin() == std::next(hay.begin(), 2));
+        REQUIRE(sub.end() == hay.end());
+    }
+
+    SECTION("with a predicate") {
+        const std::vector<int> vec{1, 2, 3, 4, 5};
+        const nano::searcher s2(vec.begin() + 2, vec.begin() + 4,
+                                [](int i, int j) { return i == j - 1; });
+        const auto sub = s2(vec);
+        REQUIRE(sub.begin() == vec.begin() + 1);
+        REQUIRE(sub.end() == vec.begin() + 3);
+    }
+
+    SECTION("with an empty needle") {
+        const std::string empty;
+        const nano::searcher s2(empty);
+        REQUIRE(s2(hays[0]).begin() == hays[0].begin());
+        REQUIRE(s2(hays[0]).empty());
+    }
+}
+
 TEST_CASE("alg.basic.search_n")
 {
     const std::vector<int> vec{1, 2, 3, 4, 1, 1, 1};
@@ -409,6 +648,33 @@ TEST_CASE("alg.basic.search_n (with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.search_n (random access)")
+{
+    std::vector<int> vec(100, 0);
+    for (int i : {3, 4, 5, 10, 11, 12, 13, 50, 51, 52, 53, 54}) {
+        vec[i] = 1;
+    }
+
+    auto sub = rng::search_n(vec, 4, 1);
+    REQUIRE(sub.begin() == vec.begin() + 10);
+    REQUIRE(sub.end() == vec.begin() + 14);
+
+    sub = rng::search_n(vec, 5, 1);
+    REQUIRE(sub.begin() == vec.begin() + 50);
+
+    sub = rng::search_n(vec, 6, 1);
+    REQUIRE(sub.begin() == vec.end());
+    REQUIRE(sub.empty());
+
+    sub = rng::search_n(vec, 45, 0);
+    REQUIRE(sub.begin() == vec.begin() + 55);
+    REQUIRE(sub.end() == vec.end());
+
+    sub = rng::search_n(vec, 0, 1);
+    REQUIRE(sub.begin() == vec.begin());
+    REQUIRE(sub.empty());
+}
+
 TEST_CASE("alg.basic.is_permutation (with predicate)")
 {
     struct foo { foo(int i):i(i){} int i; };
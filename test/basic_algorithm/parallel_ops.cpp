@@ -0,0 +1,332 @@
+// nanorange/test/basic_algorithm/parallel_ops.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "../catch.hpp"
+
+#include <nanorange/algorithm.hpp>
+#include <nanorange/execution.hpp>
+#include <nanorange/numeric.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace rng = nano;
+
+namespace {
+
+// Large enough to be split into several pieces
+constexpr int big = 100'000;
+
+std::vector<int> make_data()
+{
+    std::vector<int> vec(big);
+    for (int i = 0; i < big; i++) {
+        vec[i] = (i * 7919) % 1000;
+    }
+    return vec;
+}
+
+}
+
+TEST_CASE("alg.parallel.policies")
+{
+    static_assert(rng::is_execution_policy_v<rng::execution::sequenced_policy>, "");
+    static_assert(rng::is_execution_policy_v<rng::execution::parallel_policy>, "");
+    static_assert(rng::is_execution_policy_v<
+                  rng::execution::parallel_unsequenced_policy>, "");
+    static_assert(!rng::is_execution_policy_v<int>, "");
+}
+
+TEST_CASE("alg.parallel.for_each")
+{
+    std::vector<int> vec = make_data();
+    const std::vector<int> orig = vec;
+
+    SECTION("with iterators") {
+        const auto it = rng::for_each(rng::execution::par, vec.begin(),
+                                      vec.end(), [](int& i) { i *= 2; });
+        REQUIRE(it == vec.end());
+        for (int i = 0; i < big; i++) {
+            REQUIRE(vec[i] == 2 * orig[i]);
+        }
+    }
+
+    SECTION("with a range and projection") {
+        std::atomic<long> sum{0};
+        rng::for_each(rng::execution::par_unseq, vec,
+                      [&sum](int i) { sum += i; }, std::negate<>{});
+        REQUIRE(sum == -std::accumulate(orig.begin(), orig.end(), 0L));
+    }
+
+    SECTION("with a list") {
+        std::list<int> list(orig.begin(), orig.end());
+        rng::for_each(rng::execution::par, list, [](int& i) { i = 0; });
+        REQUIRE(std::all_of(list.begin(), list.end(),
+                            [](int i) { return i == 0; }));
+    }
+}
+
+TEST_CASE("alg.parallel.transform")
+{
+    const std::vector<int> vec = make_data();
+
+    SECTION("unary") {
+        std::vector<long> out(big);
+        const auto res = rng::transform(rng::execution::par, vec, out.begin(),
+                                        [](int i) { return i + 1L; });
+        REQUIRE(res.in == vec.end());
+        REQUIRE(res.out == out.end());
+        for (int i = 0; i < big; i++) {
+            REQUIRE(out[i] == vec[i] + 1);
+        }
+    }
+
+    SECTION("binary, with ranges of different lengths") {
+        const std::vector<int> half(vec.begin(), vec.begin() + big / 2);
+        std::vector<int> out(big);
+        const auto res = rng::transform(rng::execution::par, vec.begin(),
+                                        vec.end(), half.begin(), half.end(),
+                                        out.begin(), std::plus<>{});
+        REQUIRE(res.in1 == vec.begin() + big / 2);
+        REQUIRE(res.in2 == half.end());
+        REQUIRE(res.out == out.begin() + big / 2);
+        for (int i = 0; i < big / 2; i++) {
+            REQUIRE(out[i] == 2 * vec[i]);
+        }
+    }
+}
+
+TEST_CASE("alg.parallel.fill_copy")
+{
+    std::vector<std::string> vec(big);
+    REQUIRE(rng::fill(rng::execution::par, vec, "abc") == vec.end());
+    REQUIRE(std::count(vec.begin(), vec.end(), "abc") == big);
+
+    std::vector<std::string> out(big);
+    const auto res = rng::copy(rng::execution::par, vec, out.begin());
+    REQUIRE(res.in == vec.end());
+    REQUIRE(res.out == out.end());
+    REQUIRE(out == vec);
+}
+
+TEST_CASE("alg.parallel.count")
+{
+    const std::vector<int> vec = make_data();
+    const auto is_odd = [](int i) { return i % 2 != 0; };
+
+    REQUIRE(rng::count_if(rng::execution::par, vec, is_odd) ==
+            std::count_if(vec.begin(), vec.end(), is_odd));
+    REQUIRE(rng::count(rng::execution::par, vec.begin(), vec.end(), 42) ==
+            std::count(vec.begin(), vec.end(), 42));
+}
+
+TEST_CASE("alg.parallel.find")
+{
+    std::vector<int> vec(big, 0);
+    vec[big - 10] = 1;
+    vec[3 * big / 4] = 1;
+    const auto is_one = [](int i) { return i == 1; };
+    const auto is_zero = [](int i) { return i == 0; };
+
+    REQUIRE(rng::find(rng::execution::par, vec, 1) == vec.begin() + 3 * big / 4);
+    REQUIRE(rng::find(rng::execution::par, vec, 2) == vec.end());
+    REQUIRE(rng::find_if(rng::execution::par, vec.begin(), vec.end(), is_one) ==
+            vec.begin() + 3 * big / 4);
+    REQUIRE(rng::find_if_not(rng::execution::par, vec, is_zero) ==
+            vec.begin() + 3 * big / 4);
+
+    REQUIRE(rng::any_of(rng::execution::par, vec, is_one));
+    REQUIRE_FALSE(rng::all_of(rng::execution::par, vec, is_zero));
+    REQUIRE_FALSE(rng::none_of(rng::execution::par, vec, is_one));
+
+    const std::vector<int> zeros(big, 0);
+    REQUIRE(rng::all_of(rng::execution::par, zeros, is_zero));
+    REQUIRE(rng::none_of(rng::execution::par, zeros.begin(), zeros.end(),
+                         is_one));
+}
+
+TEST_CASE("alg.parallel.min_max_element")
+{
+    const std::vector<int> vec = make_data();
+
+    REQUIRE(rng::min_element(rng::execution::par, vec) == rng::min_element(vec));
+    REQUIRE(rng::max_element(rng::execution::par, vec.begin(), vec.end()) ==
+            rng::max_element(vec));
+    REQUIRE(rng::min_element(rng::execution::par, vec, rng::greater{}) ==
+            rng::min_element(vec, rng::greater{}));
+}
+
+TEST_CASE("alg.parallel.reduce")
+{
+    const std::vector<int> vec = make_data();
+    const long sum = std::accumulate(vec.begin(), vec.end(), 0L);
+
+    REQUIRE(rng::reduce(rng::execution::par, vec) ==
+            std::accumulate(vec.begin(), vec.end(), 0));
+    REQUIRE(rng::reduce(rng::execution::par, vec.begin(), vec.end(), 1L) ==
+            sum + 1);
+    REQUIRE(rng::reduce(rng::execution::par, vec, 0L, std::plus<>{},
+                        std::negate<>{}) == -sum);
+
+    const std::list<int> list(vec.begin(), vec.end());
+    REQUIRE(rng::reduce(rng::execution::par, list, 0L) == sum);
+
+    const std::vector<int> empty;
+    REQUIRE(rng::reduce(rng::execution::par, empty, 42) == 42);
+}
+
+TEST_CASE("alg.parallel.transform_reduce")
+{
+    const std::vector<int> vec = make_data();
+    const std::vector<long> half(vec.begin(), vec.begin() + big / 2);
+
+    REQUIRE(rng::transform_reduce(rng::execution::par, vec, 0L, std::plus<>{},
+                                  [](int i) { return long(i) * i; }) ==
+            std::inner_product(vec.begin(), vec.end(), vec.begin(), 0L));
+    REQUIRE(rng::transform_reduce(rng::execution::par, vec, half, 0L) ==
+            std::inner_product(half.begin(), half.end(), vec.begin(), 0L));
+    REQUIRE(rng::transform_reduce(rng::execution::par, half.begin(),
+                                  half.end(), vec.begin(), vec.end(), 0L,
+                                  std::plus<>{}, std::minus<>{}) == 0);
+}
+
+TEST_CASE("alg.parallel.scan")
+{
+    const std::vector<int> vec = make_data();
+    std::vector<long> expected(big);
+    std::vector<long> out(big);
+
+    SECTION("inclusive_scan") {
+        std::partial_sum(vec.begin(), vec.end(), expected.begin(),
+                         std::plus<long>{});
+        const auto res = rng::inclusive_scan(rng::execution::par, vec,
+                                             out.begin());
+        REQUIRE(res.in == vec.end());
+        REQUIRE(res.out == out.end());
+        REQUIRE(out == expected);
+
+        rng::inclusive_scan(rng::execution::par, vec.begin(), vec.end(),
+                            out.begin(), std::plus<>{}, 100L);
+        for (int i = 0; i < big; i++) {
+            REQUIRE(out[i] == expected[i] + 100);
+        }
+    }
+
+    SECTION("exclusive_scan") {
+        long sum = 0;
+        for (int i = 0; i < big; i++) {
+            expected[i] = sum;
+            sum -= vec[i];
+        }
+        const auto res = rng::exclusive_scan(rng::execution::par, vec.begin(),
+                                             vec.end(), out.begin(), 0L,
+                                             std::plus<>{}, std::negate<>{});
+        REQUIRE(res.in == vec.end());
+        REQUIRE(res.out == out.end());
+        REQUIRE(out == expected);
+    }
+
+    SECTION("in place") {
+        std::vector<long> data(vec.begin(), vec.end());
+        std::partial_sum(data.begin(), data.end(), expected.begin());
+        rng::inclusive_scan(rng::execution::par, data, data.begin());
+        REQUIRE(data == expected);
+    }
+
+    SECTION("with a non-commutative operation") {
+        // Composition of the maps x -> a * x + b, modulo a prime
+        using affine = std::pair<long, long>;
+        const auto compose = [](const affine& f, const affine& g) {
+            constexpr long p = 1000003;
+            return affine{f.first * g.first % p,
+                          (f.second * g.first + g.second) % p};
+        };
+        const auto to_affine = [](int i) { return affine{i % 7 + 1, i}; };
+
+        std::vector<affine> seq(big);
+        std::vector<affine> par(big);
+        rng::inclusive_scan(vec, seq.begin(), compose, to_affine);
+        rng::inclusive_scan(rng::execution::par, vec, par.begin(), compose,
+                            to_affine);
+        REQUIRE(par == seq);
+
+        rng::exclusive_scan(vec, seq.begin(), affine{1, 0}, compose,
+                            to_affine);
+        rng::exclusive_scan(rng::execution::par, vec, par.begin(),
+                            affine{1, 0}, compose, to_affine);
+        REQUIRE(par == seq);
+    }
+}
+
+TEST_CASE("alg.parallel.sort")
+{
+    const std::vector<int> data = make_data();
+
+    SECTION("sort") {
+        std::vector<std::string> vec(big);
+        std::transform(data.begin(), data.end(), vec.begin(),
+                       [](int i) { return std::to_string(i); });
+        std::vector<std::string> expected = vec;
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+        REQUIRE(rng::sort(rng::execution::par, vec, rng::greater{}) ==
+                vec.end());
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("sort with many equal keys") {
+        std::vector<int> vec(big);
+        for (int i = 0; i < big; i++) {
+            vec[i] = data[i] % 3;
+        }
+        std::vector<int> expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        rng::sort(rng::execution::par, vec.begin(), vec.end());
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("sort large enough to be sample sorted") {
+        const int n = 1 << 21;
+        std::vector<long> vec(n);
+        for (int i = 0; i < n; i++) {
+            vec[i] = (i * 2654435761L) % 1000003;
+        }
+        std::vector<long> expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        REQUIRE(rng::sort(rng::execution::par, vec, rng::less{},
+                          std::negate<>{}) == vec.end());
+        REQUIRE(std::equal(vec.begin(), vec.end(), expected.rbegin()));
+    }
+
+    SECTION("stable_sort") {
+        struct int_pair {
+            int key;
+            int index;
+        };
+
+        std::vector<int_pair> vec(big);
+        for (int i = 0; i < big; i++) {
+            vec[i] = {data[i] % 10, i};
+        }
+
+        const auto last = rng::stable_sort(rng::execution::par, vec.begin(),
+                                           vec.end(), rng::less{},
+                                           &int_pair::key);
+        REQUIRE(last == vec.end());
+        REQUIRE(std::is_sorted(vec.begin(), vec.end(),
+                               [](const int_pair& a, const int_pair& b) {
+                                   return a.key < b.key ||
+                                          (a.key == b.key && a.index < b.index);
+                               }));
+    }
+}
@@ -5,8 +5,10 @@
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <list>
+#include <random>
 #include <sstream>
 #include <vector>
 
@@ -218,4 +220,153 @@ TEST_CASE("alg.basic.includes")
         REQUIRE(nano::includes(rng1, rng2, nano::greater{}));
         REQUIRE_FALSE(nano::includes(rng1, rng3, nano::greater{}));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("alg.basic.set_ops_skewed")
+{
+    // Ranges of very different lengths, and runs of equal elements, so that
+    // the algorithms gallop through both ranges in turn
+    std::mt19937 gen(7);
+
+    for (int ratio : {1, 3, 20, 100, 1000}) {
+        std::vector<int> big(2000 + ratio);
+        for (int& i : big) {
+            i = static_cast<int>(gen() % 5000);
+        }
+        std::vector<int> small(2000 / ratio + 3);
+        for (int& i : small) {
+            i = static_cast<int>(gen() % 5000);
+        }
+        // A long stretch of equal elements in each
+        small.insert(small.end(), 50, 1234);
+        big.insert(big.end(), 20, 1234);
+        std::sort(big.begin(), big.end());
+        std::sort(small.begin(), small.end());
+
+        for (int swap = 0; swap < 2; swap++) {
+            const auto& a = swap ? small : big;
+            const auto& b = swap ? big : small;
+
+            std::vector<int> expected;
+            std::vector<int> out;
+
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                                  std::back_inserter(expected));
+            nano::set_intersection(a, b, nano::back_inserter(out));
+            CHECK(out == expected);
+
+            expected.clear();
+            out.clear();
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                                std::back_inserter(expected));
+            const auto diff = nano::set_difference(a, b, nano::back_inserter(out));
+            CHECK(diff.in == a.end());
+            CHECK(out == expected);
+
+            expected.clear();
+            out.clear();
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                           std::back_inserter(expected));
+            const auto uni = nano::set_union(a, b, nano::back_inserter(out));
+            CHECK(uni.in1 == a.end());
+            CHECK(uni.in2 == b.end());
+            CHECK(out == expected);
+
+            expected.clear();
+            out.clear();
+            std::set_symmetric_difference(a.begin(), a.end(), b.begin(),
+                                          b.end(),
+                                          std::back_inserter(expected));
+            nano::set_symmetric_difference(a, b, nano::back_inserter(out));
+            CHECK(out == expected);
+
+            CHECK(nano::includes(a, b) ==
+                  std::includes(a.begin(), a.end(), b.begin(), b.end()));
+            CHECK(nano::includes(a, expected) ==
+                  std::includes(a.begin(), a.end(), expected.begin(),
+                                expected.end()));
+        }
+
+        // Without knowing the lengths of both ranges, we always gallop
+        {
+            const std::list<int> small_list(small.begin(), small.end());
+            std::vector<int> expected;
+            std::vector<int> out;
+
+            std::set_intersection(big.begin(), big.end(), small.begin(),
+                                  small.end(), std::back_inserter(expected));
+            nano::set_intersection(big, small_list, nano::back_inserter(out));
+            CHECK(out == expected);
+
+            expected.clear();
+            out.clear();
+            std::set_difference(big.begin(), big.end(), small.begin(),
+                                small.end(), std::back_inserter(expected));
+            nano::set_difference(big, small_list, nano::back_inserter(out));
+            CHECK(out == expected);
+        }
+
+        // A scattering of the elements of big is a subset of it
+        std::vector<int> half;
+        for (std::size_t i = 0; i < big.size(); i += 2 + i % 50) {
+            half.push_back(big[i]);
+        }
+        CHECK(nano::includes(big, half));
+        half.push_back(5001);
+        CHECK_FALSE(nano::includes(big, half));
+    }
+}
+
+TEST_CASE("alg.basic.merge_n")
+{
+    std::mt19937 gen(1729);
+
+    SECTION("matches sorting the concatenation")
+    {
+        for (std::size_t k : {0, 1, 2, 5, 37}) {
+            std::vector<std::vector<int>> runs(k);
+            std::vector<int> expected;
+            for (std::size_t i = 0; i < k; i++) {
+                // Leave some of the runs empty
+                const std::size_t n = (i % 4 == 3) ? 0 : gen() % 200;
+                for (std::size_t j = 0; j < n; j++) {
+                    runs[i].push_back(static_cast<int>(gen() % 500));
+                }
+                std::sort(runs[i].begin(), runs[i].end());
+                expected.insert(expected.end(), runs[i].begin(),
+                                runs[i].end());
+            }
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<int> out(expected.size());
+            const auto last = nano::merge_n(runs, out.begin());
+            CHECK(last == out.end());
+            CHECK(out == expected);
+        }
+    }
+
+    SECTION("is stable, with a comparator and projection")
+    {
+        using pair_t = std::pair<int, int>;
+        std::vector<std::list<pair_t>> runs(9);
+        for (int i = 0; i < 9; i++) {
+            for (int key = 10; key > 0; key -= 1 + i % 3) {
+                runs[i].emplace_back(key, i);
+            }
+        }
+
+        std::vector<pair_t> out;
+        nano::merge_n(runs, nano::back_inserter(out), nano::greater{},
+                      &pair_t::first);
+
+        std::vector<pair_t> expected;
+        for (const auto& r : runs) {
+            expected.insert(expected.end(), r.begin(), r.end());
+        }
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const pair_t& a, const pair_t& b) {
+                             return a.first > b.first;
+                         });
+        CHECK(out == expected);
+    }
+}
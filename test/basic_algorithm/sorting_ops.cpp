@@ -5,6 +5,10 @@
 
 #include "../test_utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
 #include <iterator>
 #include <list>
 #include <sstream>
@@ -256,6 +260,81 @@ TEST_CASE("alg.basic.stable_sort (with comparator)")
     REQUIRE(vec == check);
 }
 
+TEST_CASE("alg.basic.radix_sort")
+{
+    SECTION("signed integers") {
+        std::vector<int> vec{5, -3, 1000000, 0, -2147483647 - 1, 7, 2147483647, -3};
+        std::vector<int> check = vec;
+        std::sort(check.begin(), check.end());
+
+        SECTION("with iterators") {
+            REQUIRE(rng::radix_sort(vec.begin(), vec.end()) == vec.end());
+        }
+
+        SECTION("with range") {
+            REQUIRE(rng::radix_sort(vec) == vec.end());
+        }
+
+        REQUIRE(vec == check);
+    }
+
+    SECTION("floating point, descending") {
+        std::deque<double> deq{1.5, -0.25, 3e100, -1e-300, 0.0, -7.0, 2.0};
+        rng::radix_sort(deq, rng::greater{});
+        const std::deque<double> check{3e100, 2.0, 1.5, 0.0, -1e-300, -0.25, -7.0};
+        REQUIRE(deq == check);
+    }
+
+    SECTION("is stable") {
+        std::vector<int_pair> vec;
+        for (int i = 0; i < 1000; i++) {
+            vec.push_back({(i * 7919) % 13, i});
+        }
+        vec.push_back({0, 1000});
+        std::vector<int_pair> check = vec;
+        std::stable_sort(check.begin(), check.end());
+
+        rng::radix_sort(vec, rng::less{}, &int_pair::i);
+        REQUIRE(vec == check);
+
+        // -0.0 and 0.0 are equivalent
+        std::vector<float> floats{0.0f, -0.0f, 1.0f, 0.0f, -0.0f};
+        rng::radix_sort(floats);
+        REQUIRE_FALSE(std::signbit(floats[0]));
+        REQUIRE(std::signbit(floats[1]));
+        REQUIRE_FALSE(std::signbit(floats[2]));
+        REQUIRE(std::signbit(floats[3]));
+        REQUIRE(floats[4] == 1.0f);
+    }
+}
+
+TEST_CASE("alg.basic.sort (arithmetic keys)")
+{
+    // Large enough to be radix sorted
+    std::vector<std::int64_t> vec(10000);
+    std::uint64_t x = 1;
+    for (auto& i : vec) {
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        i = static_cast<std::int64_t>(x);
+    }
+    auto check = vec;
+
+    std::sort(check.begin(), check.end());
+    rng::sort(vec);
+    REQUIRE(vec == check);
+
+    std::sort(check.begin(), check.end(), std::greater<>{});
+    rng::sort(vec, std::greater<>{});
+    REQUIRE(vec == check);
+
+    std::vector<int_pair> pairs;
+    for (int i = 0; i < 10000; i++) {
+        pairs.push_back({i, (i * 7919) % 10007});
+    }
+    rng::sort(pairs, rng::less{}, &int_pair::j);
+    REQUIRE(rng::is_sorted(pairs, rng::less{}, &int_pair::j));
+}
+
 TEST_CASE("alg.basic.nth_element")
 {
     std::vector<int> vec{5, 4, 3, 2, 1};
@@ -284,4 +363,204 @@ TEST_CASE("alg.basic.nth_element (with comparator)")
     }
 
     REQUIRE(vec[1] == 4);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// McIlroy's adversary (see "A killer adversary for quicksort"), which only
+// decides how the elements are ordered as they are compared, so as to make
+// every pivot as bad as it can be. The elements are the indices of values
+// which start out all equal, the "gas", and are frozen one at a time.
+struct quicksort_adversary {
+    explicit quicksort_adversary(int n) : values(n, n), gas(n) {}
+
+    bool operator()(int x, int y)
+    {
+        ++comparisons;
+        if (values[x] == gas && values[y] == gas) {
+            values[x == candidate ? x : y] = solid++;
+        }
+        if (values[x] == gas) {
+            candidate = x;
+        } else if (values[y] == gas) {
+            candidate = y;
+        }
+        return values[x] < values[y];
+    }
+
+    std::vector<int> values;
+    int gas;
+    int solid = 0;
+    int candidate = 0;
+    long comparisons = 0;
+};
+
+// Checks the guarantee of nth_elements(): between each pair of consecutive
+// requested positions i < j, every element of [prev, i) is not after *i
+// and every element of (i, j) is not before it, where prev is the requested
+// position before i
+template <typename I, typename Comp, typename Proj>
+void check_nth_elements(I first, I last, std::vector<I> nths, Comp comp,
+                        Proj proj)
+{
+    rng::sort(nths);
+    nths.erase(rng::unique(nths), nths.end());
+    if (!nths.empty() && nths.back() == last) {
+        nths.pop_back();
+    }
+
+    I prev = first;
+    for (std::size_t n = 0; n < nths.size(); ++n) {
+        const I i = nths[n];
+        const I j = n + 1 < nths.size() ? nths[n + 1] : last;
+        const auto& nth = rng::invoke(proj, *i);
+        REQUIRE(rng::none_of(prev, i, [&](const auto& x) {
+            return rng::invoke(comp, nth, rng::invoke(proj, x));
+        }));
+        REQUIRE(rng::none_of(i + 1, j, [&](const auto& x) {
+            return rng::invoke(comp, rng::invoke(proj, x), nth);
+        }));
+        prev = i;
+    }
+}
+
+}
+
+TEST_CASE("alg.basic.nth_element (input patterns)")
+{
+    const int n = 10000;
+    std::vector<int> vec(n);
+
+    SECTION("sorted") {
+        for (int i = 0; i < n; i++) {
+            vec[i] = i;
+        }
+    }
+
+    SECTION("reversed") {
+        for (int i = 0; i < n; i++) {
+            vec[i] = n - i;
+        }
+    }
+
+    SECTION("organ pipe") {
+        for (int i = 0; i < n; i++) {
+            vec[i] = i < n / 2 ? i : n - i;
+        }
+    }
+
+    SECTION("all equal") {
+        rng::fill(vec, 7);
+    }
+
+    SECTION("few distinct") {
+        for (int i = 0; i < n; i++) {
+            vec[i] = (i * 7919) % 5;
+        }
+    }
+
+    SECTION("pseudo-random") {
+        for (int i = 0; i < n; i++) {
+            vec[i] = (i * 7919) % 10007;
+        }
+    }
+
+    std::vector<int> sorted = vec;
+    rng::sort(sorted);
+
+    for (int k : {0, 1, n / 100, n / 3, n / 2, n - 2, n - 1}) {
+        std::vector<int> v = vec;
+        REQUIRE(rng::nth_element(v, v.begin() + k) == v.end());
+        REQUIRE(v[k] == sorted[k]);
+        REQUIRE(rng::all_of(v.begin(), v.begin() + k,
+                            [&](int i) { return i <= v[k]; }));
+        REQUIRE(rng::all_of(v.begin() + k, v.end(),
+                            [&](int i) { return i >= v[k]; }));
+    }
+}
+
+TEST_CASE("alg.basic.nth_element (worst case)")
+{
+    // However the pivots go wrong, the selection falls back to the median of
+    // medians before it takes more than O(n) comparisons
+    const int n = 10000;
+
+    for (int k : {n / 4, n / 2, n - 2}) {
+        std::vector<int> vec(n);
+        for (int i = 0; i < n; i++) {
+            vec[i] = i;
+        }
+        quicksort_adversary adversary(n);
+        rng::nth_element(vec, vec.begin() + k,
+                         [&](int x, int y) { return adversary(x, y); });
+
+        const auto& values = adversary.values;
+        REQUIRE(adversary.comparisons < 30L * n);
+        REQUIRE(rng::all_of(vec.begin(), vec.begin() + k, [&](int i) {
+            return values[i] <= values[vec[k]];
+        }));
+        REQUIRE(rng::all_of(vec.begin() + k, vec.end(), [&](int i) {
+            return values[i] >= values[vec[k]];
+        }));
+    }
+}
+
+TEST_CASE("alg.basic.nth_elements")
+{
+    const int n = 1000;
+    std::vector<int> vec(n);
+    for (int i = 0; i < n; i++) {
+        vec[i] = (i * 7919) % 1009;
+    }
+    std::vector<int> sorted = vec;
+    rng::sort(sorted);
+
+    // Unordered, repeated, and including the end
+    const std::vector<int> indices{900, 10, 500, 500, 0, n - 1, n, 250, 10};
+
+    std::vector<std::vector<int>::iterator> nths;
+    for (int i : indices) {
+        nths.push_back(vec.begin() + i);
+    }
+
+    SECTION("with iterators") {
+        REQUIRE(rng::nth_elements(vec.begin(), vec.end(), nths) == vec.end());
+    }
+
+    SECTION("with range") {
+        REQUIRE(rng::nth_elements(vec, nths) == vec.end());
+    }
+
+    for (int i : indices) {
+        if (i != n) {
+            REQUIRE(vec[i] == sorted[i]);
+        }
+    }
+    REQUIRE(rng::is_permutation(vec, sorted));
+    check_nth_elements(vec.begin(), vec.end(), nths, rng::less{},
+                       rng::identity{});
+}
+
+TEST_CASE("alg.basic.nth_elements (with comparator and projection)")
+{
+    std::vector<int_pair> pairs;
+    for (int i = 0; i < 1000; i++) {
+        pairs.push_back({i, (i * 7919) % 1009});
+    }
+
+    std::vector<std::vector<int_pair>::iterator> quartiles{
+        pairs.begin() + 750, pairs.begin() + 250, pairs.begin() + 500};
+    rng::nth_elements(pairs, quartiles, rng::greater{}, &int_pair::j);
+
+    std::vector<int> js;
+    for (const auto& p : pairs) {
+        js.push_back(p.j);
+    }
+    rng::sort(js, rng::greater{});
+
+    for (auto it : quartiles) {
+        REQUIRE(it->j == js[it - pairs.begin()]);
+    }
+    check_nth_elements(pairs.begin(), pairs.end(), quartiles, rng::greater{},
+                       &int_pair::j);
+}
@@ -0,0 +1,64 @@
+#include <nanorange/numeric/exclusive_scan.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+    int i;
+};
+
+}
+
+TEST_CASE("num.exclusive_scan")
+{
+    const int ia[] = {1, 2, 3, 4, 5};
+    constexpr auto sa = std::size(ia);
+
+    SECTION("with iterators") {
+        int out[sa] = {};
+        const auto res = nano::exclusive_scan(
+            ::input_iterator<const int*>(ia),
+            sentinel<const int*>(ia + sa), out, 0);
+        CHECK(res.in.base() == ia + sa);
+        CHECK(res.out == out + sa);
+        CHECK(std::vector<int>(out, out + sa) ==
+              std::vector<int>{0, 1, 3, 6, 10});
+
+        const auto res2 = nano::exclusive_scan(ia, ia, out, 0);
+        CHECK(res2.in == ia);
+        CHECK(res2.out == out);
+    }
+
+    SECTION("with ranges, an operation and a projection") {
+        std::vector<long> out(sa);
+        nano::exclusive_scan(ia, out.begin(), 1L, std::multiplies<>{});
+        CHECK(out == std::vector<long>{1, 1, 2, 6, 24});
+
+        nano::exclusive_scan(ia, out.begin(), 0L, std::plus<>{},
+                             std::negate<>{});
+        CHECK(out == std::vector<long>{0, -1, -3, -6, -10});
+
+        S s[] = {{1}, {2}, {3}};
+        nano::exclusive_scan(s, out.begin(), 0, std::plus<>{}, &S::i);
+        CHECK(out[2] == 3);
+
+        const std::vector<std::string> strs{"a", "b", "c"};
+        std::vector<std::string> sout(3);
+        nano::exclusive_scan(strs, sout.begin(), std::string{">"});
+        CHECK(sout == std::vector<std::string>{">", ">a", ">ab"});
+    }
+
+    SECTION("in place") {
+        std::vector<int> vec(ia, ia + sa);
+        const auto res = nano::exclusive_scan(vec, vec.begin(), 0);
+        CHECK(res.in == vec.end());
+        CHECK(res.out == vec.end());
+        CHECK(vec == std::vector<int>{0, 1, 3, 6, 10});
+    }
+}
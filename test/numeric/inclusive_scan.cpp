@@ -0,0 +1,70 @@
+#include <nanorange/numeric/inclusive_scan.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+    int i;
+};
+
+}
+
+TEST_CASE("num.inclusive_scan")
+{
+    const int ia[] = {1, 2, 3, 4, 5};
+    constexpr auto sa = std::size(ia);
+
+    SECTION("with iterators") {
+        int out[sa] = {};
+        const auto res = nano::inclusive_scan(
+            ::input_iterator<const int*>(ia),
+            sentinel<const int*>(ia + sa), out);
+        CHECK(res.in.base() == ia + sa);
+        CHECK(res.out == out + sa);
+        CHECK(std::vector<int>(out, out + sa) ==
+              std::vector<int>{1, 3, 6, 10, 15});
+
+        const auto res2 = nano::inclusive_scan(ia, ia, out);
+        CHECK(res2.in == ia);
+        CHECK(res2.out == out);
+    }
+
+    SECTION("with ranges, an operation and a projection") {
+        std::vector<long> out(sa);
+        nano::inclusive_scan(ia, out.begin(), std::multiplies<>{});
+        CHECK(out == std::vector<long>{1, 2, 6, 24, 120});
+
+        nano::inclusive_scan(ia, out.begin(), std::plus<>{}, std::negate<>{});
+        CHECK(out == std::vector<long>{-1, -3, -6, -10, -15});
+
+        S s[] = {{1}, {2}, {3}};
+        nano::inclusive_scan(s, out.begin(), std::plus<>{}, &S::i);
+        CHECK(out[2] == 6);
+    }
+
+    SECTION("with an initial value") {
+        std::vector<int> out(sa);
+        nano::inclusive_scan(ia, ia + sa, out.begin(), std::plus<>{}, 10);
+        CHECK(out == std::vector<int>{11, 13, 16, 20, 25});
+
+        const std::vector<std::string> strs{"a", "b", "c"};
+        std::vector<std::string> sout(3);
+        nano::inclusive_scan(strs, sout.begin(), std::plus<>{},
+                             std::string{">"});
+        CHECK(sout == std::vector<std::string>{">a", ">ab", ">abc"});
+    }
+
+    SECTION("in place") {
+        std::vector<int> vec(ia, ia + sa);
+        const auto res = nano::inclusive_scan(vec, vec.begin());
+        CHECK(res.in == vec.end());
+        CHECK(res.out == vec.end());
+        CHECK(vec == std::vector<int>{1, 3, 6, 10, 15});
+    }
+}
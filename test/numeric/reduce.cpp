@@ -0,0 +1,73 @@
+#include <nanorange/numeric/reduce.hpp>
+
+#include <nanorange/views/iota.hpp>
+
+#include <array>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+    int i;
+};
+
+constexpr int constexpr_sum()
+{
+    const std::array<int, 20> arr{1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                  11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    return nano::reduce(arr) + nano::reduce(arr, 0, std::multiplies<>{},
+                                            [](int i) { return i % 2; });
+}
+
+}
+
+TEST_CASE("num.reduce")
+{
+    int ia[] = {1, 2, 3, 4, 5, 6};
+    constexpr auto sa = std::size(ia);
+
+    SECTION("with iterators") {
+        CHECK(nano::reduce(ia, ia + sa) == 21);
+        CHECK(nano::reduce(ia, ia + sa, 10) == 31);
+        CHECK(nano::reduce(ia, ia, 10) == 10);
+        CHECK(nano::reduce(ia, ia + sa, 1, std::multiplies<>{}) == 720);
+        CHECK(nano::reduce(::input_iterator<const int*>(ia),
+                           ::input_iterator<const int*>(ia + sa), 0) == 21);
+        CHECK(nano::reduce(::forward_iterator<const int*>(ia),
+                           sentinel<const int*>(ia + sa), 0,
+                           std::plus<>{}, std::negate<>{}) == -21);
+    }
+
+    SECTION("with ranges") {
+        CHECK(nano::reduce(ia) == 21);
+        CHECK(nano::reduce(ia, 0L, std::plus<>{},
+                           [](int i) { return i * i; }) == 91);
+
+        S s[] = {{1}, {2}, {3}};
+        CHECK(nano::reduce(s, 0, std::plus<>{}, &S::i) == 6);
+
+        const std::vector<std::string> strs{"a", "b", "c"};
+        CHECK(nano::reduce(strs, std::string{}) == "abc");
+    }
+
+    SECTION("with more elements than accumulators") {
+        for (int n : {0, 1, 7, 8, 15, 16, 17, 31, 100, 1001}) {
+            CHECK(nano::reduce(nano::views::iota(0, n), 0L) ==
+                  static_cast<long>(n) * (n - 1) / 2);
+
+            std::vector<double> vec(n);
+            std::iota(vec.begin(), vec.end(), 0.0);
+            CHECK(nano::reduce(vec) == static_cast<double>(n) * (n - 1) / 2);
+        }
+    }
+
+    SECTION("constexpr") {
+        static_assert(constexpr_sum() == 210, "");
+    }
+}
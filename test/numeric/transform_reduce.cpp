@@ -0,0 +1,72 @@
+#include <nanorange/numeric/transform_reduce.hpp>
+
+#include <functional>
+#include <list>
+#include <vector>
+
+#include "../catch.hpp"
+#include "../test_iterators.hpp"
+
+namespace {
+
+struct S {
+    int i;
+};
+
+const auto square = [](int i) { return i * i; };
+
+}
+
+TEST_CASE("num.transform_reduce")
+{
+    int ia[] = {1, 2, 3, 4, 5, 6};
+    int ib[] = {6, 5, 4, 3, 2, 1, 0};
+    constexpr auto sa = std::size(ia);
+
+    SECTION("unary") {
+        CHECK(nano::transform_reduce(ia, ia + sa, 0, std::plus<>{}, square) ==
+              91);
+        CHECK(nano::transform_reduce(::input_iterator<const int*>(ia),
+                                     ::input_iterator<const int*>(ia + sa), 0,
+                                     std::plus<>{}, square) == 91);
+        CHECK(nano::transform_reduce(ia, 1, std::multiplies<>{}, square) ==
+              518400);
+
+        S s[] = {{1}, {2}, {3}};
+        CHECK(nano::transform_reduce(s, 0, std::plus<>{}, square, &S::i) ==
+              14);
+    }
+
+    SECTION("binary") {
+        // 1*6 + 2*5 + 3*4 + 4*3 + 5*2 + 6*1
+        CHECK(nano::transform_reduce(ia, ia + sa, ib, ib + 7, 0) == 56);
+        CHECK(nano::transform_reduce(ia, ib, 0) == 56);
+        CHECK(nano::transform_reduce(ib, ia, 100) == 156);
+        CHECK(nano::transform_reduce(ia, ib, 0, std::plus<>{}, std::minus<>{},
+                                     std::negate<>{}) == -42);
+
+        const std::list<int> l(ib, ib + 7);
+        CHECK(nano::transform_reduce(ia, l, 0) == 56);
+        CHECK(nano::transform_reduce(l, ia, 0L, std::plus<>{},
+                                     std::plus<>{}) == 42);
+
+        S s[] = {{1}, {2}, {3}};
+        CHECK(nano::transform_reduce(s, s, 0, std::plus<>{},
+                                     std::multiplies<>{}, &S::i, &S::i) == 14);
+    }
+
+    SECTION("binary, with more elements than accumulators") {
+        std::vector<long> a(1001);
+        std::vector<long> b(1000);
+        long expected = 0;
+        for (long i = 0; i < 1001; i++) {
+            a[i] = i;
+            if (i < 1000) {
+                b[i] = 1000 - i;
+                expected += i * (1000 - i);
+            }
+        }
+        CHECK(nano::transform_reduce(a, b, 0L) == expected);
+        CHECK(nano::transform_reduce(b, a, 0L) == expected);
+    }
+}
@@ -0,0 +1,106 @@
+// nanorange/test/views/adjacent_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/adjacent.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/take_while.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_adj = ranges::adjacent_view<ranges::ref_view<std::vector<int>>, 3>;
+
+static_assert(ranges::view<vec_adj>);
+static_assert(ranges::random_access_range<vec_adj>);
+static_assert(ranges::random_access_range<const vec_adj>);
+static_assert(ranges::sized_range<vec_adj>);
+static_assert(ranges::common_range<vec_adj>);
+static_assert(ranges::same_as<ranges::range_reference_t<vec_adj>,
+                              ranges::detail::zip_tuple<int&, int&, int&>>);
+static_assert(ranges::same_as<ranges::range_value_t<vec_adj>,
+                              std::tuple<int, int, int>>);
+
+using list_adj = ranges::adjacent_view<ranges::ref_view<std::list<int>>, 2>;
+static_assert(ranges::bidirectional_range<list_adj>);
+static_assert(ranges::common_range<list_adj>);
+
+}
+
+TEST_CASE("views.adjacent")
+{
+    std::vector<int> vec{0, 1, 2, 3, 4};
+
+    SECTION("random access")
+    {
+        auto a = vec | views::adjacent<3>;
+        CHECK(a.size() == 3);
+        CHECK(a.end() - a.begin() == 3);
+        CHECK(std::get<1>(a[2]) == 3);
+
+        std::vector<int> out;
+        for (auto [x, y, z] : a) {
+            out.push_back(x * 100 + y * 10 + z);
+        }
+        CHECK(out == std::vector<int>{12, 123, 234});
+
+        out.clear();
+        for (auto [x, y, z] : a | views::reverse) {
+            out.push_back(x * 100 + y * 10 + z);
+        }
+        CHECK(out == std::vector<int>{234, 123, 12});
+    }
+
+    SECTION("pairwise")
+    {
+        std::list<int> l{1, 2, 4, 8};
+        std::vector<int> diffs;
+        for (auto [x, y] : views::pairwise(l)) {
+            diffs.push_back(y - x);
+        }
+        CHECK(diffs == std::vector<int>{1, 2, 4});
+
+        diffs.clear();
+        for (auto [x, y] : l | views::pairwise | views::reverse) {
+            diffs.push_back(y - x);
+        }
+        CHECK(diffs == std::vector<int>{4, 2, 1});
+
+        std::forward_list<int> fl{1, 2, 4};
+        CHECK(ranges::distance(views::pairwise(fl)) == 2);
+
+        auto tw = views::iota(0) |
+                  views::take_while([](int i) { return i < 5; });
+        CHECK(ranges::distance(tw | views::pairwise) == 4);
+    }
+
+    SECTION("writable")
+    {
+        auto p = views::pairwise(vec);
+        std::get<1>(*p.begin()) = 10;
+        CHECK(vec[1] == 10);
+        ranges::iter_swap(p.begin(), p.begin() + 2);
+        CHECK(vec == std::vector<int>{2, 3, 0, 10, 4});
+    }
+
+    SECTION("too short")
+    {
+        std::vector<int> one{1};
+        CHECK(ranges::empty(views::pairwise(one)));
+        CHECK(views::pairwise(one).size() == 0);
+        CHECK(ranges::empty(views::adjacent<0>(vec)));
+        static_assert(ranges::same_as<decltype(views::adjacent<0>(vec)),
+                                      ranges::empty_view<std::tuple<>>>);
+    }
+}
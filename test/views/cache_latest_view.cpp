@@ -0,0 +1,113 @@
+// nanorange/test/views/cache_latest_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/cache_latest.hpp>
+#include <nanorange/views/filter.hpp>
+#include <nanorange/views/istream.hpp>
+#include <nanorange/views/take_while.hpp>
+#include <nanorange/views/transform.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_cache = ranges::cache_latest_view<ranges::ref_view<std::vector<int>>>;
+
+static_assert(ranges::view<vec_cache>);
+static_assert(ranges::input_range<vec_cache>);
+static_assert(!ranges::forward_range<vec_cache>);
+static_assert(ranges::sized_range<vec_cache>);
+static_assert(ranges::same_as<ranges::range_reference_t<vec_cache>, int&>);
+static_assert(ranges::same_as<ranges::range_rvalue_reference_t<vec_cache>,
+                              int&&>);
+
+}
+
+TEST_CASE("views.cache_latest")
+{
+    std::vector<int> vec{1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    const auto square = [&calls](int i) {
+        ++calls;
+        return std::to_string(i * i);
+    };
+    const auto two_digits = [](const std::string& s) { return s.size() == 2; };
+
+    SECTION("transform then filter")
+    {
+        std::vector<std::string> out;
+        for (auto&& s : vec | views::transform(square) |
+                            views::filter(two_digits)) {
+            out.push_back(s);
+        }
+        CHECK(out == std::vector<std::string>{"16", "25", "36"});
+        // Once in the predicate and again in the loop for each which passes
+        CHECK(calls == 9);
+
+        calls = 0;
+        out.clear();
+        auto cached = vec | views::transform(square) | views::cache_latest |
+                      views::filter(two_digits);
+        static_assert(ranges::same_as<
+            ranges::range_reference_t<decltype(cached)>, std::string&>);
+        for (auto& s : cached) {
+            out.push_back(s);
+        }
+        CHECK(out == std::vector<std::string>{"16", "25", "36"});
+        CHECK(calls == 6);
+    }
+
+    SECTION("transform then take_while")
+    {
+        int sum = 0;
+        for (const auto& s : vec | views::transform(square) |
+                                 views::cache_latest |
+                                 views::take_while(
+                                     [](const std::string& s) {
+                                         return s.size() == 1;
+                                     })) {
+            sum += std::stoi(s);
+        }
+        CHECK(sum == 14);
+        CHECK(calls == 4);
+    }
+
+    SECTION("references pass through")
+    {
+        auto c = views::cache_latest(vec);
+        CHECK(c.size() == 6);
+        for (int& i : c) {
+            i *= 2;
+        }
+        CHECK(vec == std::vector<int>{2, 4, 6, 8, 10, 12});
+    }
+
+    SECTION("input ranges")
+    {
+        std::istringstream ss("1 2 3");
+        ::check_equal(ranges::istream_view<int>(ss) | views::cache_latest,
+                      {1, 2, 3});
+    }
+
+    SECTION("copies do not share the cache")
+    {
+        auto c = vec | views::transform(square) | views::cache_latest;
+        auto it = c.begin();
+        CHECK(*it == "1");
+        auto copy = c;
+        auto copy_it = copy.begin();
+        ++copy_it;
+        CHECK(*copy_it == "4");
+        CHECK(*it == "1");
+    }
+}
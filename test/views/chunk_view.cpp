@@ -0,0 +1,142 @@
+// nanorange/test/views/chunk_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/chunk.hpp>
+#include <nanorange/detail/iterator/contiguous.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/istream.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/take_while.hpp>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_chunk = ranges::chunk_view<ranges::ref_view<std::vector<int>>>;
+
+static_assert(ranges::view<vec_chunk>);
+static_assert(ranges::random_access_range<vec_chunk>);
+static_assert(ranges::random_access_range<const vec_chunk>);
+static_assert(ranges::sized_range<vec_chunk>);
+static_assert(ranges::common_range<vec_chunk>);
+// The chunks are subranges of the base iterators, so the contiguous fast
+// paths of the algorithms still apply to them
+static_assert(ranges::same_as<ranges::range_reference_t<vec_chunk>,
+                              ranges::subrange<std::vector<int>::iterator>>);
+static_assert(ranges::detail::memory_contiguous_iterator<
+              ranges::iterator_t<ranges::range_reference_t<vec_chunk>>>);
+
+using list_chunk = ranges::chunk_view<ranges::ref_view<std::list<int>>>;
+static_assert(ranges::bidirectional_range<list_chunk>);
+static_assert(!ranges::random_access_range<list_chunk>);
+static_assert(ranges::common_range<list_chunk>);
+
+using fwd_chunk = ranges::chunk_view<ranges::ref_view<std::forward_list<int>>>;
+static_assert(ranges::forward_range<fwd_chunk>);
+static_assert(!ranges::bidirectional_range<fwd_chunk>);
+static_assert(ranges::common_range<fwd_chunk>);
+
+using input_chunk = ranges::chunk_view<ranges::basic_istream_view<int, char>>;
+static_assert(ranges::input_range<input_chunk>);
+static_assert(!ranges::forward_range<input_chunk>);
+static_assert(ranges::input_range<ranges::range_reference_t<input_chunk>>);
+
+template <typename R>
+std::vector<std::vector<int>> to_vectors(R&& r)
+{
+    std::vector<std::vector<int>> out;
+    for (auto&& chunk : r) {
+        out.emplace_back();
+        for (auto&& i : chunk) {
+            out.back().push_back(i);
+        }
+    }
+    return out;
+}
+
+using vv = std::vector<std::vector<int>>;
+
+}
+
+TEST_CASE("views.chunk")
+{
+    std::vector<int> vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    SECTION("random access")
+    {
+        auto c = views::chunk(vec, 3);
+        CHECK(to_vectors(c) == vv{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9}});
+        CHECK(c.size() == 4);
+        CHECK(c.end() - c.begin() == 4);
+        CHECK(c.begin() - c.end() == -4);
+        CHECK(c[3].size() == 1);
+        CHECK(&c[1].front() == &vec[3]);
+
+        auto it = c.end();
+        it -= 2;
+        CHECK((*it).front() == 6);
+        CHECK(it - c.begin() == 2);
+        it += 2;
+        CHECK(it == c.end());
+        CHECK(c.begin() + 4 == c.end());
+
+        CHECK(to_vectors(c | views::reverse) ==
+              vv{{9}, {6, 7, 8}, {3, 4, 5}, {0, 1, 2}});
+        CHECK(to_vectors(vec | views::chunk(5) | views::reverse) ==
+              vv{{5, 6, 7, 8, 9}, {0, 1, 2, 3, 4}});
+    }
+
+    SECTION("bidirectional")
+    {
+        std::list<int> l{0, 1, 2, 3, 4, 5, 6};
+        auto c = views::chunk(l, 2);
+        CHECK(c.size() == 4);
+        CHECK(to_vectors(c) == vv{{0, 1}, {2, 3}, {4, 5}, {6}});
+        CHECK(to_vectors(c | views::reverse) ==
+              vv{{6}, {4, 5}, {2, 3}, {0, 1}});
+    }
+
+    SECTION("forward")
+    {
+        std::forward_list<int> fl{0, 1, 2, 3, 4};
+        CHECK(to_vectors(views::chunk(fl, 2)) == vv{{0, 1}, {2, 3}, {4}});
+
+        auto tw = views::iota(0) |
+                  views::take_while([](int i) { return i < 5; });
+        CHECK(to_vectors(tw | views::chunk(2)) == vv{{0, 1}, {2, 3}, {4}});
+    }
+
+    SECTION("input")
+    {
+        std::istringstream ss("1 2 3 4 5 6 7");
+        auto c = ranges::istream_view<int>(ss) | views::chunk(3);
+        CHECK(to_vectors(c) == vv{{1, 2, 3}, {4, 5, 6}, {7}});
+
+        // Moving to the next chunk skips whatever we didn't read
+        std::istringstream ss2("1 2 3 4 5 6 7");
+        std::vector<int> firsts;
+        for (auto chunk : ranges::istream_view<int>(ss2) | views::chunk(3)) {
+            firsts.push_back(*chunk.begin());
+        }
+        CHECK(firsts == std::vector<int>{1, 4, 7});
+    }
+
+    SECTION("empty")
+    {
+        std::vector<int> empty;
+        auto c = views::chunk(empty, 3);
+        CHECK(c.size() == 0);
+        CHECK(c.begin() == c.end());
+    }
+}
@@ -0,0 +1,177 @@
+// nanorange/test/views/concat_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/concat.hpp>
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/find.hpp>
+#include <nanorange/algorithm/for_each.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/istream.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/take_while.hpp>
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using ra_concat =
+    ranges::concat_view<ranges::ref_view<std::array<int, 2>>,
+                        ranges::ref_view<std::vector<int>>,
+                        ranges::ref_view<int[3]>>;
+
+static_assert(ranges::view<ra_concat>);
+static_assert(ranges::random_access_range<ra_concat>);
+static_assert(ranges::random_access_range<const ra_concat>);
+static_assert(ranges::sized_range<ra_concat>);
+static_assert(ranges::common_range<ra_concat>);
+static_assert(ranges::same_as<ranges::range_reference_t<ra_concat>, int&>);
+static_assert(ranges::detail::segmented_iterator<
+              ranges::iterator_t<ra_concat>, ranges::iterator_t<ra_concat>>);
+static_assert(ranges::detail::segmented_iterator<
+              ranges::iterator_t<ra_concat>, ranges::default_sentinel_t>);
+static_assert(!ranges::detail::segmented_iterator<int*, int*>);
+
+using list_concat = ranges::concat_view<ranges::ref_view<std::list<int>>,
+                                        ranges::ref_view<std::vector<int>>>;
+static_assert(ranges::bidirectional_range<list_concat>);
+static_assert(!ranges::random_access_range<list_concat>);
+static_assert(ranges::sized_range<list_concat>);
+
+using fwd_concat =
+    ranges::concat_view<ranges::ref_view<std::forward_list<int>>,
+                        ranges::ref_view<std::vector<int>>>;
+static_assert(ranges::forward_range<fwd_concat>);
+static_assert(!ranges::bidirectional_range<fwd_concat>);
+
+using mixed_concat = ranges::concat_view<ranges::ref_view<std::vector<int>>,
+                                         ranges::ref_view<std::vector<long>>>;
+static_assert(ranges::same_as<ranges::range_reference_t<mixed_concat>, long>);
+
+}
+
+TEST_CASE("views.concat")
+{
+    std::vector<int> v1{0, 1};
+    std::vector<int> v2{};
+    std::vector<int> v3{2, 3, 4};
+
+    SECTION("random access")
+    {
+        auto c = views::concat(v1, v2, v3);
+        ::check_equal(c, {0, 1, 2, 3, 4});
+        CHECK(c.size() == 5);
+        CHECK(c.end() - c.begin() == 5);
+        CHECK(c[3] == 3);
+        CHECK(*(c.begin() + 2) == 2);
+        CHECK(c.end() - 3 == c.begin() + 2);
+        CHECK(c.begin() + 1 < c.begin() + 2);
+        CHECK(ranges::default_sentinel - (c.begin() + 1) == 4);
+        CHECK(&c[1] == &v1[1]);
+        ::check_equal(c | views::reverse, {4, 3, 2, 1, 0});
+
+        const auto& cc = c;
+        CHECK(cc.size() == 5);
+        CHECK(*cc.begin() == 0);
+    }
+
+    SECTION("bidirectional")
+    {
+        std::list<int> l{0, 1};
+        auto c = views::concat(l, v2, v3);
+        CHECK(c.size() == 5);
+        ::check_equal(c, {0, 1, 2, 3, 4});
+        ::check_equal(c | views::reverse, {4, 3, 2, 1, 0});
+    }
+
+    SECTION("forward, input and unbounded")
+    {
+        std::forward_list<int> fl{0, 1};
+        ::check_equal(views::concat(fl, v3), {0, 1, 2, 3, 4});
+
+        std::istringstream ss("0 1");
+        ::check_equal(views::concat(ranges::istream_view<int>(ss), v3),
+                      {0, 1, 2, 3, 4});
+
+        auto tw = views::iota(2) | views::take_while([](int i) { return i < 5; });
+        auto c = views::concat(v1, tw);
+        static_assert(!ranges::common_range<decltype(c)>);
+        ::check_equal(c, {0, 1, 2, 3, 4});
+    }
+
+    SECTION("copy and for_each run per segment")
+    {
+        auto c = views::concat(v1, v2, v3);
+
+        std::vector<int> out(5);
+        auto r = ranges::copy(c, out.begin());
+        CHECK(r.in == c.end());
+        CHECK(r.out == out.end());
+        CHECK(out == std::vector<int>{0, 1, 2, 3, 4});
+
+        std::vector<int> part(5, -1);
+        auto r2 = ranges::copy(c.begin() + 1, c.end() - 1, part.begin());
+        CHECK(r2.in == c.end() - 1);
+        CHECK(r2.out == part.begin() + 3);
+        CHECK(part == std::vector<int>{1, 2, 3, -1, -1});
+
+        int sum = 0;
+        auto r3 = ranges::for_each(c, [&sum](int i) { sum += i; });
+        CHECK(r3.in == c.end());
+        CHECK(sum == 10);
+
+        auto tw = views::iota(2) | views::take_while([](int i) { return i < 5; });
+        std::vector<int> out2(6, -1);
+        auto r4 = ranges::copy(views::concat(v1, tw), out2.begin());
+        CHECK(r4.out == out2.begin() + 5);
+        CHECK(out2 == std::vector<int>{0, 1, 2, 3, 4, -1});
+    }
+
+    SECTION("writable")
+    {
+        std::vector<int> a{5, 3};
+        std::vector<int> b{9, 1, 7};
+        int arr[2] = {4, 2};
+        auto c = views::concat(a, b, arr);
+        ranges::sort(c);
+        CHECK(a == std::vector<int>{1, 2});
+        CHECK(b == std::vector<int>{3, 4, 5});
+        CHECK(arr[0] == 7);
+        CHECK(arr[1] == 9);
+        CHECK(ranges::find(c, 5) == c.begin() + 4);
+
+        ranges::iter_swap(c.begin(), c.begin() + 6);
+        CHECK(a[0] == 9);
+        CHECK(arr[1] == 1);
+    }
+
+    SECTION("mixed element types")
+    {
+        std::vector<long> l{10, 20};
+        long sum = 0;
+        for (long i : views::concat(v3, l)) {
+            sum += i;
+        }
+        CHECK(sum == 39);
+    }
+
+    SECTION("a single range")
+    {
+        auto c = views::concat(v1);
+        static_assert(
+            ranges::same_as<decltype(c), ranges::ref_view<std::vector<int>>>);
+        CHECK(c.size() == 2);
+    }
+}
@@ -0,0 +1,80 @@
+// nanorange/test/views/merge_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/merge.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/take.hpp>
+#include <nanorange/views/transform.hpp>
+#include <nanorange/algorithm/equal.hpp>
+
+#include <forward_list>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_of_vecs = std::vector<std::vector<int>>;
+
+static_assert(ranges::view<ranges::merge_view<ranges::ref_view<vec_of_vecs>>>);
+static_assert(ranges::input_range<ranges::merge_view<ranges::ref_view<vec_of_vecs>>>);
+static_assert(!ranges::forward_range<ranges::merge_view<ranges::ref_view<vec_of_vecs>>>);
+
+}
+
+TEST_CASE("views.merge")
+{
+    vec_of_vecs runs{{1, 4, 7, 10}, {}, {2, 5, 8}, {0, 3, 6, 9, 11}};
+
+    SECTION("basic")
+    {
+        auto v = views::merge(runs);
+        CHECK(ranges::equal(v, views::iota(0, 12)));
+        // Calling begin() again restarts the merge
+        CHECK(ranges::equal(v, views::iota(0, 12)));
+    }
+
+    SECTION("pipe")
+    {
+        CHECK(ranges::equal(runs | views::merge, views::iota(0, 12)));
+    }
+
+    SECTION("with a comparator and projection")
+    {
+        std::vector<std::forward_list<int>> desc{{9, -6, 3}, {8, -7}, {-10}};
+        std::vector<int> out;
+        for (int i : desc | views::merge(ranges::greater{},
+                                         [](int x) { return x * x; })) {
+            out.push_back(i);
+        }
+        CHECK(out == std::vector<int>{-10, 9, 8, -7, -6, 3});
+
+        auto v = views::merge(desc, [](int a, int b) {
+            return a * a > b * b;
+        });
+        CHECK(ranges::equal(v, out));
+    }
+
+    SECTION("is lazy")
+    {
+        // Only the front of each of these infinite inputs is ever read
+        std::vector<ranges::iota_view<int>> inf{views::iota(0), views::iota(5),
+                                                views::iota(-3)};
+        auto v = views::merge(inf) | views::take(6);
+        CHECK(ranges::equal(v, std::vector<int>{-3, -2, -1, 0, 0, 1}));
+    }
+
+    SECTION("empty")
+    {
+        vec_of_vecs none;
+        CHECK(views::merge(none).begin() == ranges::default_sentinel);
+        vec_of_vecs empties(3);
+        CHECK(views::merge(empties).begin() == ranges::default_sentinel);
+    }
+}
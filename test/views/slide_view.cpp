@@ -0,0 +1,93 @@
+// nanorange/test/views/slide_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/slide.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/views/take_while.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_slide = ranges::slide_view<ranges::ref_view<std::vector<int>>>;
+
+static_assert(ranges::view<vec_slide>);
+static_assert(ranges::random_access_range<vec_slide>);
+static_assert(ranges::random_access_range<const vec_slide>);
+static_assert(ranges::sized_range<vec_slide>);
+static_assert(ranges::common_range<vec_slide>);
+static_assert(ranges::same_as<ranges::range_reference_t<vec_slide>,
+                              ranges::subrange<std::vector<int>::iterator>>);
+
+using list_slide = ranges::slide_view<ranges::ref_view<std::list<int>>>;
+static_assert(ranges::bidirectional_range<list_slide>);
+static_assert(ranges::common_range<list_slide>);
+
+template <typename R>
+std::vector<std::vector<int>> to_vectors(R&& r)
+{
+    std::vector<std::vector<int>> out;
+    for (auto&& window : r) {
+        out.emplace_back(window.begin(), window.end());
+    }
+    return out;
+}
+
+using vv = std::vector<std::vector<int>>;
+
+}
+
+TEST_CASE("views.slide")
+{
+    std::vector<int> vec{0, 1, 2, 3, 4};
+
+    SECTION("random access")
+    {
+        auto s = views::slide(vec, 3);
+        CHECK(to_vectors(s) == vv{{0, 1, 2}, {1, 2, 3}, {2, 3, 4}});
+        CHECK(s.size() == 3);
+        CHECK(s.end() - s.begin() == 3);
+        CHECK(s[2].front() == 2);
+        CHECK(to_vectors(s | views::reverse) ==
+              vv{{2, 3, 4}, {1, 2, 3}, {0, 1, 2}});
+    }
+
+    SECTION("fewer elements than the window")
+    {
+        auto s = vec | views::slide(6);
+        CHECK(s.size() == 0);
+        CHECK(s.begin() == s.end());
+
+        std::list<int> l{0, 1, 2};
+        CHECK(ranges::empty(l | views::slide(4) | views::reverse));
+    }
+
+    SECTION("bidirectional")
+    {
+        std::list<int> l{0, 1, 2, 3};
+        CHECK(to_vectors(l | views::slide(2) | views::reverse) ==
+              vv{{2, 3}, {1, 2}, {0, 1}});
+    }
+
+    SECTION("forward")
+    {
+        std::forward_list<int> fl{0, 1, 2, 3};
+        CHECK(to_vectors(views::slide(fl, 3)) == vv{{0, 1, 2}, {1, 2, 3}});
+
+        auto tw = views::iota(0) |
+                  views::take_while([](int i) { return i < 5; });
+        CHECK(to_vectors(tw | views::slide(4)) ==
+              vv{{0, 1, 2, 3}, {1, 2, 3, 4}});
+    }
+}
@@ -0,0 +1,103 @@
+// nanorange/test/views/stride_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/stride.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/istream.hpp>
+#include <nanorange/views/reverse.hpp>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_stride = ranges::stride_view<ranges::ref_view<std::vector<int>>>;
+
+static_assert(ranges::view<vec_stride>);
+static_assert(ranges::random_access_range<vec_stride>);
+static_assert(ranges::random_access_range<const vec_stride>);
+static_assert(ranges::sized_range<vec_stride>);
+static_assert(ranges::common_range<vec_stride>);
+static_assert(ranges::same_as<ranges::range_reference_t<vec_stride>, int&>);
+
+using list_stride = ranges::stride_view<ranges::ref_view<std::list<int>>>;
+static_assert(ranges::bidirectional_range<list_stride>);
+static_assert(!ranges::random_access_range<list_stride>);
+static_assert(ranges::sized_range<list_stride>);
+static_assert(ranges::common_range<list_stride>);
+
+using fwd_stride =
+    ranges::stride_view<ranges::ref_view<std::forward_list<int>>>;
+static_assert(ranges::forward_range<fwd_stride>);
+static_assert(ranges::common_range<fwd_stride>);
+
+using input_stride = ranges::stride_view<ranges::basic_istream_view<int, char>>;
+static_assert(ranges::input_range<input_stride>);
+static_assert(!ranges::forward_range<input_stride>);
+
+}
+
+TEST_CASE("views.stride")
+{
+    std::vector<int> vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    SECTION("random access")
+    {
+        auto s = views::stride(vec, 3);
+        ::check_equal(s, {0, 3, 6, 9});
+        CHECK(s.size() == 4);
+        CHECK(s.end() - s.begin() == 4);
+        CHECK(s[2] == 6);
+        CHECK(*(s.end() - 1) == 9);
+        CHECK(s.begin() + 4 == s.end());
+        ::check_equal(s | views::reverse, {9, 6, 3, 0});
+        ::check_equal(vec | views::stride(4) | views::reverse, {8, 4, 0});
+        ::check_equal(vec | views::stride(20), {0});
+    }
+
+    SECTION("bidirectional")
+    {
+        std::list<int> l{0, 1, 2, 3, 4, 5, 6};
+        auto s = l | views::stride(2);
+        CHECK(s.size() == 4);
+        ::check_equal(s, {0, 2, 4, 6});
+        ::check_equal(s | views::reverse, {6, 4, 2, 0});
+        ::check_equal(l | views::stride(4) | views::reverse, {4, 0});
+    }
+
+    SECTION("forward and input")
+    {
+        std::forward_list<int> fl{0, 1, 2, 3, 4};
+        ::check_equal(views::stride(fl, 2), {0, 2, 4});
+
+        std::istringstream ss("1 2 3 4 5 6 7");
+        ::check_equal(ranges::istream_view<int>(ss) | views::stride(3),
+                      {1, 4, 7});
+    }
+
+    SECTION("large random-access ranges are stepped, not walked")
+    {
+        auto s = views::iota(0LL, 1LL << 40) | views::stride(1LL << 20);
+        CHECK(s.size() == (1ULL << 20));
+        CHECK(*(s.begin() + 5) == 5LL << 20);
+        CHECK(*(s.end() - 1) == (1LL << 40) - (1LL << 20));
+    }
+
+    SECTION("writable")
+    {
+        auto s = views::stride(vec, 5);
+        ranges::iter_swap(s.begin(), s.begin() + 1);
+        CHECK(vec[0] == 5);
+        CHECK(vec[5] == 0);
+    }
+}
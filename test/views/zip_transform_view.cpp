@@ -0,0 +1,83 @@
+// nanorange/test/views/zip_transform_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/zip_transform.hpp>
+#include <nanorange/views/iota.hpp>
+
+#include <list>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+struct multiply {
+    constexpr double operator()(int i, double d) const { return i * d; }
+};
+
+using vec_zt = ranges::zip_transform_view<
+    multiply, ranges::ref_view<std::vector<int>>,
+    ranges::ref_view<std::vector<double>>>;
+
+static_assert(ranges::view<vec_zt>);
+static_assert(ranges::random_access_range<vec_zt>);
+static_assert(ranges::random_access_range<const vec_zt>);
+static_assert(ranges::sized_range<vec_zt>);
+static_assert(ranges::common_range<vec_zt>);
+static_assert(ranges::same_as<ranges::range_reference_t<vec_zt>, double>);
+
+}
+
+TEST_CASE("views.zip_transform")
+{
+    std::vector<int> ints{1, 2, 3, 4};
+    std::vector<double> doubles{0.5, 1.5, 2.5};
+
+    SECTION("basic")
+    {
+        auto zt = views::zip_transform(multiply{}, ints, doubles);
+        CHECK(zt.size() == 3);
+        ::check_equal(zt, {0.5, 3.0, 7.5});
+        CHECK(zt[2] == 7.5);
+        CHECK(*(zt.end() - 1) == 7.5);
+
+        const auto& czt = zt;
+        ::check_equal(czt, {0.5, 3.0, 7.5});
+    }
+
+    SECTION("references")
+    {
+        std::list<int> l{10, 20, 30, 40, 50};
+        auto zt = views::zip_transform(
+            [](int& i, int j) -> int& { return i += j; }, ints, l);
+        static_assert(ranges::bidirectional_range<decltype(zt)>);
+        static_assert(!ranges::common_range<decltype(zt)>);
+        static_assert(
+            ranges::same_as<ranges::range_reference_t<decltype(zt)>, int&>);
+        for (int& i : zt) {
+            i *= 2;
+        }
+        CHECK(ints == std::vector<int>{22, 44, 66, 88});
+    }
+
+    SECTION("infinite")
+    {
+        auto zt = views::zip_transform([](int i, int j) { return i - j; },
+                                       views::iota(0), ints);
+        ::check_equal(zt, {-1, -1, -1, -1});
+    }
+
+    SECTION("empty")
+    {
+        auto zt = views::zip_transform([] { return 1; });
+        CHECK(ranges::empty(zt));
+        static_assert(
+            ranges::same_as<decltype(zt), ranges::empty_view<int>>);
+    }
+}
@@ -0,0 +1,179 @@
+// nanorange/test/views/zip_view.cpp
+//
+// Copyright (c) 2019 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <nanorange/views/zip.hpp>
+#include <nanorange/views/elements.hpp>
+#include <nanorange/views/iota.hpp>
+#include <nanorange/views/istream.hpp>
+#include <nanorange/views/reverse.hpp>
+#include <nanorange/algorithm/reverse.hpp>
+#include <nanorange/algorithm/sort.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
+
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../catch.hpp"
+#include "../test_utils.hpp"
+
+namespace ranges = nano::ranges;
+namespace views = ranges::views;
+
+namespace {
+
+using vec_zip = ranges::zip_view<ranges::ref_view<std::vector<int>>,
+                                 ranges::ref_view<std::vector<std::string>>>;
+using vec_zip_iter = ranges::iterator_t<vec_zip>;
+
+static_assert(ranges::view<vec_zip>);
+static_assert(ranges::random_access_range<vec_zip>);
+static_assert(ranges::random_access_range<const vec_zip>);
+static_assert(ranges::sized_range<vec_zip>);
+static_assert(ranges::common_range<vec_zip>);
+static_assert(ranges::same_as<ranges::iter_reference_t<vec_zip_iter>,
+    ranges::detail::zip_tuple<int&, std::string&>>);
+static_assert(ranges::same_as<ranges::iter_value_t<vec_zip_iter>,
+    std::tuple<int, std::string>>);
+static_assert(ranges::same_as<ranges::iter_rvalue_reference_t<vec_zip_iter>,
+    ranges::detail::zip_tuple<int&&, std::string&&>>);
+static_assert(ranges::sortable<vec_zip_iter>);
+
+using list_zip = ranges::zip_view<ranges::ref_view<std::vector<int>>,
+                                  ranges::ref_view<std::list<int>>>;
+static_assert(ranges::bidirectional_range<list_zip>);
+static_assert(!ranges::random_access_range<list_zip>);
+static_assert(!ranges::common_range<list_zip>);
+static_assert(ranges::sized_range<list_zip>);
+
+using fwd_zip = ranges::zip_view<ranges::ref_view<std::forward_list<int>>,
+                                 ranges::ref_view<std::vector<int>>>;
+static_assert(ranges::forward_range<fwd_zip>);
+static_assert(!ranges::bidirectional_range<fwd_zip>);
+static_assert(ranges::common_range<fwd_zip>);
+static_assert(!ranges::sized_range<fwd_zip>);
+
+}
+
+TEST_CASE("views.zip")
+{
+    std::vector<int> keys{3, 1, 4, 2, 5};
+    std::vector<std::string> names{"three", "one", "four", "two", "five"};
+
+    SECTION("basic")
+    {
+        auto z = views::zip(keys, names);
+        CHECK(z.size() == 5);
+        CHECK(std::get<0>(z[2]) == 4);
+        CHECK(std::get<1>(z[2]) == "four");
+        CHECK(&std::get<1>(*z.begin()) == &names[0]);
+
+        std::vector<int> out;
+        for (auto [k, n] : z) {
+            out.push_back(k * int(n.size()));
+        }
+        CHECK(out == std::vector<int>{15, 3, 16, 6, 20});
+    }
+
+    SECTION("stops at the end of the shortest range")
+    {
+        std::list<double> l{0.5, 1.5};
+        auto z = views::zip(keys, l);
+        CHECK(z.size() == 2);
+        CHECK(ranges::distance(z) == 2);
+        CHECK(ranges::distance(views::zip(views::iota(0), keys)) == 5);
+
+        std::forward_list<int> fl{1, 2, 3, 4, 5, 6, 7};
+        CHECK(ranges::distance(views::zip(fl, keys)) == 5);
+
+        std::vector<int> two{1, 2};
+        auto ra = views::zip(keys, two);
+        CHECK(ra.end() - ra.begin() == 2);
+        ::check_equal(ra | views::reverse | views::elements<0>, {1, 3});
+    }
+
+    SECTION("input ranges")
+    {
+        std::istringstream ss("1 2 3 4 5 6 7");
+        std::vector<int> out;
+        for (auto [i, k] : views::zip(ranges::istream_view<int>(ss), keys)) {
+            out.push_back(i * k);
+        }
+        CHECK(out == std::vector<int>{3, 2, 12, 8, 25});
+    }
+
+    SECTION("writable")
+    {
+        auto z = views::zip(keys, names);
+        z[0] = std::tuple<int, std::string>(30, "thirty");
+        CHECK(keys[0] == 30);
+        CHECK(names[0] == "thirty");
+        ranges::iter_swap(z.begin(), z.begin() + 4);
+        CHECK(keys[0] == 5);
+        CHECK(names[0] == "five");
+        CHECK(keys[4] == 30);
+        CHECK(names[4] == "thirty");
+    }
+
+    SECTION("sort")
+    {
+        auto z = views::zip(keys, names);
+        ranges::sort(z);
+        CHECK(keys == std::vector<int>{1, 2, 3, 4, 5});
+        CHECK(names == std::vector<std::string>{"one", "two", "three", "four",
+                                                "five"});
+
+        ranges::sort(z, ranges::less{}, [](const auto& t) -> decltype(auto) {
+            return std::get<1>(t);
+        });
+        CHECK(keys == std::vector<int>{5, 4, 1, 3, 2});
+
+        ranges::reverse(z);
+        CHECK(keys == std::vector<int>{2, 3, 1, 4, 5});
+        CHECK(names == std::vector<std::string>{"two", "three", "one", "four",
+                                                "five"});
+    }
+
+    SECTION("sort move-only columns")
+    {
+        const int n = 1000;
+        std::vector<int> k;
+        std::vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < n; ++i) {
+            k.push_back(i * 7919 % n);
+            v.push_back(std::make_unique<int>(k.back()));
+        }
+        auto z = views::zip(k, v);
+
+        ranges::sort(z, ranges::greater{});
+        bool ok = true;
+        for (int i = 0; i < n; ++i) {
+            ok = ok && k[i] == n - 1 - i && *v[i] == k[i];
+        }
+        CHECK(ok);
+
+        ranges::stable_sort(z, ranges::less{},
+                            [](const auto& t) { return std::get<0>(t) % 10; });
+        for (int i = 0; i < n; ++i) {
+            ok = ok && *v[i] == k[i];
+            if (i > 0) {
+                ok = ok && (k[i - 1] % 10 < k[i] % 10 ||
+                            (k[i - 1] % 10 == k[i] % 10 && k[i - 1] > k[i]));
+            }
+        }
+        CHECK(ok);
+    }
+
+    SECTION("empty")
+    {
+        auto z = views::zip();
+        CHECK(ranges::empty(z));
+        static_assert(ranges::same_as<decltype(z),
+                                      ranges::empty_view<std::tuple<>>>);
+    }
+}